@@ -1,23 +1,123 @@
 #include "application_client.h"
+#include <fcntl.h>
+#include <linux/errqueue.h>
+#include <netinet/tcp.h>
+#include <climits>
+#include <cmath>
+#include <algorithm>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <poll.h>
 
 namespace InterProcessCommunication
 {
 ApplicationClient::~ApplicationClient()
 {
+    // The RX consumer may be waiting for the executor to make room, and has to be let go before it can be stopped. A resume that the last task
+    // posted to the event loop runs ahead of the detaching below.
+    StopRxDispatch();
+
+    if(m_reactor != nullptr)
+    {
+        // Detach from the event loop before this object goes away so that no further readiness events are dispatched to it
+        m_reactor->Execute(m_reactor_event_loop, [this]()
+        {
+            CancelReactorReconnect();
+            CancelReactorConnectTimeout();
+
+            if(m_reactor_watching_socket)
+            {
+                m_reactor->Unwatch(m_reactor_event_loop, m_client_file_descriptor);
+                m_reactor_watching_socket = false;
+            }
+
+            CloseSocket();
+        });
+
+        // In-flight io_uring operations still point at this client and its buffers. Shutting the socket down makes them complete, so wait until the event loop has reaped them.
+        bool has_pending_operations = m_reactor_uses_io_uring;
+
+        while(has_pending_operations && m_reactor->IsRunning() && not m_reactor->IsEventLoopThread(m_reactor_event_loop))
+        {
+            m_reactor->Execute(m_reactor_event_loop, [&]()
+            {
+                has_pending_operations = m_reactor_pending_operations > 0;
+            });
+        }
+    }
+
     SignalRxWorkerThreadShutdown();
     SignalTxWorkerThreadShutdown();
     SignalMonitorWorkerThreadShutdown();
     JoinThreads();
+
+    CloseRxMemfds();
+    close(m_connect_cancel_file_descriptor);
 }
 
-ApplicationClient::ApplicationClient(const std::string &ipv4_address, uint16_t port)
+ApplicationClient::ApplicationClient(const std::string &ipv4_address, uint16_t port, const ClientOptions& options)
 : m_endpoint(Endpoint{.socket_mode = SocketMode::TCP_IPV4, .ip_address = ipv4_address, .port = port})
+, m_options(options)
+, m_memfd_transfer_enabled(IsMemfdTransferApplicable(SocketMode::TCP_IPV4, options))
+, m_framing_enabled(IsFramingApplicable(SocketMode::TCP_IPV4, options))
+, m_rx_buffer_pool(RxBufferPool::Create(options.rx_buffer.buffer_size, options.rx_buffer.max_buffer_size, options.rx_buffer.max_pooled_buffers))
+, m_rx_executor(CreateRxExecutor(options.rx_dispatch))
+, m_statistics(options.statistics.latency_histograms)
 {
+    if(m_framing_enabled)
+    {
+        m_rx_frame_decoder = std::make_unique<FrameDecoder>(m_options.framing, m_rx_buffer_pool, [this](const RxBufferRef& rx_buffer, const std::span<char>& rx_bytes)
+        {
+            DeliverRxMessage(rx_buffer, rx_bytes);
+        });
+    }
+}
+
+ApplicationClient::ApplicationClient(const std::string &unix_socket_path, const ClientOptions& options)
+: m_endpoint(Endpoint{.socket_mode = GetUnixSocketMode(options), .unix_socket_path = unix_socket_path})
+, m_options(options)
+, m_memfd_transfer_enabled(IsMemfdTransferApplicable(m_endpoint.socket_mode, options))
+, m_framing_enabled(IsFramingApplicable(m_endpoint.socket_mode, options))
+, m_rx_buffer_pool(RxBufferPool::Create(options.rx_buffer.buffer_size, options.rx_buffer.max_buffer_size, options.rx_buffer.max_pooled_buffers))
+, m_rx_executor(CreateRxExecutor(options.rx_dispatch))
+, m_statistics(options.statistics.latency_histograms)
+{
+    if(m_framing_enabled)
+    {
+        FrameDecoder::MemfdFrameCallback memfd_frame_callback;
+
+        if(m_memfd_transfer_enabled)
+        {
+            memfd_frame_callback = [this]()
+            {
+                return DeliverRxMemfd();
+            };
+        }
+
+        m_rx_frame_decoder = std::make_unique<FrameDecoder>(m_options.framing, m_rx_buffer_pool, [this](const RxBufferRef& rx_buffer, const std::span<char>& rx_bytes)
+        {
+            DeliverRxMessage(rx_buffer, rx_bytes);
+        }, std::move(memfd_frame_callback));
+    }
 }
 
-ApplicationClient::ApplicationClient(const std::string &unix_socket_path)
-: m_endpoint(Endpoint{.socket_mode = SocketMode::UNIX_DOMAIN, .unix_socket_path = unix_socket_path})
+ApplicationClient::ApplicationClient(const SharedMemoryEndpoint& shared_memory_endpoint, const ClientOptions& options)
+: m_endpoint(Endpoint{.socket_mode = SocketMode::SHARED_MEMORY, .shared_memory_name = shared_memory_endpoint.name})
+, m_options(options)
+, m_memfd_transfer_enabled(IsMemfdTransferApplicable(SocketMode::SHARED_MEMORY, options))
+, m_framing_enabled(IsFramingApplicable(SocketMode::SHARED_MEMORY, options))
+, m_rx_buffer_pool(RxBufferPool::Create(options.rx_buffer.buffer_size, options.rx_buffer.max_buffer_size, options.rx_buffer.max_pooled_buffers))
+, m_rx_executor(CreateRxExecutor(options.rx_dispatch))
+, m_statistics(options.statistics.latency_histograms)
 {
+    if(m_framing_enabled)
+    {
+        m_rx_frame_decoder = std::make_unique<FrameDecoder>(m_options.framing, m_rx_buffer_pool, [this](const RxBufferRef& rx_buffer, const std::span<char>& rx_bytes)
+        {
+            DeliverRxMessage(rx_buffer, rx_bytes);
+        });
+    }
 }
 
 void ApplicationClient::SetConnectionCallback(ConnectedCallback callback)
@@ -35,11 +135,33 @@ void ApplicationClient::SetRxCallback(RxCallback callback)
     m_rx_callback = std::move(callback);
 }
 
+void ApplicationClient::SetRxBufferCallback(RxBufferCallback callback)
+{
+    m_rx_buffer_callback = std::move(callback);
+}
+
+void ApplicationClient::SetRxBatchCallback(RxBatchCallback callback)
+{
+    m_rx_batch_callback = std::move(callback);
+}
+
 void ApplicationClient::SetErrorCallback(ErrorCallback callback)
 {
     m_error_callback = std::move(callback);
 }
 
+void ApplicationClient::SetTxHighWatermarkCallback(TxWatermarkCallback callback)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_tx_watermark_callback_mutex);
+    m_tx_high_watermark_callback = std::move(callback);
+}
+
+void ApplicationClient::SetTxLowWatermarkCallback(TxWatermarkCallback callback)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_tx_watermark_callback_mutex);
+    m_tx_low_watermark_callback = std::move(callback);
+}
+
 bool ApplicationClient::Start()
 {
     if(m_worker_threads_started)
@@ -47,6 +169,15 @@ bool ApplicationClient::Start()
         return false;
     }
 
+    // Without it a connection attempt can still time out, but can only be cancelled once it does
+    m_connect_cancel_file_descriptor = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    if(m_connect_cancel_file_descriptor < 0)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to create the connect cancellation event! Error code: {" + std::to_string(errno) +"}";
+        perror(error_message.c_str());
+    }
+
     SetMonitorWorkerThreadState(WorkerThreadState::STARTING);
     SetTxWorkerThreadState(WorkerThreadState::STARTING);
     SetRxWorkerThreadState(WorkerThreadState::STARTING);
@@ -60,8 +191,53 @@ bool ApplicationClient::Start()
     return m_worker_threads_started;
 }
 
+bool ApplicationClient::Start(ClientReactor& reactor)
+{
+    if(m_worker_threads_started)
+    {
+        return false;
+    }
+
+    // The rings have no descriptor that an event loop could watch
+    if(m_endpoint.socket_mode == SocketMode::SHARED_MEMORY)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> A shared memory client can not be driven by a reactor!";
+        std::cerr << error_message << "\n";
+        return false;
+    }
+
+    // A SEQPACKET message that did not fit into the RX buffer can only be told apart by the flags of its recvmsg()
+    if(m_endpoint.socket_mode == SocketMode::UNIX_SEQPACKET && reactor.GetBackend() == ReactorBackend::IO_URING)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> A SEQPACKET client can not be driven by the IO_URING reactor backend!";
+        std::cerr << error_message << "\n";
+        return false;
+    }
+
+    // The descriptors of memfd frames arrive as ancillary data, which the IO_URING backend's receives discard
+    if(m_memfd_transfer_enabled && reactor.GetBackend() == ReactorBackend::IO_URING)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> A memfd transfer client can not be driven by the IO_URING reactor backend!";
+        std::cerr << error_message << "\n";
+        return false;
+    }
+
+    m_reactor = &reactor;
+    m_reactor_event_loop = reactor.AssignEventLoop();
+    m_reactor_uses_io_uring = reactor.GetBackend() == ReactorBackend::IO_URING;
+
+    m_worker_threads_started = true;
+
+    return m_worker_threads_started;
+}
+
 bool ApplicationClient::IsRunning() const
 {
+    if(m_reactor != nullptr)
+    {
+        return m_reactor->IsRunning();
+    }
+
     return m_monitor_connection_thread_state == WorkerThreadState::RUNNING;
 }
 
@@ -80,6 +256,12 @@ bool ApplicationClient::RequestOpen()
 
     SetClientState(ClientState::OPENING);
 
+    if(m_reactor != nullptr)
+    {
+        m_reactor->Post(m_reactor_event_loop, [this](){ OpenReactorConnection(); });
+        return true;
+    }
+
     // Signal the connection monitor to open a connection
     m_monitor_connection_semaphore.release();
 
@@ -88,12 +270,44 @@ bool ApplicationClient::RequestOpen()
 
 bool ApplicationClient::RequestClose()
 {
-    if(GetClientState() != ClientState::CONNECTED)
+    // The state is claimed atomically, since the thread that connects or reconnects moves it on by itself
+    const bool is_connected = CompareAndSetClientState(ClientState::CONNECTED, ClientState::CLOSING);
+    const bool is_reconnecting = not is_connected && CompareAndSetClientState(ClientState::RECONNECTING, ClientState::CLOSING);
+
+    if(not is_connected && not is_reconnecting && not CompareAndSetClientState(ClientState::OPENING, ClientState::CLOSING))
     {
         return false;
     }
 
-    SetClientState(ClientState::CLOSING);
+    if(m_reactor != nullptr)
+    {
+        m_reactor->Post(m_reactor_event_loop, [this, is_connected]()
+        {
+            if(GetClientState() != ClientState::CLOSING)
+            {
+                return;
+            }
+
+            CancelReactorReconnect();
+
+            // The disconnected callback already ran when the connection was lost, and a cancelled attempt never connected
+            CloseReactorConnection(is_connected);
+
+            if(m_reconnecting)
+            {
+                EndReconnecting(false);
+            }
+        });
+
+        return true;
+    }
+
+    // The connection monitor thread is busy with a connection attempt, or has yet to pick up the open request, so only the attempt is woken up
+    if(not is_connected && not is_reconnecting)
+    {
+        SignalConnectCancel();
+        return true;
+    }
 
     // Signal the connection monitor thread to close the socket
     m_monitor_connection_semaphore.release();
@@ -101,396 +315,3446 @@ bool ApplicationClient::RequestClose()
     return true;
 }
 
-bool ApplicationClient::EnqueuePayload(const std::span<char>& tx_bytes)
+bool ApplicationClient::EnqueuePayload(const std::span<char>& tx_bytes, TxCompletionCallback completion_callback, size_t lane)
 {
-    if(tx_bytes.empty())
+    // A payload that goes as a memfd is copied straight into the memfd on enqueue, so it is borrowed rather than copied into a vector first
+    if(m_memfd_transfer_enabled && tx_bytes.size() >= m_options.memfd_transfer.min_payload_size)
     {
-        return false;
+        TxPayload tx_payload = CreateBorrowedTxPayload(tx_bytes);
+        tx_payload.completion_callback = std::move(completion_callback);
+
+        return EnqueueTxPayload(std::move(tx_payload), true, lane);
     }
 
-    std::lock_guard<std::mutex> lock(m_tx_queue_mutex);
+    return EnqueuePayload(std::vector<char>(tx_bytes.begin(), tx_bytes.end()), std::move(completion_callback), lane);
+}
 
-    m_tx_queue.emplace_back(std::move(std::vector<char>(tx_bytes.begin(),tx_bytes.end())));
+bool ApplicationClient::EnqueuePayload(std::vector<char>&& tx_bytes, TxCompletionCallback completion_callback, size_t lane)
+{
+    return EnqueueTxPayload(CreateTxPayload(std::move(tx_bytes), std::move(completion_callback)), true, lane);
+}
 
-    // Signal the TX sender thread to resume
-    m_process_tx_payloads_semaphore.release();
+bool ApplicationClient::EnqueuePayload(std::unique_ptr<char[]> tx_bytes, size_t size, TxCompletionCallback completion_callback, size_t lane)
+{
+    return EnqueueTxPayload(CreateTxPayload(std::move(tx_bytes), size, std::move(completion_callback)), true, lane);
+}
 
-    return true;
+bool ApplicationClient::EnqueuePayload(SharedPayload tx_bytes, TxCompletionCallback completion_callback, size_t lane)
+{
+    return EnqueueTxPayload(CreateTxPayload(std::move(tx_bytes), std::move(completion_callback)), true, lane);
 }
 
-void ApplicationClient::ClearOutboundPayloads()
+bool ApplicationClient::EnqueuePayload(MemfdPayload tx_bytes, TxCompletionCallback completion_callback, size_t lane)
 {
-    std::lock_guard<std::mutex> lock(m_tx_queue_mutex);
-    m_tx_queue.clear();
+    TxPayload tx_payload {.storage = std::move(tx_bytes), .completion_callback = std::move(completion_callback)};
+    tx_payload.bytes = std::get<MemfdPayload>(tx_payload.storage).GetBytes();
+
+    return EnqueueTxPayload(std::move(tx_payload), true, lane);
 }
 
-void ApplicationClient::JoinThreads()
+bool ApplicationClient::TryEnqueuePayload(const std::span<char>& tx_bytes, TxCompletionCallback completion_callback, size_t lane)
 {
-    if(m_monitor_connection_thread.joinable())
-    {
-        m_monitor_connection_thread.join();
-    }
-    
-    if(m_process_rx_payloads_thread.joinable())
+    if(m_memfd_transfer_enabled && tx_bytes.size() >= m_options.memfd_transfer.min_payload_size)
     {
-        m_process_rx_payloads_thread.join();
-    }
+        TxPayload tx_payload = CreateBorrowedTxPayload(tx_bytes);
+        tx_payload.completion_callback = std::move(completion_callback);
 
-    if(m_process_tx_payloads_thread.joinable())
-    {
-        m_process_tx_payloads_thread.join();
+        return EnqueueTxPayload(std::move(tx_payload), false, lane);
     }
 
-    m_worker_threads_started = false;
+    return TryEnqueuePayload(std::vector<char>(tx_bytes.begin(), tx_bytes.end()), std::move(completion_callback), lane);
 }
 
-void ApplicationClient::SetMonitorWorkerThreadState(const WorkerThreadState &worker_thread_state)
+bool ApplicationClient::TryEnqueuePayload(std::vector<char>&& tx_bytes, TxCompletionCallback completion_callback, size_t lane)
 {
-    std::shared_lock lock(m_monitor_connection_thread_state_mutex);
-    m_monitor_connection_thread_state = worker_thread_state;
+    return EnqueueTxPayload(CreateTxPayload(std::move(tx_bytes), std::move(completion_callback)), false, lane);
 }
 
-ApplicationClient::WorkerThreadState ApplicationClient::GetMonitorWorkerThreadState() const
+bool ApplicationClient::TryEnqueuePayload(std::unique_ptr<char[]> tx_bytes, size_t size, TxCompletionCallback completion_callback, size_t lane)
 {
-    std::shared_lock lock(m_monitor_connection_thread_state_mutex);
-    return m_monitor_connection_thread_state;
+    return EnqueueTxPayload(CreateTxPayload(std::move(tx_bytes), size, std::move(completion_callback)), false, lane);
 }
 
-void ApplicationClient::SignalMonitorWorkerThreadShutdown()
+bool ApplicationClient::TryEnqueuePayload(SharedPayload tx_bytes, TxCompletionCallback completion_callback, size_t lane)
 {
-    SetMonitorWorkerThreadState(WorkerThreadState::ENDING);
-    m_monitor_connection_semaphore.release();
+    return EnqueueTxPayload(CreateTxPayload(std::move(tx_bytes), std::move(completion_callback)), false, lane);
 }
 
-void ApplicationClient::SetTxWorkerThreadState(const WorkerThreadState &worker_thread_state)
+ApplicationClient::TxPayload ApplicationClient::CreateTxPayload(std::vector<char>&& tx_bytes, TxCompletionCallback completion_callback)
 {
-    std::shared_lock lock(m_process_tx_payloads_thread_state_mutex);
-    m_process_tx_payloads_thread_state = worker_thread_state;
-}
+    // Moving the vector into the storage keeps its heap buffer, so the view stays valid
+    TxPayload tx_payload {.storage = std::move(tx_bytes), .completion_callback = std::move(completion_callback)};
+    tx_payload.bytes = std::get<std::vector<char>>(tx_payload.storage);
 
-ApplicationClient::WorkerThreadState ApplicationClient::GetTxWorkerThreadState() const
-{
-    std::shared_lock lock(m_process_tx_payloads_thread_state_mutex);
-    return m_process_tx_payloads_thread_state;
+    return tx_payload;
 }
 
-void ApplicationClient::SignalTxWorkerThreadShutdown()
+ApplicationClient::TxPayload ApplicationClient::CreateTxPayload(std::unique_ptr<char[]> tx_bytes, size_t size, TxCompletionCallback completion_callback)
 {
-    SetTxWorkerThreadState(WorkerThreadState::ENDING);
-    m_process_tx_payloads_semaphore.release();
+    const std::span<char> tx_bytes_view(tx_bytes.get(), tx_bytes != nullptr ? size : 0);
+
+    return TxPayload {.storage = std::move(tx_bytes), .bytes = tx_bytes_view, .completion_callback = std::move(completion_callback)};
 }
 
-void ApplicationClient::SetRxWorkerThreadState(const WorkerThreadState &worker_thread_state)
+ApplicationClient::TxPayload ApplicationClient::CreateTxPayload(SharedPayload tx_bytes, TxCompletionCallback completion_callback)
 {
-    std::shared_lock lock(m_process_rx_payloads_thread_state_mutex);
-    m_process_rx_payloads_thread_state = worker_thread_state;
+    // A null payload is left without bytes, which EnqueueTxPayload() rejects
+    if(tx_bytes == nullptr)
+    {
+        return TxPayload {.completion_callback = std::move(completion_callback)};
+    }
+
+    // The client only reads from the view, the cast merely lets it share the span<char> type used by the error callback
+    const std::span<char> tx_bytes_view(const_cast<char*>(tx_bytes->data()), tx_bytes->size());
+
+    return TxPayload {.storage = std::move(tx_bytes), .bytes = tx_bytes_view, .completion_callback = std::move(completion_callback)};
 }
 
-ApplicationClient::WorkerThreadState ApplicationClient::GetRxWorkerThreadState() const
+ApplicationClient::TxPayload ApplicationClient::CreateBorrowedTxPayload(std::span<const char> tx_bytes)
 {
-    std::shared_lock lock(m_process_rx_payloads_thread_state_mutex);
-    return m_process_rx_payloads_thread_state;
+    // The client only reads from the view, the cast merely lets it share the span<char> type used by the error callback
+    const std::span<char> tx_bytes_view(const_cast<char*>(tx_bytes.data()), tx_bytes.size());
+
+    return TxPayload {.bytes = tx_bytes_view, .is_borrowed = true};
 }
 
-void ApplicationClient::SignalRxWorkerThreadShutdown()
+bool ApplicationClient::EnqueueTxPayload(TxPayload&& tx_payload, bool may_wait, size_t lane)
 {
-    SetRxWorkerThreadState(WorkerThreadState::ENDING);
+    const bool is_memfd_frame = IsMemfdTxPayload(tx_payload);
+
+    if((tx_payload.bytes.empty() && not is_memfd_frame) || lane >= m_tx_queues.size())
+    {
+        return false;
+    }
+
+    // The memfd is written (or sealed) on the producer's thread, so the TX consumer only ever passes a descriptor
+    if(is_memfd_frame && not StoreTxPayloadInMemfd(tx_payload))
+    {
+        return false;
+    }
+
+    // Lane traffic is delimited by chunk headers, which the TX consumer writes as it cuts the payload into chunks
+    if(m_framing_enabled && not m_options.tx_lanes.enabled)
+    {
+        if(tx_payload.is_memfd_frame)
+        {
+            tx_payload.frame_header_size = EncodeFrameHeader(m_options.framing, GetMemfdFrameFlag(m_options.framing), tx_payload.frame_header);
+        }
+        else if(tx_payload.bytes.size() > GetMaxFramePayloadSize(m_options.framing))
+        {
+            return false;
+        }
+        else
+        {
+            tx_payload.frame_header_size = EncodeFrameHeader(m_options.framing, tx_payload.bytes.size(), tx_payload.frame_header);
+        }
+    }
+
+    if(IsTxQueueAccounted() && not AdmitTxPayload(tx_payload.bytes.size(), may_wait))
+    {
+        return false;
+    }
+
+    tx_payload.clear_generation = m_tx_clear_generation.load();
+    tx_payload.enqueue_timestamp = m_statistics.GetLatencyTimestamp();
+    tx_payload.lane = lane;
+
+    // Counted ahead of the push, so that the consumer never dequeues more payloads than were counted
+    m_statistics.RecordEnqueue();
+    m_tx_queues[lane].Push(std::move(tx_payload));
+
+    SignalTxConsumer();
+
+    return true;
 }
 
-void ApplicationClient::ExecuteErrorCallback(const Error &error, const std::optional<std::span<char>> &tx_payload_opt)
+ApplicationClient::SocketMode ApplicationClient::GetUnixSocketMode(const ClientOptions& options)
 {
-    std::lock_guard<std::mutex> lock(m_error_callback_mutex);
-    m_error_callback(error, tx_payload_opt);
+    return options.unix_socket.type == UnixSocketType::SEQPACKET ? SocketMode::UNIX_SEQPACKET : SocketMode::UNIX_DOMAIN;
 }
 
-void ApplicationClient::ExecuteDisconnectedCallback()
+bool ApplicationClient::IsMemfdTransferApplicable(SocketMode socket_mode, const ClientOptions& options)
 {
-    std::lock_guard<std::mutex> lock(m_disconnected_callback_mutex);
-    m_disconnected_callback();
+    // Memfd frames are marked in the frame header, whose top bit a two-byte header can not spare
+    return options.memfd_transfer.enabled && socket_mode == SocketMode::UNIX_DOMAIN && options.framing.enabled && not options.tx_lanes.enabled
+        && options.framing.header_size != FrameHeaderSize::TWO_BYTES;
 }
 
-void ApplicationClient::SetClientState(const ClientState &client_state)
+bool ApplicationClient::IsFramingApplicable(SocketMode socket_mode, const ClientOptions& options)
 {
-    std::unique_lock lock(m_client_state_mutex);
-    m_client_state = client_state;
+    // The kernel keeps the boundaries of SEQPACKET messages by itself
+    return options.framing.enabled && socket_mode != SocketMode::UNIX_SEQPACKET;
 }
 
-bool ApplicationClient::OpenConnection()
+bool ApplicationClient::IsMemfdTxPayload(const TxPayload& tx_payload) const
 {
-    // Ensure the file descriptors are cleaned up before opening a connection
-    shutdown(m_client_file_descriptor, SHUT_RDWR);
-    close(m_client_file_descriptor);
+    if(not m_memfd_transfer_enabled)
+    {
+        return false;
+    }
 
-    if(OpenSocket() && Connect())
+    if(const MemfdPayload* memfd_payload = std::get_if<MemfdPayload>(&tx_payload.storage))
     {
-        SetClientState(ClientState::CONNECTED);
-        m_connected_callback();
-        return true;
+        return memfd_payload->GetSize() > 0;
     }
 
-    return false;
+    // A payload too large for the length field would set the memfd frame flag, so it goes as a memfd whatever the threshold
+    return not tx_payload.bytes.empty() && (tx_payload.bytes.size() >= m_options.memfd_transfer.min_payload_size || tx_payload.bytes.size() >= GetMemfdFrameFlag(m_options.framing));
 }
 
-bool ApplicationClient::OpenSocket()
+bool ApplicationClient::StoreTxPayloadInMemfd(TxPayload& tx_payload) const
 {
-    SetClientState(ClientState::OPENING);
-
-    bool result = false;
-
-    if(m_endpoint.socket_mode == SocketMode::TCP_IPV4)
+    if(MemfdPayload* memfd_payload = std::get_if<MemfdPayload>(&tx_payload.storage))
     {
-        result = OpenTcpIpv4Socket();
+        if(not memfd_payload->Seal())
+        {
+            return false;
+        }
     }
-    else if(m_endpoint.socket_mode == SocketMode::UNIX_DOMAIN)
+    else
     {
-        result = OpenUnixDomainSocket();
+        std::optional<MemfdPayload> sealed_payload = MemfdPayload::CreateSealed(tx_payload.bytes);
+
+        if(not sealed_payload.has_value())
+        {
+            return false;
+        }
+
+        // The original storage is released right away, and borrowed bytes are no longer needed
+        tx_payload.storage = std::move(sealed_payload.value());
+        tx_payload.is_borrowed = false;
     }
 
-    return result;
+    tx_payload.bytes = std::span<char>();
+    tx_payload.is_memfd_frame = true;
+
+    return true;
 }
 
-bool ApplicationClient::OpenTcpIpv4Socket()
+bool ApplicationClient::IsTxQueueAccounted() const
 {
-    int client_socket_fd = -1;
+    const TxQueueOptions& tx_queue_options = m_options.tx_queue;
 
-    client_socket_fd = socket(AF_INET, SOCK_STREAM, 0);
+    return tx_queue_options.max_payloads > 0 || tx_queue_options.max_bytes > 0 || tx_queue_options.high_watermark_bytes > 0;
+}
 
-    if(client_socket_fd < 0)
+bool ApplicationClient::IsTxConsumerThread() const
+{
+    if(m_reactor != nullptr)
     {
-        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to open socket! Error code: {" + std::to_string(errno) +"}";
-        perror(error_message.c_str());
-        ExecuteErrorCallback(Error::SOCKET_OPEN_FAILURE,std::nullopt);
-        return false;
+        return m_reactor->IsEventLoopThread(m_reactor_event_loop);
     }
 
-    m_client_file_descriptor = client_socket_fd;
-    return true;
+    return std::this_thread::get_id() == m_process_tx_payloads_thread.get_id();
 }
 
-bool ApplicationClient::OpenUnixDomainSocket()
+bool ApplicationClient::AdmitTxPayload(size_t payload_bytes, bool may_wait)
 {
-    int client_socket_fd = -1;
-
-    client_socket_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    bool is_admitted = TryReserveTxQueueSpace(payload_bytes, false);
 
-    if(client_socket_fd < 0)
+    if(not is_admitted)
     {
-        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to open socket! Error code: {" + std::to_string(errno) +"}";
-        perror(error_message.c_str());
-        ExecuteErrorCallback(Error::SOCKET_OPEN_FAILURE,std::nullopt);
-        return false;
+        switch(m_options.tx_queue.full_policy)
+        {
+            case TxQueueFullPolicy::REJECT:
+                break;
+
+            case TxQueueFullPolicy::BLOCK:
+                // Waiting on the TX consumer's own thread would only wait for the timeout, since nothing makes room in the meantime
+                is_admitted = may_wait && not IsTxConsumerThread() && WaitForTxQueueSpace(payload_bytes);
+                break;
+
+            case TxQueueFullPolicy::DROP_OLDEST:
+                DropOldestTxPayloads(payload_bytes);
+                is_admitted = true;
+                break;
+        }
     }
 
-    m_client_file_descriptor = client_socket_fd;
-    return true;
+    ReportTxWatermarkCrossing();
+
+    return is_admitted;
 }
 
-bool ApplicationClient::Connect()
+bool ApplicationClient::TryReserveTxQueueSpace(size_t payload_bytes, bool is_forced)
 {
-    bool result = false;
+    const TxQueueOptions& tx_queue_options = m_options.tx_queue;
 
-    if(m_endpoint.socket_mode == SocketMode::TCP_IPV4)
+    size_t queued_payloads = m_tx_queued_payloads.load();
+
+    do
+    {
+        if(not is_forced && tx_queue_options.max_payloads > 0 && queued_payloads >= tx_queue_options.max_payloads)
+        {
+            return false;
+        }
+    }
+    while(not m_tx_queued_payloads.compare_exchange_weak(queued_payloads, queued_payloads + 1));
+
+    uint64_t queued_bytes_state = m_tx_queued_bytes.load();
+    uint64_t reserved_bytes_state = 0;
+
+    do
+    {
+        const uint64_t queued_bytes = queued_bytes_state & ~TX_QUEUE_ABOVE_HIGH_WATERMARK;
+
+        if(not is_forced && tx_queue_options.max_bytes > 0 && queued_bytes > 0 && queued_bytes + payload_bytes > tx_queue_options.max_bytes)
+        {
+            // Hand the payload slot back, a producer waiting for one may be able to use it
+            --m_tx_queued_payloads;
+            WakeTxQueueSpaceWaiters();
+            return false;
+        }
+
+        reserved_bytes_state = queued_bytes_state + payload_bytes;
+
+        if(tx_queue_options.high_watermark_bytes > 0 && queued_bytes + payload_bytes >= tx_queue_options.high_watermark_bytes)
+        {
+            reserved_bytes_state |= TX_QUEUE_ABOVE_HIGH_WATERMARK;
+        }
+    }
+    while(not m_tx_queued_bytes.compare_exchange_weak(queued_bytes_state, reserved_bytes_state));
+
+    return true;
+}
+
+void ApplicationClient::ReleaseTxQueueSpace(size_t payload_bytes)
+{
+    --m_tx_queued_payloads;
+
+    uint64_t queued_bytes_state = m_tx_queued_bytes.load();
+    uint64_t released_bytes_state = 0;
+
+    do
+    {
+        released_bytes_state = queued_bytes_state - payload_bytes;
+
+        if((released_bytes_state & ~TX_QUEUE_ABOVE_HIGH_WATERMARK) <= m_options.tx_queue.low_watermark_bytes)
+        {
+            released_bytes_state &= ~TX_QUEUE_ABOVE_HIGH_WATERMARK;
+        }
+    }
+    while(not m_tx_queued_bytes.compare_exchange_weak(queued_bytes_state, released_bytes_state));
+}
+
+bool ApplicationClient::WaitForTxQueueSpace(size_t payload_bytes)
+{
+    std::unique_lock<std::mutex> lock(m_tx_queue_space_mutex);
+
+    // Registered before the first attempt under the lock, so that room made by the consumer from here on is either seen by the attempt or followed by a notification
+    ++m_tx_queue_space_waiters;
+
+    const bool is_reserved = m_tx_queue_space_condition.wait_for(lock, m_options.tx_queue.block_timeout, [&]()
+    {
+        return TryReserveTxQueueSpace(payload_bytes, false);
+    });
+
+    --m_tx_queue_space_waiters;
+
+    return is_reserved;
+}
+
+void ApplicationClient::DropOldestTxPayloads(size_t payload_bytes)
+{
+    std::lock_guard<std::mutex> lock(m_tx_queue_pop_mutex);
+
+    while(not TryReserveTxQueueSpace(payload_bytes, false))
+    {
+        std::optional<TxPayload> tx_payload;
+
+        // With TX lanes, the least important lane gives up its payloads first
+        for(size_t lane = m_tx_queues.size(); lane > 0 && not tx_payload.has_value(); --lane)
+        {
+            tx_payload = m_tx_queues[lane - 1].Pop();
+        }
+
+        // The queue can look empty while other producers are still pushing, in which case the payload is let in over the limit rather than waiting for them
+        if(not tx_payload.has_value())
+        {
+            TryReserveTxQueueSpace(payload_bytes, true);
+            return;
+        }
+
+        m_statistics.RecordDequeue();
+        ReleaseTxQueueSpace(tx_payload->bytes.size());
+
+        if(tx_payload->completion_callback)
+        {
+            m_tx_dropped_completions.push_back(TxCompletion{.callback = std::move(tx_payload->completion_callback), .is_sent = false});
+        }
+    }
+}
+
+void ApplicationClient::WakeTxQueueSpaceWaiters()
+{
+    if(m_tx_queue_space_waiters > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_tx_queue_space_mutex);
+        m_tx_queue_space_condition.notify_all();
+    }
+}
+
+void ApplicationClient::ReportTxWatermarkCrossing()
+{
+    // Every thread that moves the queued bytes checks afterwards, so the last crossing is always reported even when crossings race each other
+    const auto is_above_high_watermark = [this]()
+    {
+        return (m_tx_queued_bytes.load() & TX_QUEUE_ABOVE_HIGH_WATERMARK) != 0;
+    };
+
+    if(is_above_high_watermark() == m_tx_reported_above_high_watermark)
+    {
+        return;
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(m_tx_watermark_callback_mutex);
+
+    const bool is_above = is_above_high_watermark();
+
+    if(is_above == m_tx_reported_above_high_watermark)
+    {
+        return;
+    }
+
+    m_tx_reported_above_high_watermark = is_above;
+
+    if(is_above)
+    {
+        m_tx_high_watermark_callback();
+    }
+    else
+    {
+        m_tx_low_watermark_callback();
+    }
+}
+
+void ApplicationClient::SignalTxConsumer()
+{
+    if(m_reactor != nullptr)
+    {
+        // One pending flush drains everything that is queued by the time it runs
+        if(not m_reactor_tx_flush_posted.exchange(true))
+        {
+            m_reactor->Post(m_reactor_event_loop, [this](){ FlushReactorTxPayloads(); });
+        }
+
+        return;
+    }
+
+    // Signal the TX sender thread to resume
+    m_process_tx_payloads_semaphore.release();
+}
+
+void ApplicationClient::ClearOutboundPayloads()
+{
+    ++m_tx_clear_generation;
+
+    // The consumer owns the queued payloads, so it is the one that discards them
+    SignalTxConsumer();
+}
+
+ApplicationClient::ConnectAwaitable ApplicationClient::Connect()
+{
+    return ConnectAwaitable(*this);
+}
+
+ApplicationClient::SendAwaitable ApplicationClient::Send(std::span<const char> tx_bytes, size_t lane)
+{
+    return SendAwaitable(*this, CreateBorrowedTxPayload(tx_bytes), lane);
+}
+
+ApplicationClient::SendAwaitable ApplicationClient::Send(std::vector<char>&& tx_bytes, size_t lane)
+{
+    return SendAwaitable(*this, CreateTxPayload(std::move(tx_bytes), nullptr), lane);
+}
+
+ApplicationClient::SendAwaitable ApplicationClient::Send(SharedPayload tx_bytes, size_t lane)
+{
+    return SendAwaitable(*this, CreateTxPayload(std::move(tx_bytes), nullptr), lane);
+}
+
+ApplicationClient::ReceiveAwaitable ApplicationClient::Receive()
+{
+    return ReceiveAwaitable(*this);
+}
+
+bool ApplicationClient::AwaitConnection(ConnectAwaitable& awaitable)
+{
+    m_rx_awaited = true;
+
+    {
+        std::lock_guard<std::mutex> lock(m_connect_awaiters_mutex);
+
+        if(GetClientState() == ClientState::CONNECTED)
+        {
+            awaitable.m_is_connected = true;
+            return false;
+        }
+
+        // Registered ahead of the request, so that an attempt that ends right away still resumes the coroutine
+        m_connect_awaiters.push_back(&awaitable);
+    }
+
+    if(RequestOpen())
+    {
+        return true;
+    }
+
+    const ClientState client_state = GetClientState();
+
+    if(client_state == ClientState::OPENING || client_state == ClientState::RECONNECTING)
+    {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(m_connect_awaiters_mutex);
+
+    const auto awaiter_iterator = std::find(m_connect_awaiters.begin(), m_connect_awaiters.end(), &awaitable);
+
+    // The coroutine was resumed by an attempt that ended in the meantime
+    if(awaiter_iterator == m_connect_awaiters.end())
+    {
+        return true;
+    }
+
+    m_connect_awaiters.erase(awaiter_iterator);
+    awaitable.m_is_connected = client_state == ClientState::CONNECTED;
+
+    return false;
+}
+
+void ApplicationClient::ResumeConnectAwaiters(bool is_connected)
+{
+    std::vector<ConnectAwaitable*> connect_awaiters;
+
+    {
+        std::lock_guard<std::mutex> lock(m_connect_awaiters_mutex);
+        connect_awaiters.swap(m_connect_awaiters);
+    }
+
+    for(ConnectAwaitable* connect_awaiter : connect_awaiters)
+    {
+        connect_awaiter->m_is_connected = is_connected;
+
+        // The state may change in the middle of the reactor's bookkeeping, so the coroutine runs once the event loop is done with it
+        if(m_reactor != nullptr)
+        {
+            m_reactor->Post(m_reactor_event_loop, [handle = connect_awaiter->m_handle]()
+            {
+                handle.resume();
+            });
+        }
+        else
+        {
+            connect_awaiter->m_handle.resume();
+        }
+    }
+}
+
+bool ApplicationClient::AwaitRxMessage(ReceiveAwaitable& awaitable)
+{
+    std::lock_guard<std::mutex> lock(m_rx_awaiters_mutex);
+
+    m_rx_awaited = true;
+
+    if(not m_rx_awaited_messages.empty())
+    {
+        awaitable.m_rx_message = std::move(m_rx_awaited_messages.front());
+        m_rx_awaited_messages.pop_front();
+        return false;
+    }
+
+    // The disconnection changes the state ahead of ending the waiting coroutines, so a coroutine that comes too late for that sees the state instead
+    if(GetClientState() != ClientState::CONNECTED)
+    {
+        awaitable.m_rx_message = RxMessage {};
+        return false;
+    }
+
+    m_rx_awaiters.push_back(&awaitable);
+
+    return true;
+}
+
+void ApplicationClient::DeliverAwaitedRxMessage(RxMessage&& rx_message)
+{
+    ReceiveAwaitable* rx_awaiter = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(m_rx_awaiters_mutex);
+
+        // Keeping the message retains its RX buffer, so the RX consumer reads into a fresh one until the message has been received
+        if(m_rx_awaiters.empty())
+        {
+            m_rx_awaited_messages.emplace_back(std::move(rx_message));
+            return;
+        }
+
+        rx_awaiter = m_rx_awaiters.front();
+        m_rx_awaiters.pop_front();
+    }
+
+    rx_awaiter->m_rx_message = std::move(rx_message);
+    rx_awaiter->m_handle.resume();
+}
+
+void ApplicationClient::EndAwaitedRxMessages()
+{
+    std::deque<ReceiveAwaitable*> rx_awaiters;
+
+    {
+        std::lock_guard<std::mutex> lock(m_rx_awaiters_mutex);
+        rx_awaiters.swap(m_rx_awaiters);
+    }
+
+    // An empty message tells the coroutines that the connection has ended
+    for(ReceiveAwaitable* rx_awaiter : rx_awaiters)
+    {
+        rx_awaiter->m_rx_message = RxMessage {};
+        rx_awaiter->m_handle.resume();
+    }
+}
+
+ClientStatistics ApplicationClient::GetStatistics() const
+{
+    ClientStatistics statistics = m_statistics.GetSnapshot();
+
+    if constexpr (ClientStatisticsRecorder::IS_COMPILED_IN)
+    {
+        const uint64_t connection_count = m_connection_generation.load();
+        statistics.reconnects = connection_count > 0 ? connection_count - 1 : 0;
+    }
+
+    return statistics;
+}
+
+size_t ApplicationClient::GetTxQueueDepth() const
+{
+    if(IsTxQueueAccounted())
+    {
+        return m_tx_queued_payloads.load();
+    }
+
+    return m_statistics.GetTxQueueDepth();
+}
+
+void ApplicationClient::JoinThreads()
+{
+    if(m_monitor_connection_thread.joinable())
+    {
+        m_monitor_connection_thread.join();
+    }
+    
+    if(m_process_rx_payloads_thread.joinable())
+    {
+        m_process_rx_payloads_thread.join();
+    }
+
+    if(m_process_tx_payloads_thread.joinable())
+    {
+        m_process_tx_payloads_thread.join();
+    }
+
+    m_worker_threads_started = false;
+}
+
+void ApplicationClient::SetMonitorWorkerThreadState(const WorkerThreadState &worker_thread_state)
+{
+    std::shared_lock lock(m_monitor_connection_thread_state_mutex);
+    m_monitor_connection_thread_state = worker_thread_state;
+}
+
+ApplicationClient::WorkerThreadState ApplicationClient::GetMonitorWorkerThreadState() const
+{
+    std::shared_lock lock(m_monitor_connection_thread_state_mutex);
+    return m_monitor_connection_thread_state;
+}
+
+void ApplicationClient::SignalMonitorWorkerThreadShutdown()
+{
+    SetMonitorWorkerThreadState(WorkerThreadState::ENDING);
+    SignalConnectCancel();
+    m_monitor_connection_semaphore.release();
+}
+
+void ApplicationClient::SetTxWorkerThreadState(const WorkerThreadState &worker_thread_state)
+{
+    std::shared_lock lock(m_process_tx_payloads_thread_state_mutex);
+    m_process_tx_payloads_thread_state = worker_thread_state;
+}
+
+ApplicationClient::WorkerThreadState ApplicationClient::GetTxWorkerThreadState() const
+{
+    std::shared_lock lock(m_process_tx_payloads_thread_state_mutex);
+    return m_process_tx_payloads_thread_state;
+}
+
+void ApplicationClient::SignalTxWorkerThreadShutdown()
+{
+    SetTxWorkerThreadState(WorkerThreadState::ENDING);
+    m_process_tx_payloads_semaphore.release();
+}
+
+void ApplicationClient::SetRxWorkerThreadState(const WorkerThreadState &worker_thread_state)
+{
+    std::shared_lock lock(m_process_rx_payloads_thread_state_mutex);
+    m_process_rx_payloads_thread_state = worker_thread_state;
+}
+
+ApplicationClient::WorkerThreadState ApplicationClient::GetRxWorkerThreadState() const
+{
+    std::shared_lock lock(m_process_rx_payloads_thread_state_mutex);
+    return m_process_rx_payloads_thread_state;
+}
+
+void ApplicationClient::SignalRxWorkerThreadShutdown()
+{
+    SetRxWorkerThreadState(WorkerThreadState::ENDING);
+
+    // Bumping the generation wakes an RX worker thread that is waiting for a connection. A decoder reset is harmless at this point.
+    ++m_connection_generation;
+    m_connection_generation.notify_all();
+}
+
+void ApplicationClient::ExecuteErrorCallback(const Error &error, const std::optional<std::span<char>> &tx_payload_opt)
+{
+    m_statistics.RecordError(error);
+
+    std::lock_guard<std::mutex> lock(m_error_callback_mutex);
+    m_error_callback(error, tx_payload_opt);
+}
+
+void ApplicationClient::ExecuteTxCompletions()
+{
+    // A completion callback may enqueue another payload, so the list being executed is kept apart from the one being recorded
+    m_tx_completions_executing.swap(m_tx_completions);
+
+    for(TxCompletion& tx_completion : m_tx_completions_executing)
+    {
+        tx_completion.callback(tx_completion.is_sent);
+    }
+
+    m_tx_completions_executing.clear();
+}
+
+void ApplicationClient::ExecuteDisconnectedCallback()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_disconnected_callback_mutex);
+        m_disconnected_callback();
+    }
+
+    EndAwaitedRxMessages();
+}
+
+void ApplicationClient::SetClientState(const ClientState &client_state)
+{
+    std::unique_lock lock(m_client_state_mutex);
+    m_client_state = client_state;
+
+    if(client_state == ClientState::CONNECTED)
+    {
+        // Resume the RX worker thread, which waits on the generation while the client is not connected
+        ++m_connection_generation;
+        m_connection_generation.notify_all();
+    }
+
+    lock.unlock();
+
+    // A connection attempt that ends without a connection resumes the coroutines that await it
+    if(client_state == ClientState::NOT_CONNECTED)
+    {
+        ResumeConnectAwaiters(false);
+    }
+}
+
+bool ApplicationClient::CompareAndSetClientState(ClientState expected_client_state, ClientState client_state)
+{
+    std::unique_lock lock(m_client_state_mutex);
+
+    if(m_client_state != expected_client_state)
+    {
+        return false;
+    }
+
+    m_client_state = client_state;
+
+    if(client_state == ClientState::CONNECTED)
+    {
+        ++m_connection_generation;
+        m_connection_generation.notify_all();
+    }
+
+    return true;
+}
+
+bool ApplicationClient::OpenConnection()
+{
+    // Ensure the file descriptors are cleaned up before opening a connection
+    shutdown(m_client_file_descriptor, SHUT_RDWR);
+    close(m_client_file_descriptor);
+
+    // A close request that arrives while connecting claims the state first, and the connection is dropped
+    if(OpenSocket() && ConnectSocket() && CompareAndSetClientState(ClientState::OPENING, ClientState::CONNECTED))
+    {
+        m_connected_callback();
+        ResumeConnectAwaiters(true);
+        return true;
+    }
+
+    return false;
+}
+
+bool ApplicationClient::OpenSocket()
+{
+    bool result = false;
+
+    if(m_endpoint.socket_mode == SocketMode::TCP_IPV4)
+    {
+        result = OpenTcpIpv4Socket();
+    }
+    else if(m_endpoint.socket_mode == SocketMode::UNIX_DOMAIN || m_endpoint.socket_mode == SocketMode::UNIX_SEQPACKET)
+    {
+        result = OpenUnixDomainSocket();
+    }
+    else if(m_endpoint.socket_mode == SocketMode::SHARED_MEMORY)
+    {
+        result = OpenSharedMemorySegment();
+    }
+
+    return result;
+}
+
+bool ApplicationClient::OpenTcpIpv4Socket()
+{
+    int client_socket_fd = -1;
+
+    client_socket_fd = socket(AF_INET, SOCK_STREAM, 0);
+
+    if(client_socket_fd < 0)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to open socket! Error code: {" + std::to_string(errno) +"}";
+        perror(error_message.c_str());
+        ExecuteErrorCallback(Error::SOCKET_OPEN_FAILURE,std::nullopt);
+        return false;
+    }
+
+    ApplySocketOptions(client_socket_fd);
+
+    // Kernels without MSG_ZEROCOPY support reject the option, and the connection then uses regular sends
+    if(m_options.zero_copy.enabled)
+    {
+        const int zero_copy = 1;
+        m_zero_copy_socket = setsockopt(client_socket_fd, SOL_SOCKET, SO_ZEROCOPY, &zero_copy, sizeof(zero_copy)) == 0;
+    }
+
+    m_client_file_descriptor = client_socket_fd;
+    return true;
+}
+
+bool ApplicationClient::OpenUnixDomainSocket()
+{
+    int client_socket_fd = -1;
+
+    client_socket_fd = socket(AF_UNIX, m_endpoint.socket_mode == SocketMode::UNIX_SEQPACKET ? SOCK_SEQPACKET : SOCK_STREAM, 0);
+
+    if(client_socket_fd < 0)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to open socket! Error code: {" + std::to_string(errno) +"}";
+        perror(error_message.c_str());
+        ExecuteErrorCallback(Error::SOCKET_OPEN_FAILURE,std::nullopt);
+        return false;
+    }
+
+    ApplySocketOptions(client_socket_fd);
+
+    m_client_file_descriptor = client_socket_fd;
+    return true;
+}
+
+bool ApplicationClient::OpenSharedMemorySegment()
+{
+    const int segment_file_descriptor = shm_open(m_endpoint.shared_memory_name.c_str(), O_RDWR | O_CLOEXEC, 0);
+
+    // A segment that the peer has not created (yet) is the counterpart of a socket path that nobody listens on
+    if(segment_file_descriptor < 0)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to open shared memory segment: {" + m_endpoint.shared_memory_name + "}";
+        perror(error_message.c_str());
+        ExecuteErrorCallback(Error::SOCKET_CONNECT_FAILURE, std::nullopt);
+        return false;
+    }
+
+    m_client_file_descriptor = segment_file_descriptor;
+    return true;
+}
+
+void ApplicationClient::ApplySocketOptions(int socket_file_descriptor)
+{
+    const SocketOptions& socket_options = m_options.socket;
+
+    if(socket_options.send_buffer_size > 0)
+    {
+        SetSocketOption(socket_file_descriptor, SOL_SOCKET, SO_SNDBUF, socket_options.send_buffer_size, "SO_SNDBUF");
+    }
+
+    if(socket_options.receive_buffer_size > 0)
+    {
+        SetSocketOption(socket_file_descriptor, SOL_SOCKET, SO_RCVBUF, socket_options.receive_buffer_size, "SO_RCVBUF");
+    }
+
+    if(socket_options.busy_poll_microseconds > 0)
+    {
+        SetSocketOption(socket_file_descriptor, SOL_SOCKET, SO_BUSY_POLL, socket_options.busy_poll_microseconds, "SO_BUSY_POLL");
+    }
+
+    if(socket_options.priority > 0)
+    {
+        SetSocketOption(socket_file_descriptor, SOL_SOCKET, SO_PRIORITY, socket_options.priority, "SO_PRIORITY");
+    }
+
+    if(m_endpoint.socket_mode != SocketMode::TCP_IPV4)
+    {
+        return;
+    }
+
+    // Batches are already coalesced by the client, so Nagle's algorithm would only hold back the tail of each batch waiting for an ACK
+    if(socket_options.tcp_no_delay || m_options.tx_batch.enabled)
+    {
+        SetSocketOption(socket_file_descriptor, IPPROTO_TCP, TCP_NODELAY, 1, "TCP_NODELAY");
+    }
+
+    if(socket_options.tcp_quick_ack)
+    {
+        SetSocketOption(socket_file_descriptor, IPPROTO_TCP, TCP_QUICKACK, 1, "TCP_QUICKACK");
+    }
+
+    if(socket_options.tcp_not_sent_low_watermark > 0)
+    {
+        SetSocketOption(socket_file_descriptor, IPPROTO_TCP, TCP_NOTSENT_LOWAT, socket_options.tcp_not_sent_low_watermark, "TCP_NOTSENT_LOWAT");
+    }
+
+    if(socket_options.keep_alive)
+    {
+        SetSocketOption(socket_file_descriptor, SOL_SOCKET, SO_KEEPALIVE, 1, "SO_KEEPALIVE");
+
+        if(socket_options.keep_alive_idle.count() > 0)
+        {
+            SetSocketOption(socket_file_descriptor, IPPROTO_TCP, TCP_KEEPIDLE, socket_options.keep_alive_idle.count(), "TCP_KEEPIDLE");
+        }
+
+        if(socket_options.keep_alive_interval.count() > 0)
+        {
+            SetSocketOption(socket_file_descriptor, IPPROTO_TCP, TCP_KEEPINTVL, socket_options.keep_alive_interval.count(), "TCP_KEEPINTVL");
+        }
+
+        if(socket_options.keep_alive_probes > 0)
+        {
+            SetSocketOption(socket_file_descriptor, IPPROTO_TCP, TCP_KEEPCNT, socket_options.keep_alive_probes, "TCP_KEEPCNT");
+        }
+    }
+}
+
+void ApplicationClient::SetSocketOption(int socket_file_descriptor, int level, int option_name, int option_value, const std::string& option_label) const
+{
+    if(setsockopt(socket_file_descriptor, level, option_name, &option_value, sizeof(option_value)) < 0)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to set " + option_label + ", continuing without it";
+        perror(error_message.c_str());
+    }
+}
+
+void ApplicationClient::RearmTcpQuickAck()
+{
+    if(m_options.socket.tcp_quick_ack && m_endpoint.socket_mode == SocketMode::TCP_IPV4)
+    {
+        const int quick_ack = 1;
+        setsockopt(m_client_file_descriptor, IPPROTO_TCP, TCP_QUICKACK, &quick_ack, sizeof(quick_ack));
+    }
+}
+
+bool ApplicationClient::ConnectSocket()
+{
+    bool result = false;
+
+    if(m_endpoint.socket_mode == SocketMode::TCP_IPV4)
     {
         result = ConnectToTcpIpv4Address();
     }
-    else if(m_endpoint.socket_mode == SocketMode::UNIX_DOMAIN)
+    else if(m_endpoint.socket_mode == SocketMode::UNIX_DOMAIN || m_endpoint.socket_mode == SocketMode::UNIX_SEQPACKET)
+    {
+        result = ConnectToUnixDomainSocketAddress();
+    }
+    else if(m_endpoint.socket_mode == SocketMode::SHARED_MEMORY)
+    {
+        result = ConnectToSharedMemorySegment();
+    }
+
+    return result;
+}
+
+bool ApplicationClient::ConnectToTcpIpv4Address()
+{
+    sockaddr_in server_address {};
+    server_address.sin_family = AF_INET;
+    server_address.sin_port = htons(m_endpoint.port); // Server port
+    inet_pton(AF_INET, m_endpoint.ip_address.c_str(), &server_address.sin_addr); // Server IP
+
+    // The worker threads connect without blocking as well, so that the attempt can time out or be cancelled, and then switch the socket back to blocking
+    const bool is_worker_connect = m_reactor == nullptr;
+    const int file_status_flags = fcntl(m_client_file_descriptor, F_GETFL, 0);
+
+    if(is_worker_connect)
+    {
+        fcntl(m_client_file_descriptor, F_SETFL, file_status_flags | O_NONBLOCK);
+    }
+
+    int connect_error = connect(m_client_file_descriptor, (struct sockaddr*)&server_address, sizeof(server_address)) < 0 ? errno : 0;
+
+    if(connect_error == EINPROGRESS)
+    {
+        // A non-blocking socket (reactor mode) completes the connection asynchronously
+        connect_error = is_worker_connect ? WaitForConnection() : 0;
+    }
+
+    if(is_worker_connect)
+    {
+        fcntl(m_client_file_descriptor, F_SETFL, file_status_flags);
+    }
+
+    // A cancelled attempt is not a failure
+    if(connect_error == ECANCELED)
+    {
+        return false;
+    }
+
+    if(connect_error != 0)
+    {
+        errno = connect_error;
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to connect to address: {"+m_endpoint.ip_address+":"+std::to_string(m_endpoint.port)+"}";
+        perror(error_message.c_str());
+        ExecuteErrorCallback(Error::SOCKET_CONNECT_FAILURE, std::nullopt);
+        return false;
+    }
+
+    return true;
+}
+
+int ApplicationClient::WaitForConnection()
+{
+    const std::chrono::milliseconds timeout = m_options.connect.timeout;
+    const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + timeout;
+
+    // poll() skips the cancellation event when it could not be created, since its descriptor is negative
+    pollfd poll_file_descriptors[2] {};
+    poll_file_descriptors[0].fd = m_client_file_descriptor;
+    poll_file_descriptors[0].events = POLLOUT;
+    poll_file_descriptors[1].fd = m_connect_cancel_file_descriptor;
+    poll_file_descriptors[1].events = POLLIN;
+
+    while(true)
+    {
+        int poll_timeout = -1;
+
+        if(timeout.count() > 0)
+        {
+            const std::chrono::milliseconds remaining_time = std::chrono::ceil<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+
+            if(remaining_time.count() <= 0)
+            {
+                return ETIMEDOUT;
+            }
+
+            poll_timeout = static_cast<int>(std::min<int64_t>(remaining_time.count(), INT_MAX));
+        }
+
+        if(poll(poll_file_descriptors, 2, poll_timeout) < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+
+            return errno;
+        }
+
+        if(poll_file_descriptors[1].revents & POLLIN)
+        {
+            uint64_t cancel_count = 0;
+            (void)read(m_connect_cancel_file_descriptor, &cancel_count, sizeof(cancel_count));
+
+            // A cancellation can arrive just after the attempt it was meant for has ended, so only the current state decides
+            if(IsConnectCancelled())
+            {
+                return ECANCELED;
+            }
+        }
+
+        // The socket becomes writable once the connection attempt has completed, successfully or not
+        if(poll_file_descriptors[0].revents != 0)
+        {
+            int socket_error = 0;
+            socklen_t socket_error_length = sizeof(socket_error);
+
+            getsockopt(m_client_file_descriptor, SOL_SOCKET, SO_ERROR, &socket_error, &socket_error_length);
+
+            return socket_error;
+        }
+    }
+}
+
+void ApplicationClient::SignalConnectCancel()
+{
+    if(m_connect_cancel_file_descriptor >= 0)
+    {
+        const uint64_t cancel_count = 1;
+        (void)write(m_connect_cancel_file_descriptor, &cancel_count, sizeof(cancel_count));
+    }
+}
+
+bool ApplicationClient::IsConnectCancelled() const
+{
+    return GetClientState() == ClientState::CLOSING || GetMonitorWorkerThreadState() == WorkerThreadState::ENDING;
+}
+
+bool ApplicationClient::ConnectToUnixDomainSocketAddress()
+{
+    sockaddr_un server_address {};
+    server_address.sun_family = AF_UNIX;
+    strncpy(server_address.sun_path, m_endpoint.unix_socket_path.c_str(), sizeof(server_address.sun_path) - 1); // server unix domain socket path
+
+    if (connect(m_client_file_descriptor, (struct sockaddr*)&server_address, sizeof(server_address)) < 0 && not (m_reactor != nullptr && errno == EINPROGRESS)) 
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to connect to address: {"+m_endpoint.unix_socket_path+"}";
+        perror(error_message.c_str());
+        ExecuteErrorCallback(Error::SOCKET_CONNECT_FAILURE, std::nullopt);
+        return false;
+    }
+
+    return true;
+}
+
+bool ApplicationClient::ConnectToSharedMemorySegment()
+{
+    std::shared_ptr<SharedMemoryChannel> channel = SharedMemoryChannel::Open(m_client_file_descriptor, SharedMemoryChannel::Side::CLIENT, m_options.shared_memory.busy_wait_microseconds);
+
+    if(channel == nullptr || not channel->Attach())
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to attach to shared memory segment: {" + m_endpoint.shared_memory_name + "}";
+        std::cerr << error_message << "\n";
+        ExecuteErrorCallback(Error::SOCKET_CONNECT_FAILURE, std::nullopt);
+        return false;
+    }
+
+    m_shared_memory_channel.store(std::move(channel));
+    return true;
+}
+
+void ApplicationClient::CloseSharedMemoryChannel()
+{
+    // Closing the session wakes the worker threads that wait on its rings, the way shutting a socket down wakes a blocked recv()
+    if(const std::shared_ptr<SharedMemoryChannel> channel = m_shared_memory_channel.exchange(nullptr))
+    {
+        channel->Close();
+    }
+}
+
+SharedMemoryChannel* ApplicationClient::GetWorkerSharedMemoryChannel(std::shared_ptr<SharedMemoryChannel>& worker_channel) const
+{
+    // A worker thread keeps its segment until the session on it has ended, and only then picks up the current one
+    if(worker_channel == nullptr || worker_channel->IsClosed())
+    {
+        worker_channel = m_shared_memory_channel.load();
+    }
+
+    return worker_channel.get();
+}
+
+void ApplicationClient::CloseSocket(ClientState closed_client_state)
+{
+    if(m_endpoint.socket_mode == SocketMode::SHARED_MEMORY)
+    {
+        CloseSharedMemoryChannel();
+    }
+
+    // Forget the descriptor once it is closed so that a later close cannot hit a descriptor number that was reused elsewhere in the process
+    const int client_file_descriptor = m_client_file_descriptor.exchange(DEFAULT_FILE_DESCRIPTOR);
+    shutdown(client_file_descriptor, SHUT_RDWR);
+    close(client_file_descriptor);
+    SetClientState(closed_client_state);
+}
+
+bool ApplicationClient::IsConnectionLostError(int error_number)
+{
+    return error_number == EPIPE || error_number == ECONNRESET || error_number == ENOTCONN || error_number == ETIMEDOUT || error_number == EHOSTUNREACH || error_number == ENETUNREACH;
+}
+
+void ApplicationClient::LoseConnection()
+{
+    // The RX and TX worker threads can both notice the loss, and only the first one handles it
+    if(not CompareAndSetClientState(ClientState::CONNECTED, ClientState::CLOSING))
+    {
+        return;
+    }
+
+    if(not m_options.reconnect.enabled)
+    {
+        CloseSocket();
+        ExecuteDisconnectedCallback();
+        return;
+    }
+
+    BeginReconnecting();
+    CloseSocket(ClientState::RECONNECTING);
+    ExecuteDisconnectedCallback();
+
+    // The connection monitor thread waits out the backoff and reconnects
+    m_monitor_connection_semaphore.release();
+}
+
+void ApplicationClient::BeginReconnecting()
+{
+    m_reconnect_attempt = 0;
+    m_connection_lost_time = std::chrono::steady_clock::now();
+    m_reconnecting = true;
+}
+
+void ApplicationClient::EndReconnecting(bool is_reconnected)
+{
+    if(is_reconnected)
+    {
+        m_statistics.RecordReconnected(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_connection_lost_time).count());
+    }
+
+    m_reconnecting = false;
+
+    // The TX consumer kept its payloads while reconnecting. They are sent now, or fail if the client stays disconnected.
+    SignalTxConsumer();
+}
+
+std::chrono::milliseconds ApplicationClient::GetReconnectDelay()
+{
+    const ReconnectOptions& reconnect_options = m_options.reconnect;
+
+    // The exponent is capped so that the backoff can not overflow before the delay is clamped
+    const double backoff = std::pow(std::max(reconnect_options.multiplier, 1.0), static_cast<double>(std::min<size_t>(m_reconnect_attempt, 64)));
+    const double delay = std::min(static_cast<double>(reconnect_options.initial_delay.count()) * backoff, static_cast<double>(reconnect_options.max_delay.count()));
+    const double jitter = std::clamp(reconnect_options.jitter, 0.0, 1.0);
+
+    std::uniform_real_distribution<double> jitter_distribution(1.0 - jitter, 1.0 + jitter);
+
+    return std::chrono::milliseconds(static_cast<int64_t>(delay * jitter_distribution(m_reconnect_random_engine)));
+}
+
+void ApplicationClient::MonitorConnection()
+{
+    SetMonitorWorkerThreadState(WorkerThreadState::RUNNING);
+
+    while(GetMonitorWorkerThreadState() != WorkerThreadState::ENDING)
+    {
+        /*
+            Wait here for the following events:
+                1. Open the socket and connect
+                2. Close the socket
+                3. The worker thread is being signaled to shutdown
+        */
+        m_monitor_connection_semaphore.acquire();
+
+        if(GetMonitorWorkerThreadState() == WorkerThreadState::ENDING)
+        {
+            break;
+        }
+
+        if(GetClientState() == ClientState::OPENING)
+        {
+            // If the connection is succesful then the client state will transition to CONNECTED, which happens inside OpenConnection()
+            if(not OpenConnection())
+            {
+                // If opening a connection fails, then close the file descriptor and transition back to the NOT_CONNECTED state, which happens inside CloseSocket()
+                CloseSocket();
+            }
+
+            // Payloads enqueued during the attempt waited for it to end, and are sent now or fail if the client stays disconnected
+            SignalTxConsumer();
+        }
+        else if(GetClientState() == ClientState::RECONNECTING)
+        {
+            ReconnectLostConnection();
+        }
+        else if(GetClientState() == ClientState::CLOSING)
+        {
+            // A close request that cancelled an attempt before it began leaves no socket behind, and there was no connection to report as closed
+            const bool is_connected = m_client_file_descriptor != DEFAULT_FILE_DESCRIPTOR;
+
+            CloseSocket();
+
+            // The disconnected callback already ran when the connection was lost
+            if(m_reconnecting)
+            {
+                EndReconnecting(false);
+            }
+            else if(is_connected)
+            {
+                ExecuteDisconnectedCallback();
+            }
+        }
+    }
+
+    CloseSocket();
+
+    SetMonitorWorkerThreadState(WorkerThreadState::INACTIVE);
+}
+
+void ApplicationClient::ReconnectLostConnection()
+{
+    const size_t max_attempts = m_options.reconnect.max_attempts;
+
+    while(max_attempts == 0 || m_reconnect_attempt < max_attempts)
+    {
+        // A close request or a shutdown signals the semaphore, which ends the backoff early
+        (void)m_monitor_connection_semaphore.try_acquire_for(GetReconnectDelay());
+
+        if(GetMonitorWorkerThreadState() == WorkerThreadState::ENDING)
+        {
+            return;
+        }
+
+        // Claiming the state keeps a close request from being overwritten by the attempt
+        if(not CompareAndSetClientState(ClientState::RECONNECTING, ClientState::OPENING))
+        {
+            CloseSocket();
+            EndReconnecting(false);
+            return;
+        }
+
+        ++m_reconnect_attempt;
+        m_statistics.RecordReconnectAttempt();
+
+        if(OpenConnection())
+        {
+            EndReconnecting(true);
+            return;
+        }
+
+        // A close request cancelled the attempt
+        if(not CompareAndSetClientState(ClientState::OPENING, ClientState::RECONNECTING))
+        {
+            CloseSocket();
+            EndReconnecting(false);
+            return;
+        }
+
+        CloseSocket(ClientState::RECONNECTING);
+    }
+
+    CloseSocket();
+    EndReconnecting(false);
+    ExecuteErrorCallback(Error::RECONNECT_FAILURE, std::nullopt);
+}
+
+void ApplicationClient::ProcessTxPayloads()
+{
+    SetTxWorkerThreadState(WorkerThreadState::RUNNING);
+
+    while(GetTxWorkerThreadState() != WorkerThreadState::ENDING)
+    {
+        /* Wait here until signaled to resume: This happens in the following cases:
+            1. The TX payload queue is no longer empty
+            2. This worker thread is being told to shut down
+        */
+        if(not HasUnreportedTxZeroCopySends())
+        {
+            m_process_tx_payloads_semaphore.acquire();
+        }
+        else if(not m_process_tx_payloads_semaphore.try_acquire_for(ZERO_COPY_REPORT_POLL_INTERVAL))
+        {
+            // The kernel reports zero-copy sends through the socket's error queue, which does not wake this thread
+            ReapTxZeroCopyReports();
+            continue;
+        }
+
+        if(GetTxWorkerThreadState() == WorkerThreadState::ENDING)
+        {
+            break;
+        }
+
+        PullTxPayloads();
+
+        // While reconnecting, the payloads wait for the new connection instead of failing on the lost one
+        while(not m_tx_in_flight.empty() && not m_reconnecting)
+        {
+            // A peer that has gone away has to show up as EPIPE rather than as a SIGPIPE that ends the process
+            const TxResult tx_result = SendNextPayloads(MSG_NOSIGNAL);
+
+            if(tx_result == TxResult::CONNECTION_LOST)
+            {
+                LoseConnection();
+            }
+            else if(tx_result == TxResult::WOULD_BLOCK)
+            {
+                // Only a connection attempt in progress leaves the socket non-blocking. The payloads wait for it to end, which signals this thread again.
+                break;
+            }
+
+            ExecuteTxCompletions();
+            PullTxPayloads();
+        }
+
+        // Payloads that were dropped by ClearOutboundPayloads() still need to be reported
+        ExecuteTxCompletions();
+    }
+
+    SetTxWorkerThreadState(WorkerThreadState::INACTIVE);
+}
+
+ApplicationClient::TxResult ApplicationClient::SendNextPayloads(int flags)
+{
+    ReapTxZeroCopyReports();
+
+    const size_t batch_bytes = GatherTxPayloads();
+    const bool is_zero_copy = IsTxZeroCopyEligible(batch_bytes);
+
+    m_tx_message = msghdr {};
+    m_tx_message.msg_iov = m_tx_iovecs.data();
+    m_tx_message.msg_iovlen = m_tx_iovecs.size();
+    AttachTxMemfds(m_tx_message);
+
+    ssize_t sent_bytes = 0;
+
+    if(m_endpoint.socket_mode == SocketMode::SHARED_MEMORY)
+    {
+        sent_bytes = SendSharedMemoryBytes(flags);
+    }
+    else if(m_endpoint.socket_mode == SocketMode::UNIX_SEQPACKET)
+    {
+        sent_bytes = SendTxMessages(flags);
+    }
+    else
+    {
+        sent_bytes = sendmsg(m_client_file_descriptor, &m_tx_message, is_zero_copy ? (flags | MSG_ZEROCOPY) : flags);
+    }
+
+    m_statistics.RecordSend(batch_bytes, sent_bytes);
+
+    // The descriptors go with the first byte that is sent, however little of the batch that is
+    if(sent_bytes > 0)
+    {
+        MarkTxMemfdsPassed();
+    }
+
+    // The kernel only numbers zero-copy sends that accepted at least one byte
+    if(is_zero_copy && sent_bytes > 0)
+    {
+        MarkTxZeroCopyPayloads(sent_bytes);
+    }
+
+    return CompleteTxSend(sent_bytes);
+}
+
+ApplicationClient::TxResult ApplicationClient::CompleteTxSend(ssize_t sent_bytes)
+{
+    if(sent_bytes < 0)
+    {
+        if(errno == EINTR)
+        {
+            return TxResult::SENT;
+        }
+
+        // The caller decides when to retry, for example once the socket becomes writable again
+        if(errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+            return TxResult::WOULD_BLOCK;
+        }
+
+        // The caller hands the connection over to reconnecting, which keeps the payload
+        if(m_options.reconnect.enabled && (m_reconnecting || IsConnectionLostError(errno)))
+        {
+            return TxResult::CONNECTION_LOST;
+        }
+
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to send payload!";
+        perror(error_message.c_str());
+        FailFrontTxPayload();
+        return TxResult::FAILED;
+    }
+
+    // A partial write leaves the unsent remainder at the front of the queue for the next call
+    ConsumeSentBytes(sent_bytes);
+
+    return TxResult::SENT;
+}
+
+size_t ApplicationClient::GetTxBatchPayloadLimit() const
+{
+    if(not m_options.tx_batch.enabled)
+    {
+        return 1;
+    }
+
+    // A framed payload (or a lane chunk) takes up two iovecs, one for its header and one for its bytes
+    const size_t max_payloads = m_framing_enabled || m_options.tx_lanes.enabled ? IOV_MAX / 2 : IOV_MAX;
+
+    return std::clamp<size_t>(m_options.tx_batch.max_payloads, 1, max_payloads);
+}
+
+void ApplicationClient::PullTxPayloads()
+{
+    const uint64_t clear_generation = m_tx_clear_generation.load();
+
+    if(clear_generation != m_tx_applied_clear_generation)
+    {
+        DropStaleTxPayloads(clear_generation);
+        m_tx_applied_clear_generation = clear_generation;
+    }
+
+    const bool is_tx_queue_accounted = IsTxQueueAccounted();
+    std::unique_lock<std::mutex> pop_lock(m_tx_queue_pop_mutex, std::defer_lock);
+
+    if(is_tx_queue_accounted && m_options.tx_queue.full_policy == TxQueueFullPolicy::DROP_OLDEST)
+    {
+        pop_lock.lock();
+
+        for(TxCompletion& tx_completion : m_tx_dropped_completions)
+        {
+            m_tx_completions.emplace_back(std::move(tx_completion));
+        }
+
+        m_tx_dropped_completions.clear();
+    }
+
+    m_statistics.RecordTxQueueDrain();
+
+    if(m_options.tx_lanes.enabled)
+    {
+        ScheduleTxLaneChunks(clear_generation, is_tx_queue_accounted);
+    }
+    else
+    {
+        const size_t batch_payload_limit = GetTxBatchPayloadLimit();
+
+        while(m_tx_in_flight.size() < batch_payload_limit)
+        {
+            std::optional<TxPayload> tx_payload = PopTxPayload(0, clear_generation, is_tx_queue_accounted);
+
+            if(not tx_payload.has_value())
+            {
+                break;
+            }
+
+            m_tx_in_flight.emplace_back(std::move(tx_payload.value()));
+        }
+    }
+
+    if(is_tx_queue_accounted)
+    {
+        // A watermark callback may enqueue a payload, which can take the pop lock
+        if(pop_lock.owns_lock())
+        {
+            pop_lock.unlock();
+        }
+
+        WakeTxQueueSpaceWaiters();
+        ReportTxWatermarkCrossing();
+    }
+}
+
+std::optional<ApplicationClient::TxPayload> ApplicationClient::PopTxPayload(size_t lane, uint64_t clear_generation, bool is_tx_queue_accounted)
+{
+    while(true)
+    {
+        std::optional<TxPayload> tx_payload = m_tx_queues[lane].Pop();
+
+        if(not tx_payload.has_value())
+        {
+            return std::nullopt;
+        }
+
+        m_statistics.RecordDequeue();
+
+        if(is_tx_queue_accounted)
+        {
+            ReleaseTxQueueSpace(tx_payload->bytes.size());
+        }
+
+        if(tx_payload->clear_generation >= clear_generation)
+        {
+            return tx_payload;
+        }
+
+        if(tx_payload->completion_callback)
+        {
+            m_tx_completions.push_back(TxCompletion{.callback = std::move(tx_payload->completion_callback), .is_sent = false});
+        }
+    }
+}
+
+void ApplicationClient::DropStaleTxPayloads(uint64_t clear_generation)
+{
+    // A partially sent payload has to be completed, otherwise the peer would receive a truncated payload followed by the next one
+    const size_t first_droppable_index = m_tx_payload_offset > 0 ? 1 : 0;
+
+    std::deque<TxPayload> retained_payloads;
+
+    for(size_t index = 0; index < m_tx_in_flight.size(); ++index)
+    {
+        TxPayload& tx_payload = m_tx_in_flight[index];
+
+        // The remaining chunks of a payload that has started to go out are kept for the same reason
+        if(index < first_droppable_index || tx_payload.is_lane_chunk || tx_payload.clear_generation >= clear_generation)
+        {
+            retained_payloads.emplace_back(std::move(tx_payload));
+        }
+        else if(tx_payload.completion_callback)
+        {
+            m_tx_completions.push_back(TxCompletion{.callback = std::move(tx_payload.completion_callback), .is_sent = false});
+        }
+    }
+
+    m_tx_in_flight.swap(retained_payloads);
+
+    for(TxLane& tx_lane : m_tx_lanes)
+    {
+        if(tx_lane.payload.has_value() && tx_lane.cut_bytes == 0 && tx_lane.payload->clear_generation < clear_generation)
+        {
+            CompleteTxPayload(*tx_lane.payload, false);
+            tx_lane.payload.reset();
+        }
+    }
+}
+
+size_t ApplicationClient::GetTxLaneCount(const TxLaneOptions& options)
+{
+    return options.enabled ? std::clamp<size_t>(options.lane_count, 1, MAX_TX_LANES) : 1;
+}
+
+size_t ApplicationClient::GetTxLaneChunkSize() const
+{
+    return std::clamp<size_t>(m_options.tx_lanes.chunk_size, 1, MAX_CHUNK_SIZE);
+}
+
+void ApplicationClient::ScheduleTxLaneChunks(uint64_t clear_generation, bool is_tx_queue_accounted)
+{
+    const size_t batch_payload_limit = GetTxBatchPayloadLimit();
+
+    while(m_tx_in_flight.size() < batch_payload_limit)
+    {
+        const std::optional<size_t> lane = SelectTxLane(clear_generation, is_tx_queue_accounted);
+
+        if(not lane.has_value())
+        {
+            break;
+        }
+
+        CutTxLaneChunk(lane.value());
+    }
+}
+
+bool ApplicationClient::HasTxLaneChunk(size_t lane, uint64_t clear_generation, bool is_tx_queue_accounted)
+{
+    TxLane& tx_lane = m_tx_lanes[lane];
+
+    // A lane does not move on to its next payload before the last chunk of the current one has been sent
+    if(tx_lane.payload.has_value())
+    {
+        return tx_lane.cut_bytes < tx_lane.payload->bytes.size();
+    }
+
+    tx_lane.payload = PopTxPayload(lane, clear_generation, is_tx_queue_accounted);
+    tx_lane.cut_bytes = 0;
+    tx_lane.sent_bytes = 0;
+
+    return tx_lane.payload.has_value();
+}
+
+std::optional<size_t> ApplicationClient::SelectTxLane(uint64_t clear_generation, bool is_tx_queue_accounted)
+{
+    const size_t lane_count = m_tx_lanes.size();
+
+    if(m_options.tx_lanes.scheduling == TxLaneScheduling::STRICT)
+    {
+        for(size_t lane = 0; lane < lane_count; ++lane)
+        {
+            if(HasTxLaneChunk(lane, clear_generation, is_tx_queue_accounted))
+            {
+                return lane;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    // Deficit round robin: the scheduled lane keeps sending while its deficit covers its next chunk, then the next lane receives its quantum.
+    // A quantum is at least one chunk, so a lane with a chunk to send is selected within one round.
+    const size_t chunk_size = GetTxLaneChunkSize();
+    const std::vector<size_t>& weights = m_options.tx_lanes.weights;
+
+    for(size_t visited_lanes = 0; visited_lanes <= lane_count; ++visited_lanes)
+    {
+        TxLane& tx_lane = m_tx_lanes[m_tx_scheduled_lane];
+
+        if(HasTxLaneChunk(m_tx_scheduled_lane, clear_generation, is_tx_queue_accounted))
+        {
+            if(tx_lane.deficit >= std::min(chunk_size, tx_lane.payload->bytes.size() - tx_lane.cut_bytes))
+            {
+                return m_tx_scheduled_lane;
+            }
+        }
+        else
+        {
+            // An idle lane does not save up credit for later
+            tx_lane.deficit = 0;
+        }
+
+        m_tx_scheduled_lane = (m_tx_scheduled_lane + 1) % lane_count;
+
+        const size_t weight = m_tx_scheduled_lane < weights.size() ? std::max<size_t>(weights[m_tx_scheduled_lane], 1) : 1;
+        m_tx_lanes[m_tx_scheduled_lane].deficit += weight * chunk_size;
+    }
+
+    return std::nullopt;
+}
+
+void ApplicationClient::CutTxLaneChunk(size_t lane)
+{
+    TxLane& tx_lane = m_tx_lanes[lane];
+    TxPayload& tx_payload = tx_lane.payload.value();
+
+    const size_t chunk_size = std::min(GetTxLaneChunkSize(), tx_payload.bytes.size() - tx_lane.cut_bytes);
+    const bool is_message_end = tx_lane.cut_bytes + chunk_size == tx_payload.bytes.size();
+
+    if(m_options.tx_lanes.scheduling == TxLaneScheduling::WEIGHTED)
+    {
+        tx_lane.deficit -= chunk_size;
+    }
+
+    // A payload that fits into a single chunk is handed over whole, and completes like a payload without lanes
+    if(tx_lane.cut_bytes == 0 && is_message_end)
+    {
+        tx_payload.frame_header_size = EncodeChunkHeader(lane, true, chunk_size, tx_payload.frame_header);
+        m_tx_in_flight.emplace_back(std::move(tx_payload));
+        tx_lane.payload.reset();
+        return;
+    }
+
+    TxPayload tx_chunk {.bytes = tx_payload.bytes.subspan(tx_lane.cut_bytes, chunk_size), .clear_generation = tx_payload.clear_generation, .lane = lane, .is_lane_chunk = true,
+        .is_borrowed = tx_payload.is_borrowed};
+    tx_chunk.frame_header_size = EncodeChunkHeader(lane, is_message_end, chunk_size, tx_chunk.frame_header);
+
+    m_tx_in_flight.emplace_back(std::move(tx_chunk));
+    tx_lane.cut_bytes += chunk_size;
+}
+
+void ApplicationClient::CompleteTxLaneChunk(TxPayload& tx_chunk)
+{
+    TxLane& tx_lane = m_tx_lanes[tx_chunk.lane];
+
+    // Zero-copy sends are numbered in order, so the chunk sent last carries the payload's last send
+    if(tx_chunk.zero_copy_sequence.has_value())
+    {
+        tx_lane.zero_copy_sequence = tx_chunk.zero_copy_sequence;
+    }
+
+    tx_lane.sent_bytes += tx_chunk.bytes.size();
+
+    if(tx_lane.sent_bytes < tx_lane.payload->bytes.size())
+    {
+        return;
+    }
+
+    tx_lane.payload->zero_copy_sequence = tx_lane.zero_copy_sequence;
+    CompleteTxPayload(*tx_lane.payload, true);
+    tx_lane.payload.reset();
+    tx_lane.zero_copy_sequence.reset();
+}
+
+void ApplicationClient::FailFrontTxLanePayload()
+{
+    const TxPayload& tx_chunk = m_tx_in_flight.front();
+    const size_t lane = tx_chunk.lane;
+    TxLane& tx_lane = m_tx_lanes[lane];
+
+    const size_t unsent_offset = tx_lane.sent_bytes + std::max(m_tx_payload_offset, tx_chunk.frame_header_size) - tx_chunk.frame_header_size;
+    ExecuteErrorCallback(Error::SOCKET_SEND_FAILURE, tx_lane.payload->bytes.subspan(unsent_offset));
+
+    // The rest of the payload can not be delivered without the failed chunk
+    RemoveTxLaneChunks(lane);
+    m_tx_payload_offset = 0;
+
+    tx_lane.payload->zero_copy_sequence = tx_lane.zero_copy_sequence;
+    CompleteTxPayload(*tx_lane.payload, false);
+    tx_lane.payload.reset();
+    tx_lane.zero_copy_sequence.reset();
+}
+
+void ApplicationClient::RemoveTxLaneChunks(size_t lane)
+{
+    TxLane& tx_lane = m_tx_lanes[lane];
+
+    std::erase_if(m_tx_in_flight, [&](const TxPayload& tx_payload)
+    {
+        if(not tx_payload.is_lane_chunk || tx_payload.lane != lane)
+        {
+            return false;
+        }
+
+        if(tx_payload.zero_copy_sequence.has_value())
+        {
+            tx_lane.zero_copy_sequence = tx_payload.zero_copy_sequence;
+        }
+
+        return true;
+    });
+}
+
+void ApplicationClient::RestartTxLanePayloads()
+{
+    for(size_t lane = 0; lane < m_tx_lanes.size(); ++lane)
+    {
+        TxLane& tx_lane = m_tx_lanes[lane];
+
+        if(tx_lane.payload.has_value() && tx_lane.cut_bytes > 0)
+        {
+            RemoveTxLaneChunks(lane);
+            tx_lane.cut_bytes = 0;
+            tx_lane.sent_bytes = 0;
+        }
+    }
+}
+
+size_t ApplicationClient::GatherTxPayloads()
+{
+    const uint64_t connection_generation = m_connection_generation.load();
+
+    if(connection_generation != m_tx_connection_generation)
+    {
+        // A payload that was partially sent on a lost connection is replayed from its first byte
+        if(m_options.reconnect.enabled)
+        {
+            m_tx_payload_offset = 0;
+
+            // The peer would take the remaining chunks of such a payload for the continuation of a message it never received, so the payload is cut again from the start
+            if(m_options.tx_lanes.enabled)
+            {
+                RestartTxLanePayloads();
+                PullTxPayloads();
+            }
+        }
+
+        // The memfds that were passed went to the peer of the previous connection
+        for(TxPayload& tx_payload : m_tx_in_flight)
+        {
+            tx_payload.is_memfd_passed = false;
+        }
+
+        m_tx_connection_generation = connection_generation;
+    }
+
+    const size_t batch_payload_limit = GetTxBatchPayloadLimit();
+    size_t batch_bytes = 0;
+    size_t tx_payload_offset = m_tx_payload_offset;
+
+    m_tx_iovecs.clear();
+    m_tx_iovecs_borrowed = false;
+    m_tx_memfds.clear();
+
+    size_t payload_count = 0;
+
+    for(TxPayload& tx_payload : m_tx_in_flight)
+    {
+        const size_t unsent_bytes = tx_payload.GetFrameSize() - tx_payload_offset;
+
+        // The first payload is always taken, even when it alone exceeds the byte budget
+        if(payload_count == batch_payload_limit || (payload_count > 0 && batch_bytes + unsent_bytes > m_options.tx_batch.max_bytes))
+        {
+            break;
+        }
+
+        if(tx_payload.is_memfd_frame && not tx_payload.is_memfd_passed)
+        {
+            if(m_tx_memfds.size() == MAX_MEMFDS_PER_MESSAGE)
+            {
+                break;
+            }
+
+            m_tx_memfds.push_back(std::get<MemfdPayload>(tx_payload.storage).GetFileDescriptor());
+        }
+
+        // The header is gathered from the payload's own storage rather than being concatenated onto its bytes
+        if(tx_payload_offset < tx_payload.frame_header_size)
+        {
+            m_tx_iovecs.push_back(iovec{.iov_base = tx_payload.frame_header.data() + tx_payload_offset, .iov_len = tx_payload.frame_header_size - tx_payload_offset});
+            tx_payload_offset = tx_payload.frame_header_size;
+        }
+
+        const size_t payload_offset = tx_payload_offset - tx_payload.frame_header_size;
+
+        m_tx_iovecs.push_back(iovec{.iov_base = tx_payload.bytes.data() + payload_offset, .iov_len = tx_payload.bytes.size() - payload_offset});
+        m_tx_iovecs_borrowed = m_tx_iovecs_borrowed || tx_payload.is_borrowed;
+        batch_bytes += unsent_bytes;
+        tx_payload_offset = 0;
+        ++payload_count;
+    }
+
+    return batch_bytes;
+}
+
+void ApplicationClient::GatherTxMessages()
+{
+    m_tx_messages.clear();
+
+    size_t iovec_index = 0;
+
+    // A message is never sent in part, so every gathered payload starts with its header (a chunk header with TX lanes) and takes up one or two iovecs
+    for(const TxPayload& tx_payload : m_tx_in_flight)
+    {
+        if(iovec_index == m_tx_iovecs.size())
+        {
+            break;
+        }
+
+        const size_t iovec_count = tx_payload.frame_header_size > 0 ? 2 : 1;
+
+        mmsghdr tx_message {};
+        tx_message.msg_hdr.msg_iov = &m_tx_iovecs[iovec_index];
+        tx_message.msg_hdr.msg_iovlen = iovec_count;
+        m_tx_messages.push_back(tx_message);
+
+        iovec_index += iovec_count;
+    }
+}
+
+ssize_t ApplicationClient::SendTxMessages(int flags)
+{
+    GatherTxMessages();
+
+    const int sent_messages = sendmmsg(m_client_file_descriptor, m_tx_messages.data(), m_tx_messages.size(), flags);
+
+    if(sent_messages < 0)
+    {
+        return -1;
+    }
+
+    // The messages that went out are whole, so their bytes complete exactly the payloads they were gathered from
+    ssize_t sent_bytes = 0;
+
+    for(int index = 0; index < sent_messages; ++index)
+    {
+        sent_bytes += m_tx_messages[index].msg_len;
+    }
+
+    return sent_bytes;
+}
+
+void ApplicationClient::AttachTxMemfds(msghdr& tx_message)
+{
+    if(m_tx_memfds.empty())
+    {
+        return;
+    }
+
+    const size_t descriptors_size = m_tx_memfds.size() * sizeof(int);
+
+    tx_message.msg_control = m_tx_memfd_control.data();
+    tx_message.msg_controllen = CMSG_SPACE(descriptors_size);
+
+    cmsghdr* control_message = CMSG_FIRSTHDR(&tx_message);
+    control_message->cmsg_level = SOL_SOCKET;
+    control_message->cmsg_type = SCM_RIGHTS;
+    control_message->cmsg_len = CMSG_LEN(descriptors_size);
+    std::memcpy(CMSG_DATA(control_message), m_tx_memfds.data(), descriptors_size);
+}
+
+void ApplicationClient::MarkTxMemfdsPassed()
+{
+    size_t passed_memfds = 0;
+
+    // The gathered memfds belong to the first memfd frames that had not been passed
+    for(TxPayload& tx_payload : m_tx_in_flight)
+    {
+        if(passed_memfds == m_tx_memfds.size())
+        {
+            break;
+        }
+
+        if(tx_payload.is_memfd_frame && not tx_payload.is_memfd_passed)
+        {
+            tx_payload.is_memfd_passed = true;
+            ++passed_memfds;
+        }
+    }
+
+    m_tx_memfds.clear();
+}
+
+void ApplicationClient::ConsumeSentBytes(size_t sent_bytes)
+{
+    m_statistics.RecordSentBytes(sent_bytes);
+
+    while(sent_bytes > 0)
+    {
+        const size_t unsent_bytes = m_tx_in_flight.front().GetFrameSize() - m_tx_payload_offset;
+
+        if(sent_bytes < unsent_bytes)
+        {
+            m_tx_payload_offset += sent_bytes;
+            return;
+        }
+
+        sent_bytes -= unsent_bytes;
+        CompleteFrontTxPayload(true);
+    }
+}
+
+void ApplicationClient::FailFrontTxPayload()
+{
+    if(m_tx_in_flight.front().is_lane_chunk)
+    {
+        FailFrontTxLanePayload();
+        return;
+    }
+
+    const TxPayload& tx_payload = m_tx_in_flight.front();
+    const std::span<char> unsent_payload_view = tx_payload.bytes.subspan(std::max(m_tx_payload_offset, tx_payload.frame_header_size) - tx_payload.frame_header_size);
+    ExecuteErrorCallback(Error::SOCKET_SEND_FAILURE, unsent_payload_view);
+    CompleteFrontTxPayload(false);
+}
+
+void ApplicationClient::CompleteFrontTxPayload(bool is_sent)
+{
+    TxPayload& tx_payload = m_tx_in_flight.front();
+
+    if(tx_payload.is_lane_chunk)
+    {
+        CompleteTxLaneChunk(tx_payload);
+    }
+    else
+    {
+        CompleteTxPayload(tx_payload, is_sent);
+    }
+
+    m_tx_in_flight.pop_front();
+    m_tx_payload_offset = 0;
+}
+
+void ApplicationClient::CompleteTxPayload(TxPayload& tx_payload, bool is_sent)
+{
+    if(is_sent)
+    {
+        m_statistics.RecordSentMessage(tx_payload.enqueue_timestamp);
+    }
+
+    if(tx_payload.completion_callback)
+    {
+        m_tx_completions.push_back(TxCompletion{.callback = std::move(tx_payload.completion_callback), .is_sent = is_sent});
+    }
+
+    // The kernel may still read from the storage of a zero-copy payload, otherwise the caller releases the storage right away
+    if(tx_payload.zero_copy_sequence.has_value())
+    {
+        m_tx_zero_copy_retained.emplace_back(std::move(tx_payload));
+    }
+}
+
+bool ApplicationClient::IsTxZeroCopyEligible(size_t batch_bytes)
+{
+    if(not m_options.zero_copy.enabled || m_reactor_uses_io_uring || m_tx_iovecs_borrowed || batch_bytes < m_options.zero_copy.min_send_size)
+    {
+        return false;
+    }
+
+    // Every socket numbers its zero-copy sends from zero, and the copy fallback is decided per connection
+    const uint64_t connection_generation = m_connection_generation.load();
+
+    if(connection_generation != m_tx_zero_copy_connection_generation)
+    {
+        ReleaseTxZeroCopyPayloads();
+        m_tx_zero_copy_connection_generation = connection_generation;
+        m_tx_zero_copy_fallback = false;
+    }
+
+    return m_zero_copy_socket && not m_tx_zero_copy_fallback;
+}
+
+void ApplicationClient::MarkTxZeroCopyPayloads(size_t sent_bytes)
+{
+    const uint32_t sequence = m_tx_zero_copy_next_sequence++;
+    size_t tx_payload_offset = m_tx_payload_offset;
+
+    for(TxPayload& tx_payload : m_tx_in_flight)
+    {
+        tx_payload.zero_copy_sequence = sequence;
+
+        const size_t unsent_bytes = tx_payload.GetFrameSize() - tx_payload_offset;
+
+        if(sent_bytes <= unsent_bytes)
+        {
+            break;
+        }
+
+        sent_bytes -= unsent_bytes;
+        tx_payload_offset = 0;
+    }
+}
+
+bool ApplicationClient::HasUnreportedTxZeroCopySends() const
+{
+    return m_tx_zero_copy_completed_sequence != m_tx_zero_copy_next_sequence;
+}
+
+void ApplicationClient::ReapTxZeroCopyReports()
+{
+    if(not HasUnreportedTxZeroCopySends())
+    {
+        return;
+    }
+
+    // The sends of a closed socket are never reported, and the kernel will not transmit their bytes anymore either
+    if(GetClientState() != ClientState::CONNECTED || m_connection_generation.load() != m_tx_zero_copy_connection_generation)
+    {
+        ReleaseTxZeroCopyPayloads();
+        return;
+    }
+
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(sock_extended_err) + sizeof(sockaddr_in))];
+
+    while(HasUnreportedTxZeroCopySends())
+    {
+        msghdr message {};
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+
+        // Reading the error queue never blocks, it fails with EAGAIN once the queue is empty
+        if(recvmsg(m_client_file_descriptor, &message, MSG_ERRQUEUE) < 0)
+        {
+            return;
+        }
+
+        for(cmsghdr* control_message = CMSG_FIRSTHDR(&message); control_message != nullptr; control_message = CMSG_NXTHDR(&message, control_message))
+        {
+            if(control_message->cmsg_level != SOL_IP || control_message->cmsg_type != IP_RECVERR)
+            {
+                continue;
+            }
+
+            sock_extended_err extended_error {};
+            std::memcpy(&extended_error, CMSG_DATA(control_message), sizeof(extended_error));
+
+            if(extended_error.ee_origin != SO_EE_ORIGIN_ZEROCOPY || extended_error.ee_errno != 0)
+            {
+                continue;
+            }
+
+            // The kernel had to copy the bytes after all, so zero-copy sends would only add the cost of the reports
+            if(extended_error.ee_code & SO_EE_CODE_ZEROCOPY_COPIED)
+            {
+                m_tx_zero_copy_fallback = true;
+            }
+
+            CompleteTxZeroCopySends(extended_error.ee_info, extended_error.ee_data);
+        }
+    }
+}
+
+void ApplicationClient::CompleteTxZeroCopySends(uint32_t first_sequence, uint32_t last_sequence)
+{
+    m_tx_zero_copy_reported_ranges.emplace_back(first_sequence, last_sequence);
+
+    // The completed sequence only advances over an unbroken run of reported sends
+    bool is_advanced = true;
+
+    while(is_advanced)
+    {
+        is_advanced = false;
+
+        for(auto range = m_tx_zero_copy_reported_ranges.begin(); range != m_tx_zero_copy_reported_ranges.end(); ++range)
+        {
+            if(range->first == m_tx_zero_copy_completed_sequence)
+            {
+                m_tx_zero_copy_completed_sequence = range->second + 1;
+                m_tx_zero_copy_reported_ranges.erase(range);
+                is_advanced = true;
+                break;
+            }
+        }
+    }
+
+    // The retained payloads are in send order, so their last sequence numbers never decrease. The signed difference copes with the numbers wrapping around.
+    while(not m_tx_zero_copy_retained.empty() && static_cast<int32_t>(m_tx_zero_copy_retained.front().zero_copy_sequence.value() - m_tx_zero_copy_completed_sequence) < 0)
+    {
+        m_tx_zero_copy_retained.pop_front();
+    }
+}
+
+void ApplicationClient::ReleaseTxZeroCopyPayloads()
+{
+    m_tx_zero_copy_retained.clear();
+    m_tx_zero_copy_reported_ranges.clear();
+    m_tx_zero_copy_next_sequence = 0;
+    m_tx_zero_copy_completed_sequence = 0;
+
+    // A payload that is still in flight was only partially sent on the previous socket
+    for(TxPayload& tx_payload : m_tx_in_flight)
+    {
+        tx_payload.zero_copy_sequence.reset();
+    }
+}
+
+void ApplicationClient::ProcessRxPayloads()
+{
+    SetRxWorkerThreadState(WorkerThreadState::RUNNING);
+
+    while(GetRxWorkerThreadState() != WorkerThreadState::ENDING)
+    {
+        // Load the generation before checking the state, so that a connection established in between ends the wait right away
+        const uint64_t connection_generation = m_connection_generation.load();
+
+        if(GetClientState() != ClientState::CONNECTED)
+        {
+            // The messages that were read before the connection ended are still delivered
+            DeliverRxBatch();
+
+            if(GetRxWorkerThreadState() == WorkerThreadState::ENDING)
+            {
+                break;
+            }
+
+            // Wait here until a connection is established or the worker thread is being signaled to shutdown
+            m_connection_generation.wait(connection_generation);
+
+            continue;
+        }
+
+        PrepareRxBuffer();
+
+        // While a batch is being gathered, only the bytes that are already available are read
+        const bool is_gathering_batch = not m_rx_batch.empty();
+        const ssize_t read_bytes = ReceiveRxBytes(is_gathering_batch ? MSG_DONTWAIT : 0);
+
+        m_statistics.RecordRecv(read_bytes);
+
+        if(is_gathering_batch && read_bytes < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            DeliverRxBatch();
+            continue;
+        }
+
+        // Whatever ends the connection comes after the messages that were read ahead of it
+        if(read_bytes <= 0)
+        {
+            const int read_error = errno;
+            DeliverRxBatch();
+            errno = read_error;
+        }
+
+        // The server closed the connection in this case
+        if(read_bytes == 0)
+        {
+            // If the connection was closed by the server and the client still thinks it is in the connected state, then clean up the socket on the client's side.
+            // This transitions to the not-connected state, or to reconnecting.
+            LoseConnection();
+        }
+        // An error occured while reading
+        else if(read_bytes < 0)
+        {
+            const int read_error = errno;
+            const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to read!";
+            perror(error_message.c_str());
+            ExecuteErrorCallback(Error::SOCKET_READ_FAILURE, std::nullopt);
+
+            // A broken connection is only given up on when it can be reconnected
+            if(m_options.reconnect.enabled && IsConnectionLostError(read_error))
+            {
+                LoseConnection();
+            }
+        }
+        // Message data was received from the socket
+        else if(not DeliverRxBytes(read_bytes))
+        {
+            // The rest of the stream cannot be split into frames, so the connection is dropped as if the server had closed it
+            DeliverRxBatch();
+            LoseConnection();
+        }
+        // A read that came back short has most likely drained the socket, which saves the read that would only find it empty
+        else if(IsRxDrained(read_bytes))
+        {
+            DeliverRxBatch();
+        }
+    }
+
+    DeliverRxBatch();
+    SetRxWorkerThreadState(WorkerThreadState::INACTIVE);
+}
+
+void ApplicationClient::PrepareRxBuffer()
+{
+    // The current buffer can be read into again unless a callback still holds it, or it is smaller than the grown target size
+    const auto is_reusable = [this](const RxBufferRef& rx_buffer)
+    {
+        return rx_buffer && not rx_buffer.IsShared() && rx_buffer.GetSize() >= m_rx_buffer_pool->GetBufferSize();
+    };
+
+    if(m_endpoint.socket_mode == SocketMode::UNIX_SEQPACKET)
+    {
+        if(m_rx_messages.empty() || m_rx_message_buffer_size != m_rx_buffer_pool->GetBufferSize())
+        {
+            m_rx_message_buffers.resize(std::max<size_t>(m_options.unix_socket.rx_batch_messages, 1));
+            m_rx_message_iovecs.resize(m_rx_message_buffers.size());
+            m_rx_messages.resize(m_rx_message_buffers.size());
+            m_rx_message_count = m_rx_messages.size();
+            m_rx_message_buffer_size = m_rx_buffer_pool->GetBufferSize();
+        }
+
+        for(size_t index = 0; index < m_rx_message_count; ++index)
+        {
+            if(not is_reusable(m_rx_message_buffers[index]))
+            {
+                m_rx_message_buffers[index] = m_rx_buffer_pool->Acquire();
+            }
+
+            m_rx_message_iovecs[index] = iovec{.iov_base = m_rx_message_buffers[index].GetData(), .iov_len = m_rx_message_buffers[index].GetSize()};
+            m_rx_messages[index] = mmsghdr {};
+            m_rx_messages[index].msg_hdr.msg_iov = &m_rx_message_iovecs[index];
+            m_rx_messages[index].msg_hdr.msg_iovlen = 1;
+        }
+    }
+    else if(not is_reusable(m_rx_buffer))
+    {
+        m_rx_buffer = m_rx_buffer_pool->Acquire();
+    }
+
+    // A frame left incomplete by a previous connection must not be continued with bytes from the new one
+    const uint64_t connection_generation = m_connection_generation.load();
+
+    if(m_rx_frame_decoder != nullptr && connection_generation != m_rx_connection_generation)
+    {
+        m_rx_frame_decoder->Reset();
+        CloseRxMemfds();
+    }
+
+    m_rx_connection_generation = connection_generation;
+}
+
+ssize_t ApplicationClient::ReceiveRxBytes(int flags)
+{
+    if(m_endpoint.socket_mode == SocketMode::SHARED_MEMORY)
+    {
+        return ReceiveSharedMemoryBytes(flags);
+    }
+
+    if(m_endpoint.socket_mode == SocketMode::UNIX_SEQPACKET)
+    {
+        return ReceiveRxMessages(flags);
+    }
+
+    if(not m_memfd_transfer_enabled)
+    {
+        return recv(m_client_file_descriptor, m_rx_buffer.GetData(), m_rx_buffer.GetSize(), flags);
+    }
+
+    iovec rx_iovec {.iov_base = m_rx_buffer.GetData(), .iov_len = m_rx_buffer.GetSize()};
+    msghdr rx_message {};
+    rx_message.msg_iov = &rx_iovec;
+    rx_message.msg_iovlen = 1;
+    rx_message.msg_control = m_rx_memfd_control.data();
+    rx_message.msg_controllen = m_rx_memfd_control.size();
+
+    const ssize_t read_bytes = recvmsg(m_client_file_descriptor, &rx_message, flags | MSG_CMSG_CLOEXEC);
+
+    if(read_bytes > 0)
+    {
+        TakeRxMemfds(rx_message);
+    }
+
+    return read_bytes;
+}
+
+ssize_t ApplicationClient::ReceiveRxMessages(int flags)
+{
+    while(true)
+    {
+        // Waits for the first message only, and then takes whatever else has arrived
+        const int read_messages = recvmmsg(m_client_file_descriptor, m_rx_messages.data(), m_rx_messages.size(), flags | MSG_WAITFORONE, nullptr);
+
+        if(read_messages < 0)
+        {
+            return -1;
+        }
+
+        m_rx_message_count = read_messages;
+
+        // The end of the connection reads as empty messages that fill the rest of the batch, after the messages that arrived before it
+        const bool is_end_of_stream = m_rx_message_count == m_rx_messages.size() && m_rx_messages[m_rx_message_count - 1].msg_len == 0;
+
+        while(is_end_of_stream && m_rx_message_count > 0 && m_rx_messages[m_rx_message_count - 1].msg_len == 0)
+        {
+            --m_rx_message_count;
+        }
+
+        ssize_t read_bytes = 0;
+
+        for(size_t index = 0; index < m_rx_message_count; ++index)
+        {
+            read_bytes += m_rx_messages[index].msg_len;
+        }
+
+        if(read_bytes > 0 || is_end_of_stream)
+        {
+            return read_bytes;
+        }
+
+        // Only empty messages were read, which are rejected before the socket is read again
+        DeliverRxMessages();
+    }
+}
+
+ssize_t ApplicationClient::ReceiveSharedMemoryBytes(int flags)
+{
+    SharedMemoryChannel* channel = GetWorkerSharedMemoryChannel(m_rx_shared_memory_channel);
+
+    // The session was closed in between, which ends the stream like a socket that was shut down
+    if(channel == nullptr)
+    {
+        return 0;
+    }
+
+    return channel->Receive(m_rx_buffer.GetBytes(), (flags & MSG_DONTWAIT) == 0);
+}
+
+ssize_t ApplicationClient::SendSharedMemoryBytes(int flags)
+{
+    SharedMemoryChannel* channel = GetWorkerSharedMemoryChannel(m_tx_shared_memory_channel);
+
+    if(channel == nullptr)
+    {
+        errno = ENOTCONN;
+        return -1;
+    }
+
+    return channel->Send(m_tx_iovecs.data(), m_tx_iovecs.size(), (flags & MSG_DONTWAIT) == 0);
+}
+
+void ApplicationClient::TakeRxMemfds(const msghdr& rx_message)
+{
+    if((rx_message.msg_flags & MSG_CTRUNC) != 0)
+    {
+        m_rx_memfds_lost = true;
+    }
+
+    for(const cmsghdr* control_message = CMSG_FIRSTHDR(&rx_message); control_message != nullptr; control_message = CMSG_NXTHDR(const_cast<msghdr*>(&rx_message), const_cast<cmsghdr*>(control_message)))
+    {
+        if(control_message->cmsg_level != SOL_SOCKET || control_message->cmsg_type != SCM_RIGHTS)
+        {
+            continue;
+        }
+
+        const size_t descriptor_count = (control_message->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+
+        for(size_t index = 0; index < descriptor_count; ++index)
+        {
+            int memfd = DEFAULT_FILE_DESCRIPTOR;
+            std::memcpy(&memfd, CMSG_DATA(control_message) + index * sizeof(int), sizeof(int));
+            m_rx_memfds.push_back(memfd);
+        }
+    }
+}
+
+void ApplicationClient::CloseRxMemfds()
+{
+    for(const int memfd : m_rx_memfds)
+    {
+        close(memfd);
+    }
+
+    m_rx_memfds.clear();
+    m_rx_memfds_lost = false;
+}
+
+bool ApplicationClient::DeliverRxBytes(size_t read_bytes)
+{
+    // Every successful read in either mode ends up here
+    RearmTcpQuickAck();
+
+    if(m_endpoint.socket_mode == SocketMode::UNIX_SEQPACKET)
+    {
+        DeliverRxMessages();
+        return true;
+    }
+
+    m_rx_buffer_pool->RecordRead(read_bytes, m_rx_buffer.GetSize());
+    m_rx_read_timestamp = m_statistics.GetLatencyTimestamp();
+
+    const std::span<char> rx_buffer_view(m_rx_buffer.GetData(), read_bytes);
+
+    if(m_rx_frame_decoder == nullptr)
+    {
+        DeliverRxMessage(m_rx_buffer, rx_buffer_view);
+        return true;
+    }
+
+    if(not m_rx_frame_decoder->Decode(m_rx_buffer, rx_buffer_view))
+    {
+        // A memfd frame that failed has been reported already
+        if(not std::exchange(m_rx_memfd_failed, false))
+        {
+            const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Received a frame that exceeds the maximum frame size!";
+            std::cerr << error_message << "\n";
+            ExecuteErrorCallback(Error::FRAME_SIZE_FAILURE, std::nullopt);
+        }
+
+        m_rx_frame_decoder->Reset();
+        return false;
+    }
+
+    return true;
+}
+
+bool ApplicationClient::DeliverRxMemfd()
+{
+    if(m_rx_memfds.empty() || m_rx_memfds_lost)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Received a memfd frame without its descriptor!";
+        std::cerr << error_message << "\n";
+        ExecuteErrorCallback(Error::MEMFD_TRANSFER_FAILURE, std::nullopt);
+        m_rx_memfd_failed = true;
+        return false;
+    }
+
+    const int memfd = m_rx_memfds.front();
+    m_rx_memfds.pop_front();
+
+    // The mapping keeps the memfd's pages alive on its own
+    const RxBufferRef rx_buffer = MapSealedMemfd(memfd, *m_rx_buffer_pool);
+    close(memfd);
+
+    if(not rx_buffer)
+    {
+        ExecuteErrorCallback(Error::MEMFD_TRANSFER_FAILURE, std::nullopt);
+        m_rx_memfd_failed = true;
+        return false;
+    }
+
+    DeliverRxMessage(rx_buffer, rx_buffer.GetBytes());
+
+    return true;
+}
+
+void ApplicationClient::DeliverRxMessages()
+{
+    m_rx_read_timestamp = m_statistics.GetLatencyTimestamp();
+
+    for(size_t index = 0; index < m_rx_message_count; ++index)
+    {
+        const mmsghdr& rx_message = m_rx_messages[index];
+        const RxBufferRef& rx_buffer = m_rx_message_buffers[index];
+
+        // A truncated message filled its buffer, which lets the pool grow the buffers for the next ones
+        m_rx_buffer_pool->RecordRead(rx_message.msg_len, rx_buffer.GetSize());
+
+        // The rest of the message is gone, but the boundaries of the following ones are intact
+        if((rx_message.msg_hdr.msg_flags & MSG_TRUNC) != 0)
+        {
+            const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Received a message that exceeds the RX buffer!";
+            std::cerr << error_message << "\n";
+            ExecuteErrorCallback(Error::FRAME_SIZE_FAILURE, std::nullopt);
+            continue;
+        }
+
+        // An empty message can not be told apart from the end of the connection by a plain read, so it is not delivered either
+        if(rx_message.msg_len == 0)
+        {
+            const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Received an empty message!";
+            std::cerr << error_message << "\n";
+            ExecuteErrorCallback(Error::FRAME_SIZE_FAILURE, std::nullopt);
+            continue;
+        }
+
+        DeliverRxMessage(rx_buffer, std::span<char>(rx_buffer.GetData(), rx_message.msg_len));
+    }
+}
+
+void ApplicationClient::DeliverRxMessage(const RxBufferRef& rx_buffer, const std::span<char>& rx_bytes)
+{
+    if(m_rx_awaited)
+    {
+        // A coroutine that has started waiting only gets the messages that come after the gathered ones
+        DeliverRxBatch();
+        DeliverAwaitedRxMessage(RxMessage{.buffer = rx_buffer, .bytes = rx_bytes});
+    }
+    else if(m_rx_executor != nullptr)
+    {
+        // The message is counted once the executor has delivered it
+        DispatchRxMessage(rx_buffer, rx_bytes);
+        return;
+    }
+    else if(m_rx_batch_callback)
+    {
+        // Keeping the buffer retains it, so the next read goes into a fresh one. The message is counted once the batch has been delivered.
+        m_rx_batch.push_back(RxMessage{.buffer = rx_buffer, .bytes = rx_bytes});
+        m_rx_batch_read_timestamps.push_back(m_rx_read_timestamp);
+
+        // A read can complete more messages than a batch holds
+        if(m_rx_batch.size() >= std::max<size_t>(m_options.rx_batch.max_messages, 1))
+        {
+            DeliverRxBatch();
+        }
+
+        return;
+    }
+    else if(m_rx_buffer_callback)
+    {
+        m_rx_buffer_callback(rx_buffer, rx_bytes);
+    }
+    else
+    {
+        m_rx_callback(rx_bytes);
+    }
+
+    m_statistics.RecordReceivedMessage(m_rx_read_timestamp);
+}
+
+bool ApplicationClient::IsRxDrained(ssize_t read_bytes) const
+{
+    // A SEQPACKET socket has been drained when a batch comes back short of messages rather than of bytes
+    if(m_endpoint.socket_mode == SocketMode::UNIX_SEQPACKET)
+    {
+        return m_rx_message_count < m_rx_messages.size();
+    }
+
+    return static_cast<size_t>(read_bytes) < m_rx_buffer.GetSize();
+}
+
+void ApplicationClient::DeliverRxBatch()
+{
+    if(not m_rx_batch.empty())
+    {
+        ExecuteRxBatchCallback(m_rx_batch, m_rx_batch_read_timestamps);
+    }
+}
+
+void ApplicationClient::ExecuteRxBatchCallback(std::vector<RxMessage>& rx_messages, std::vector<uint64_t>& read_timestamps)
+{
+    m_rx_batch_callback(std::span<const RxMessage>(rx_messages));
+
+    for(const uint64_t read_timestamp : read_timestamps)
+    {
+        m_statistics.RecordReceivedMessage(read_timestamp);
+    }
+
+    // Releasing the buffers hands them back to the pool, while the vectors keep their capacity for the next batch
+    rx_messages.clear();
+    read_timestamps.clear();
+}
+
+std::shared_ptr<CallbackExecutor> ApplicationClient::CreateRxExecutor(const RxDispatchOptions& options)
+{
+    if(not options.enabled)
+    {
+        return nullptr;
+    }
+
+    if(options.executor != nullptr)
+    {
+        return options.executor;
+    }
+
+    return std::make_shared<ThreadPoolExecutor>(options.thread_count);
+}
+
+void ApplicationClient::DispatchRxMessage(const RxBufferRef& rx_buffer, const std::span<char>& rx_bytes)
+{
+    bool is_task_needed = false;
+
+    {
+        std::unique_lock<std::mutex> lock(m_rx_dispatch_mutex);
+
+        // Only a full queue holds up the RX consumer, and with it the socket. The event loop must not wait, so it takes the rest of the read and pauses reading instead.
+        while(m_reactor == nullptr && not m_rx_dispatch_stopped && not HasRxDispatchRoom(rx_bytes.size()))
+        {
+            WaitForRxDispatch(lock);
+        }
+
+        if(m_rx_dispatch_stopped)
+        {
+            return;
+        }
+
+        // Keeping the buffer retains it, so the RX consumer reads into a fresh one until the message has been delivered
+        m_rx_dispatch_queue.push_back(RxDispatchedMessage{.buffer = rx_buffer, .bytes = rx_bytes, .read_timestamp = m_rx_read_timestamp});
+        m_rx_dispatch_queued_bytes += rx_bytes.size();
+        m_statistics.RecordRxDispatch();
+
+        if(m_reactor != nullptr && not HasRxDispatchRoom(0))
+        {
+            m_rx_dispatch_paused = true;
+        }
+
+        is_task_needed = not std::exchange(m_rx_dispatch_scheduled, true);
+    }
+
+    if(is_task_needed)
+    {
+        m_rx_executor->Execute([this](){ ExecuteRxDispatch(); });
+    }
+}
+
+bool ApplicationClient::HasRxDispatchRoom(size_t message_bytes) const
+{
+    // A message that alone exceeds the byte limit is only admitted into an empty queue
+    if(m_rx_dispatch_queue.empty())
+    {
+        return true;
+    }
+
+    const RxDispatchOptions& options = m_options.rx_dispatch;
+
+    if(options.max_queued_messages > 0 && m_rx_dispatch_queue.size() >= options.max_queued_messages)
+    {
+        return false;
+    }
+
+    return options.max_queued_bytes == 0 || m_rx_dispatch_queued_bytes + message_bytes <= options.max_queued_bytes;
+}
+
+void ApplicationClient::ExecuteRxDispatch()
+{
+    std::unique_lock<std::mutex> lock(m_rx_dispatch_mutex);
+
+    for(size_t delivered_messages = 0; delivered_messages < MAX_RX_DISPATCH_MESSAGES_PER_TASK; ++delivered_messages)
+    {
+        if(m_rx_dispatch_stopped || m_rx_dispatch_queue.empty())
+        {
+            m_rx_dispatch_scheduled = false;
+            NotifyRxDispatchWaiters();
+            return;
+        }
+
+        // A batch callback takes every queued message at once, up to its batch size
+        if(m_rx_batch_callback)
+        {
+            const size_t batch_size = std::min(m_rx_dispatch_queue.size(), std::max<size_t>(m_options.rx_batch.max_messages, 1));
+
+            for(size_t index = 0; index < batch_size; ++index)
+            {
+                RxDispatchedMessage& rx_message = m_rx_dispatch_queue.front();
+                m_rx_dispatch_queued_bytes -= rx_message.bytes.size();
+                m_rx_dispatch_batch.push_back(RxMessage{.buffer = std::move(rx_message.buffer), .bytes = rx_message.bytes});
+                m_rx_dispatch_batch_read_timestamps.push_back(rx_message.read_timestamp);
+                m_rx_dispatch_queue.pop_front();
+            }
+
+            NotifyRxDispatchWaiters();
+            const bool is_resume_needed = IsRxDispatchResumable();
+            lock.unlock();
+
+            if(is_resume_needed)
+            {
+                ResumeReactorReceiveLater();
+            }
+
+            ExecuteRxBatchCallback(m_rx_dispatch_batch, m_rx_dispatch_batch_read_timestamps);
+
+            for(size_t index = 0; index < batch_size; ++index)
+            {
+                m_statistics.RecordRxDispatchDelivery();
+            }
+
+            delivered_messages += batch_size - 1;
+            lock.lock();
+            continue;
+        }
+
+        RxDispatchedMessage rx_message = std::move(m_rx_dispatch_queue.front());
+        m_rx_dispatch_queue.pop_front();
+        m_rx_dispatch_queued_bytes -= rx_message.bytes.size();
+
+        // The RX consumer can carry on reading while the callback runs
+        NotifyRxDispatchWaiters();
+        const bool is_resume_needed = IsRxDispatchResumable();
+        lock.unlock();
+
+        if(is_resume_needed)
+        {
+            ResumeReactorReceiveLater();
+        }
+
+        if(m_rx_buffer_callback)
+        {
+            m_rx_buffer_callback(rx_message.buffer, rx_message.bytes);
+        }
+        else
+        {
+            m_rx_callback(rx_message.bytes);
+        }
+
+        m_statistics.RecordReceivedMessage(rx_message.read_timestamp);
+        m_statistics.RecordRxDispatchDelivery();
+
+        rx_message = RxDispatchedMessage {};
+        lock.lock();
+    }
+
+    // The task stays scheduled, so the messages that are left keep their order behind the tasks of other clients
+    lock.unlock();
+    m_rx_executor->Execute([this](){ ExecuteRxDispatch(); });
+}
+
+bool ApplicationClient::IsRxDispatchResumable()
+{
+    // Called under the lock. Only the task that makes room clears the pause, so that exactly one resume is posted for it.
+    if(not m_rx_dispatch_paused || not HasRxDispatchRoom(0))
+    {
+        return false;
+    }
+
+    m_rx_dispatch_paused = false;
+    return true;
+}
+
+void ApplicationClient::ResumeReactorReceiveLater()
+{
+    m_reactor->Post(m_reactor_event_loop, [this](){ ResumeReactorReceive(); });
+}
+
+void ApplicationClient::WaitForRxDispatch(std::unique_lock<std::mutex>& lock)
+{
+    // Loaded under the lock, so that a notification that comes before the wait ends it right away
+    const uint64_t rx_dispatch_generation = m_rx_dispatch_generation.load();
+
+    lock.unlock();
+    m_rx_dispatch_generation.wait(rx_dispatch_generation);
+    lock.lock();
+}
+
+void ApplicationClient::NotifyRxDispatchWaiters()
+{
+    // Called under the lock, since the destructor may be waiting to tear the generation down once a task has ended
+    ++m_rx_dispatch_generation;
+    m_rx_dispatch_generation.notify_all();
+}
+
+void ApplicationClient::StopRxDispatch()
+{
+    if(m_rx_executor == nullptr)
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_rx_dispatch_mutex);
+
+    m_rx_dispatch_stopped = true;
+    NotifyRxDispatchWaiters();
+
+    // A task that is handed over refers to this client, and ends at its next message
+    while(m_rx_dispatch_scheduled)
+    {
+        WaitForRxDispatch(lock);
+    }
+
+    m_rx_dispatch_queue.clear();
+    m_rx_dispatch_queued_bytes = 0;
+}
+
+void ApplicationClient::OnReactorEvents(uint32_t events)
+{
+    const ClientState client_state = GetClientState();
+
+    if(client_state == ClientState::OPENING)
+    {
+        CompleteReactorConnection();
+        return;
+    }
+
+    // A pending close request will tear down the socket once its task runs
+    if(client_state != ClientState::CONNECTED)
+    {
+        return;
+    }
+
+    // Unread zero-copy reports keep the socket's error condition raised
+    if(events & EPOLLERR)
+    {
+        ReapTxZeroCopyReports();
+    }
+
+    // A hang-up or an error is reported even while reading is paused, and has to be read to its end, or the event loop would be woken for it forever
+    if((events & (EPOLLHUP | EPOLLERR)) || ((events & EPOLLIN) && not m_reactor_rx_paused))
+    {
+        ReceiveReactorPayloads();
+    }
+
+    if((events & EPOLLOUT) && GetClientState() == ClientState::CONNECTED)
+    {
+        FlushReactorTxPayloads();
+    }
+}
+
+void ApplicationClient::OpenReactorConnection()
+{
+    // The open request may have been superseded before this task got to run
+    if(GetClientState() != ClientState::OPENING)
+    {
+        return;
+    }
+
+    if(m_reactor_watching_socket)
+    {
+        m_reactor->Unwatch(m_reactor_event_loop, m_client_file_descriptor);
+        m_reactor_watching_socket = false;
+    }
+
+    // Ensure the file descriptors are cleaned up before opening a connection
+    shutdown(m_client_file_descriptor, SHUT_RDWR);
+    close(m_client_file_descriptor);
+
+    if(not OpenSocket())
+    {
+        FailReactorConnectionAttempt();
+        return;
+    }
+
+    const int file_status_flags = fcntl(m_client_file_descriptor, F_GETFL, 0);
+    fcntl(m_client_file_descriptor, F_SETFL, file_status_flags | O_NONBLOCK);
+
+    if(not ConnectSocket())
+    {
+        FailReactorConnectionAttempt();
+        return;
+    }
+
+    // The socket becomes writable once the connection attempt has completed, successfully or not
+    m_reactor_watched_events = EPOLLOUT;
+    m_reactor_watching_socket = m_reactor->Watch(m_reactor_event_loop, m_client_file_descriptor, m_reactor_watched_events, this);
+
+    if(not m_reactor_watching_socket)
+    {
+        ExecuteErrorCallback(Error::SOCKET_CONNECT_FAILURE, std::nullopt);
+        FailReactorConnectionAttempt();
+        return;
+    }
+
+    if(m_options.connect.timeout.count() > 0)
+    {
+        m_reactor_connect_timer = m_reactor->PostAfter(m_reactor_event_loop, m_options.connect.timeout, [this](){ TimeOutReactorConnection(); });
+    }
+}
+
+void ApplicationClient::CompleteReactorConnection()
+{
+    CancelReactorConnectTimeout();
+
+    int socket_error = 0;
+    socklen_t socket_error_length = sizeof(socket_error);
+
+    getsockopt(m_client_file_descriptor, SOL_SOCKET, SO_ERROR, &socket_error, &socket_error_length);
+
+    if(socket_error != 0)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to connect! Error code: {" + std::to_string(socket_error) +"}";
+        perror(error_message.c_str());
+        ExecuteErrorCallback(Error::SOCKET_CONNECT_FAILURE, std::nullopt);
+        FailReactorConnectionAttempt();
+        return;
+    }
+
+    // A close request has claimed the state, and its task closes the socket
+    if(not CompareAndSetClientState(ClientState::OPENING, ClientState::CONNECTED))
+    {
+        return;
+    }
+
+    // From here on the io_uring reports the socket's progress, so it no longer needs to be watched for readiness
+    if(m_reactor_uses_io_uring)
+    {
+        m_reactor->Unwatch(m_reactor_event_loop, m_client_file_descriptor);
+        m_reactor_watching_socket = false;
+        m_reactor_watched_events = 0;
+        SubmitReactorReceive();
+    }
+
+    m_connected_callback();
+    ResumeConnectAwaiters(true);
+
+    if(m_reconnecting)
+    {
+        EndReconnecting(true);
+    }
+
+    // Send whatever was queued while the connection was being established, or kept while reconnecting
+    FlushReactorTxPayloads();
+}
+
+void ApplicationClient::CloseReactorConnection(bool notify_disconnected, ClientState closed_client_state)
+{
+    CancelReactorConnectTimeout();
+
+    if(m_reactor_watching_socket)
     {
-        result = ConnectToUnixDomainSocketAddress();
+        m_reactor->Unwatch(m_reactor_event_loop, m_client_file_descriptor);
+        m_reactor_watching_socket = false;
+        m_reactor_watched_events = 0;
     }
 
-    return result;
+    CloseSocket(closed_client_state);
+
+    // The remainder of a partially sent payload can not be delivered on another connection, unless it is replayed after reconnecting.
+    // With a send still in flight, its completion takes care of this.
+    if(m_tx_payload_offset > 0 && not m_reactor_send_pending && not m_reconnecting)
+    {
+        FailFrontTxPayload();
+    }
+
+    ExecuteTxCompletions();
+
+    if(notify_disconnected)
+    {
+        ExecuteDisconnectedCallback();
+    }
 }
 
-bool ApplicationClient::ConnectToTcpIpv4Address()
+void ApplicationClient::FailReactorConnectionAttempt()
 {
-    sockaddr_in server_address {};
-    server_address.sin_family = AF_INET;
-    server_address.sin_port = htons(m_endpoint.port); // Server port
-    inet_pton(AF_INET, m_endpoint.ip_address.c_str(), &server_address.sin_addr); // Server IP
+    if(not m_reconnecting)
+    {
+        CloseReactorConnection(false);
+        return;
+    }
+
+    CloseReactorConnection(false, ClientState::RECONNECTING);
+    ScheduleReactorReconnect();
+}
 
-    if (connect(m_client_file_descriptor, (struct sockaddr*)&server_address, sizeof(server_address)) < 0) 
+void ApplicationClient::LoseReactorConnection()
+{
+    if(GetClientState() != ClientState::CONNECTED)
     {
-        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to connect to address: {"+m_endpoint.ip_address+":"+std::to_string(m_endpoint.port)+"}";
-        perror(error_message.c_str());
-        ExecuteErrorCallback(Error::SOCKET_CONNECT_FAILURE, std::nullopt);
-        return false;
+        return;
     }
 
-    m_connected_callback();
+    if(not m_options.reconnect.enabled)
+    {
+        CloseReactorConnection(true);
+        return;
+    }
 
-    return true;
+    BeginReconnecting();
+    CloseReactorConnection(true, ClientState::RECONNECTING);
+
+    // The disconnected callback may have cancelled reconnecting already
+    if(GetClientState() == ClientState::RECONNECTING)
+    {
+        ScheduleReactorReconnect();
+    }
 }
 
-bool ApplicationClient::ConnectToUnixDomainSocketAddress()
+void ApplicationClient::ScheduleReactorReconnect()
 {
-    sockaddr_un server_address {};
-    server_address.sun_family = AF_UNIX;
-    strncpy(server_address.sun_path, m_endpoint.unix_socket_path.c_str(), sizeof(server_address.sun_path) - 1);
+    const size_t max_attempts = m_options.reconnect.max_attempts;
+
+    if(max_attempts > 0 && m_reconnect_attempt >= max_attempts)
+    {
+        CloseSocket();
+        EndReconnecting(false);
+        ExecuteErrorCallback(Error::RECONNECT_FAILURE, std::nullopt);
+        return;
+    }
 
-    inet_pton(AF_INET, m_endpoint.ip_address.c_str(), &server_address.sun_path); // server unix domain socket path
+    m_reactor_reconnect_timer = m_reactor->PostAfter(m_reactor_event_loop, GetReconnectDelay(), [this](){ AttemptReactorReconnect(); });
+}
+
+void ApplicationClient::AttemptReactorReconnect()
+{
+    m_reactor_reconnect_timer = 0;
 
-    if (connect(m_client_file_descriptor, (struct sockaddr*)&server_address, sizeof(server_address)) < 0) 
+    // A close request cancels reconnecting by claiming the state first
+    if(not CompareAndSetClientState(ClientState::RECONNECTING, ClientState::OPENING))
     {
-        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to connect to address: {"+m_endpoint.ip_address+"}";
-        perror(error_message.c_str());
-        ExecuteErrorCallback(Error::SOCKET_CONNECT_FAILURE, std::nullopt);
-        return false;
+        return;
     }
 
-    m_connected_callback();
+    ++m_reconnect_attempt;
+    m_statistics.RecordReconnectAttempt();
 
-    return true;
+    OpenReactorConnection();
 }
 
-void ApplicationClient::CloseSocket()
+void ApplicationClient::CancelReactorReconnect()
 {
-    shutdown(m_client_file_descriptor, SHUT_RDWR);
-    close(m_client_file_descriptor);
-    SetClientState(ClientState::NOT_CONNECTED);
+    if(m_reactor_reconnect_timer != 0)
+    {
+        m_reactor->CancelTimer(m_reactor_event_loop, m_reactor_reconnect_timer);
+        m_reactor_reconnect_timer = 0;
+    }
 }
 
-void ApplicationClient::MonitorConnection()
+void ApplicationClient::TimeOutReactorConnection()
 {
-    SetMonitorWorkerThreadState(WorkerThreadState::RUNNING);
+    m_reactor_connect_timer = 0;
 
-    while(GetMonitorWorkerThreadState() != WorkerThreadState::ENDING)
+    if(GetClientState() != ClientState::OPENING)
     {
-        /*
-            Wait here for the following events:
-                1. Open the socket and connect
-                2. Close the socket
-                3. The worker thread is being signaled to shutdown
-        */
-        m_monitor_connection_semaphore.acquire();
+        return;
+    }
 
-        if(GetMonitorWorkerThreadState() == WorkerThreadState::ENDING)
+    errno = ETIMEDOUT;
+    const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to connect within " + std::to_string(m_options.connect.timeout.count()) + " ms";
+    perror(error_message.c_str());
+    ExecuteErrorCallback(Error::SOCKET_CONNECT_FAILURE, std::nullopt);
+    FailReactorConnectionAttempt();
+}
+
+void ApplicationClient::CancelReactorConnectTimeout()
+{
+    if(m_reactor_connect_timer != 0)
+    {
+        m_reactor->CancelTimer(m_reactor_event_loop, m_reactor_connect_timer);
+        m_reactor_connect_timer = 0;
+    }
+}
+
+void ApplicationClient::UpdateReactorWatch(bool wants_writable)
+{
+    if(not m_reactor_watching_socket || GetClientState() != ClientState::CONNECTED)
+    {
+        return;
+    }
+
+    const uint32_t events = (m_reactor_rx_paused ? 0 : static_cast<uint32_t>(EPOLLIN)) | (wants_writable ? static_cast<uint32_t>(EPOLLOUT) : 0);
+
+    if(events != m_reactor_watched_events)
+    {
+        m_reactor->Modify(m_reactor_event_loop, m_client_file_descriptor, events, this);
+        m_reactor_watched_events = events;
+    }
+}
+
+void ApplicationClient::FlushReactorTxPayloads()
+{
+    // Clear the flag before draining so that payloads enqueued from here on schedule another flush
+    m_reactor_tx_flush_posted = false;
+
+    // The payloads are sent once the connection attempt completes, and are kept for the new connection while reconnecting
+    if(GetClientState() == ClientState::OPENING || m_reconnecting)
+    {
+        return;
+    }
+
+    // The kernel still reads from the front payloads, so nothing may be popped until the send completes
+    if(m_reactor_send_pending)
+    {
+        return;
+    }
+
+    if(m_reactor_uses_io_uring && GetClientState() == ClientState::CONNECTED)
+    {
+        SubmitReactorSend();
+        ExecuteTxCompletions();
+        return;
+    }
+
+    bool is_waiting_for_writable = false;
+
+    PullTxPayloads();
+
+    while(not m_tx_in_flight.empty() && not is_waiting_for_writable)
+    {
+        const TxResult tx_result = SendNextPayloads(MSG_DONTWAIT | MSG_NOSIGNAL);
+
+        if(tx_result == TxResult::CONNECTION_LOST)
         {
-            break;
+            LoseReactorConnection();
+            ExecuteTxCompletions();
+            return;
         }
 
-        if(GetClientState() == ClientState::OPENING)
+        is_waiting_for_writable = tx_result == TxResult::WOULD_BLOCK;
+        PullTxPayloads();
+    }
+
+    // Resume once the kernel has room in the socket's send buffer
+    UpdateReactorWatch(is_waiting_for_writable);
+
+    ExecuteTxCompletions();
+}
+
+void ApplicationClient::ReceiveReactorPayloads()
+{
+    for(size_t read_count = 0; read_count < MAX_REACTOR_READS_PER_EVENT; ++read_count)
+    {
+        PrepareRxBuffer();
+
+        const ssize_t read_bytes = ReceiveRxBytes(MSG_DONTWAIT);
+
+        m_statistics.RecordRecv(read_bytes);
+
+        // The server closed the connection in this case
+        if(read_bytes == 0)
         {
-            // If the connection is succesful then the client state will transition to CONNECTED, which happens inside OpenConnection()
-            if(not OpenConnection())
+            DeliverRxBatch();
+            LoseReactorConnection();
+            return;
+        }
+
+        if(read_bytes < 0)
+        {
+            if(errno == EAGAIN || errno == EWOULDBLOCK)
             {
-                // If opening a connection fails, then close the file descriptor and transition back to the NOT_CONNECTED state, which happens inside CloseSocket()
-                CloseSocket();
+                DeliverRxBatch();
+                return;
             }
+
+            if(errno == EINTR)
+            {
+                continue;
+            }
+
+            const int read_error = errno;
+            DeliverRxBatch();
+            errno = read_error;
+
+            const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to read!";
+            perror(error_message.c_str());
+            ExecuteErrorCallback(Error::SOCKET_READ_FAILURE, std::nullopt);
+
+            // A level-triggered event loop would report the broken socket forever, so drop the connection
+            LoseReactorConnection();
+            return;
         }
-        else if(GetClientState() == ClientState::CLOSING)
+
+        const bool is_drained = IsRxDrained(read_bytes);
+
+        if(not DeliverRxBytes(read_bytes))
         {
-            CloseSocket();
-            ExecuteDisconnectedCallback();
+            DeliverRxBatch();
+            LoseReactorConnection();
+            return;
+        }
+
+        // The RX dispatch queue is full, so the socket is left to back up until the executor has made room
+        if(m_rx_dispatch_paused)
+        {
+            DeliverRxBatch();
+            PauseReactorReceive();
+            return;
+        }
+
+        // Stop early if the callback requested a close or the socket has been drained
+        if(GetClientState() != ClientState::CONNECTED || is_drained)
+        {
+            DeliverRxBatch();
+            return;
         }
     }
 
-    CloseSocket();
+    DeliverRxBatch();
+}
 
-    SetMonitorWorkerThreadState(WorkerThreadState::INACTIVE);
+void ApplicationClient::PauseReactorReceive()
+{
+    m_reactor_rx_paused = true;
+
+    // The io_uring receive is simply not submitted again
+    if(not m_reactor_uses_io_uring)
+    {
+        UpdateReactorWatch((m_reactor_watched_events & EPOLLOUT) != 0);
+    }
 }
 
-void ApplicationClient::ProcessTxPayloads()
+void ApplicationClient::ResumeReactorReceive()
 {
-    SetTxWorkerThreadState(WorkerThreadState::RUNNING);
+    // The queue may have filled up again before this task got to run
+    if(not m_reactor_rx_paused || m_rx_dispatch_paused)
+    {
+        return;
+    }
 
-    while(GetTxWorkerThreadState() != WorkerThreadState::ENDING)
+    m_reactor_rx_paused = false;
+
+    if(GetClientState() != ClientState::CONNECTED)
     {
-        /* Wait here until signaled to resume: This happens in the following cases:
-            1. The TX payload queue is no longer empty
-            2. This worker thread is being told to shut down
-        */
-        m_process_tx_payloads_semaphore.acquire();
+        return;
+    }
 
-        if(GetTxWorkerThreadState() == WorkerThreadState::ENDING)
-        {
-            break;
-        }
+    if(m_reactor_uses_io_uring)
+    {
+        SubmitReactorReceive();
+    }
+    else
+    {
+        UpdateReactorWatch((m_reactor_watched_events & EPOLLOUT) != 0);
+    }
+}
+
+void ApplicationClient::OnReactorCompletion(ReactorOperation operation, uint16_t tag, int32_t result)
+{
+    --m_reactor_pending_operations;
 
-        std::lock_guard<std::mutex> lock(m_tx_queue_mutex);
+    // A completion can arrive after its connection was closed, or even replaced by a new one
+    const bool is_current_connection = tag == GetReactorConnectionTag() && GetClientState() == ClientState::CONNECTED;
 
-        while(not m_tx_queue.empty())
-        {
-            SendNextPayload();
-        }
+    if(operation == ReactorOperation::RECEIVE)
+    {
+        CompleteReactorReceive(result, is_current_connection);
     }
+    else if(operation == ReactorOperation::SEND)
+    {
+        CompleteReactorSend(result, is_current_connection);
+    }
+}
 
-    SetTxWorkerThreadState(WorkerThreadState::INACTIVE);
+uint16_t ApplicationClient::GetReactorConnectionTag() const
+{
+    // The reactor only passes back the lower 12 bits of a tag
+    return static_cast<uint16_t>(m_connection_generation.load() & 0xFFF);
 }
 
-bool ApplicationClient::SendNextPayload()
+void ApplicationClient::SubmitReactorReceive()
 {
-    std::vector<char> tx_payload = m_tx_queue.front();
-    m_tx_queue.pop_front();
-    std::span<char> tx_payload_view (tx_payload.begin(),tx_payload.end());
+    if(m_reactor_receive_pending || m_reactor_rx_paused)
+    {
+        return;
+    }
+
+    PrepareRxBuffer();
 
-    while(not tx_payload_view.empty())
+    m_reactor_receive_pending = m_reactor->SubmitReceive(m_reactor_event_loop, m_client_file_descriptor, m_rx_buffer.GetBytes(), this, GetReactorConnectionTag());
+
+    if(m_reactor_receive_pending)
     {
-        const ssize_t sent_bytes = send(m_client_file_descriptor,tx_payload_view.data(), tx_payload_view.size(),0);
+        ++m_reactor_pending_operations;
+    }
+}
 
-        if(sent_bytes < 0)
-        {
-            const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to send payload!";
-            perror(error_message.c_str());
-            ExecuteErrorCallback(Error::SOCKET_SEND_FAILURE, tx_payload_view);
-            return false;
-        }
+void ApplicationClient::SubmitReactorSend()
+{
+    PullTxPayloads();
 
-        tx_payload_view = tx_payload_view.subspan(sent_bytes,tx_payload_view.size()-sent_bytes);
+    if(m_tx_in_flight.empty())
+    {
+        return;
+    }
+
+    m_reactor_send_bytes = GatherTxPayloads();
+
+    m_tx_message = msghdr {};
+    m_tx_message.msg_iov = m_tx_iovecs.data();
+    m_tx_message.msg_iovlen = m_tx_iovecs.size();
+    AttachTxMemfds(m_tx_message);
+
+    m_reactor_send_pending = m_reactor->SubmitSend(m_reactor_event_loop, m_client_file_descriptor, &m_tx_message, MSG_NOSIGNAL, this, GetReactorConnectionTag());
+
+    if(m_reactor_send_pending)
+    {
+        ++m_reactor_pending_operations;
     }
-    
-    return true;
 }
 
-void ApplicationClient::ProcessRxPayloads()
+void ApplicationClient::CompleteReactorReceive(int32_t result, bool is_current_connection)
 {
-    SetRxWorkerThreadState(WorkerThreadState::RUNNING);
+    m_reactor_receive_pending = false;
 
-    while(GetRxWorkerThreadState() != WorkerThreadState::ENDING)
+    // The bytes of a closed connection are dropped, but a new connection may have been waiting for the RX buffer
+    if(not is_current_connection)
     {
-        if(GetClientState() != ClientState::CONNECTED)
+        if(GetClientState() == ClientState::CONNECTED)
         {
-            if(GetRxWorkerThreadState() == WorkerThreadState::ENDING)
-            {
-                break;
-            }
+            SubmitReactorReceive();
+        }
 
-            // FIXME: Implement a non-polling alternative so that this thread is resumed upon a connection being established
-            std::this_thread::sleep_for(RX_CONNECTION_POLL_INTERVAL);
+        return;
+    }
 
-            continue;
+    m_statistics.RecordRecv(result);
+
+    // The server closed the connection in this case
+    if(result == 0)
+    {
+        LoseReactorConnection();
+        return;
+    }
+
+    if(result < 0)
+    {
+        if(result == -EINTR || result == -EAGAIN)
+        {
+            SubmitReactorReceive();
+            return;
         }
 
-        std::vector<char> rx_buffer(RX_BUFFER_SIZE);
+        errno = -result;
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to read!";
+        perror(error_message.c_str());
+        ExecuteErrorCallback(Error::SOCKET_READ_FAILURE, std::nullopt);
+        LoseReactorConnection();
+        return;
+    }
+
+    // Every completion is a read of its own, so its messages make up a batch
+    const bool is_delivered = DeliverRxBytes(result);
+    DeliverRxBatch();
 
-        const ssize_t read_bytes = recv(m_client_file_descriptor, rx_buffer.data(), rx_buffer.size(), 0);
+    if(not is_delivered)
+    {
+        LoseReactorConnection();
+        return;
+    }
 
-        // The server closed the connection in this case
-        if(read_bytes == 0)
+    if(m_rx_dispatch_paused)
+    {
+        PauseReactorReceive();
+        return;
+    }
+
+    // The callback may have requested a close
+    if(GetClientState() == ClientState::CONNECTED)
+    {
+        SubmitReactorReceive();
+    }
+}
+
+void ApplicationClient::CompleteReactorSend(int32_t result, bool is_current_connection)
+{
+    m_reactor_send_pending = false;
+
+    m_statistics.RecordSend(m_reactor_send_bytes, result);
+
+    if(result > 0)
+    {
+        MarkTxMemfdsPassed();
+    }
+
+    if(result >= 0)
+    {
+        // The bytes have left, even if the connection they were sent on is gone by now
+        ConsumeSentBytes(result);
+    }
+    else if(is_current_connection)
+    {
+        errno = -result;
+
+        if(CompleteTxSend(-1) == TxResult::CONNECTION_LOST)
         {
-            // If the connection was closed by the server and the client still thinks it is in the connected state, then take action to clean up the socket on the client's side
-            if(GetClientState() == ClientState::CONNECTED)
-            {
-                // In this case, the connection has ended so instruct the state machine to close and clean up the socket properly and transition to the not-connected state
-                CloseSocket();
-                ExecuteDisconnectedCallback();
-            }
+            LoseReactorConnection();
+            return;
         }
-        // An error occured while reading
-        else if(read_bytes < 0)
+    }
+
+    if(not is_current_connection)
+    {
+        // The remainder of a partially sent payload can not be delivered on another connection, unless it is replayed after reconnecting
+        if(m_tx_payload_offset > 0 && not m_reconnecting)
         {
-            const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to read!";
-            perror(error_message.c_str());
-            ExecuteErrorCallback(Error::SOCKET_READ_FAILURE, std::nullopt);
+            FailFrontTxPayload();
         }
-        // Message data was received from the socket
-        else
+
+        ExecuteTxCompletions();
+
+        if(GetClientState() != ClientState::CONNECTED)
         {
-            const std::span<char> rx_buffer_view(rx_buffer.data(), read_bytes);
-            m_rx_callback(rx_buffer_view);
+            return;
         }
     }
 
-    SetRxWorkerThreadState(WorkerThreadState::INACTIVE);
+    FlushReactorTxPayloads();
 }
 
-} // namespace InterProcessCommunication
\ No newline at end of file
+} // namespace InterProcessCommunication
@@ -1,19 +1,40 @@
 
+#pragma once
+
+#include "callback_executor.h"
+#include "client_error.h"
+#include "client_options.h"
+#include "client_reactor.h"
+#include "client_statistics.h"
+#include "memfd_payload.h"
+#include "message_framing.h"
+#include "mpsc_queue.h"
+#include "rx_buffer_pool.h"
+#include "shared_memory_channel.h"
 #include <vector>
+#include <array>
+#include <atomic>
 #include <functional>
 #include <span>
-#include <list>
+#include <deque>
 #include <optional>
 #include <string>
 #include <thread>
 #include <shared_mutex>
 #include <mutex>
+#include <condition_variable>
 #include <arpa/inet.h>
+#include <sys/socket.h>
 #include <sys/un.h>
+#include <sys/uio.h>
 #include <iostream>
 #include <cstring>
 #include <semaphore>
 #include <chrono>
+#include <memory>
+#include <variant>
+#include <random>
+#include <coroutine>
 
 namespace InterProcessCommunication
 {
@@ -23,24 +44,60 @@ enum class ClientState
     NOT_CONNECTED,
     OPENING,
     CONNECTED,
-    CLOSING
-};
-
-enum class Error
-{
-    SOCKET_OPEN_FAILURE,
-    SOCKET_CLOSE_FAILURE,
-    SOCKET_SEND_FAILURE,
-    SOCKET_READ_FAILURE,
-    SOCKET_CONNECT_FAILURE
+    CLOSING,
+    // The connection was lost and the client is waiting to reconnect (see ReconnectOptions). Each attempt goes through OPENING.
+    RECONNECTING
 };
 
 using ErrorCallback = std::function<void(const Error& error, const std::optional<std::span<char>>& failed_tx_payload)>;
 using ConnectedCallback = std::function<void()>;
 using DisconnectedCallback = std::function<void()>;
+/*
+    \brief Invoked with the received bytes, or with one whole message at a time when framing is enabled
+*/
 using RxCallback = std::function<void(const std::span<char>& rx_bytes)>;
+/*
+    \brief Invoked with the pooled buffer that rx_bytes points into. Copying rx_buffer keeps the bytes alive after the callback returns, without copying them.
+*/
+using RxBufferCallback = std::function<void(const RxBufferRef& rx_buffer, const std::span<char>& rx_bytes)>;
+/*
+    \brief Invoked once per enqueued payload: with true after the kernel has accepted all of its bytes, or with false when the payload was dropped (send failure or ClearOutboundPayloads())
+*/
+using TxCompletionCallback = std::function<void(bool is_sent)>;
+/*
+    \brief An immutable, reference counted payload that can be enqueued on any number of clients without being copied
+*/
+using SharedPayload = std::shared_ptr<const std::vector<char>>;
+/*
+    \brief Invoked when the queued TX bytes cross a watermark (see TxQueueOptions). The high watermark callback runs on the producer thread that crossed it,
+        the low watermark callback usually on the TX consumer's thread. The two always alternate, starting with the high watermark.
+*/
+using TxWatermarkCallback = std::function<void()>;
+
+/*
+    \brief A message handed to a coroutine by ApplicationClient::Receive(), or to an RxBatchCallback. It shares the pooled RX buffer that the bytes lie in, so the bytes stay valid for as long as the message is kept.
+        The message is empty when the connection ended while the coroutine was waiting.
+*/
+struct RxMessage
+{
+    RxBufferRef buffer;
+    std::span<char> bytes;
+};
+
+/*
+    \brief Invoked with every message that one pass of the RX consumer gathered (see RxBatchOptions), oldest first. Copying a message keeps its bytes alive after the callback returns.
+*/
+using RxBatchCallback = std::function<void(std::span<const RxMessage> rx_messages)>;
 
-class ApplicationClient
+/*
+    \brief Names the shared memory segment of a SharedMemoryPeer on the same host, for a client that exchanges its bytes through the segment's rings instead of a socket
+*/
+struct SharedMemoryEndpoint
+{
+    std::string name;
+};
+
+class ApplicationClient : private ReactorEventHandler
 {
 public:
 
@@ -49,13 +106,32 @@ public:
     ApplicationClient(ApplicationClient&&) = delete;
     ApplicationClient& operator=(ApplicationClient&&) = delete;
     ~ApplicationClient();
-    ApplicationClient(const std::string& ipv4_address, uint16_t port);
-    ApplicationClient(const std::string& unix_socket_path);
+    ApplicationClient(const std::string& ipv4_address, uint16_t port, const ClientOptions& options = {});
+    /*
+        \brief The socket type of a unix domain client, and with it whether message boundaries are kept, follows ClientOptions::unix_socket
+    */
+    ApplicationClient(const std::string& unix_socket_path, const ClientOptions& options = {});
+    /*
+        \brief A client of a shared memory segment sends and receives through worker threads only, and Start(ClientReactor&) fails for it.
+            Socket options, zero-copy sends and memfd transfer do not apply to it. Each connection attaches to a session of its own,
+            so the peer has to create the segment anew before the client can reconnect.
+    */
+    ApplicationClient(const SharedMemoryEndpoint& shared_memory_endpoint, const ClientOptions& options = {});
 
     void SetConnectionCallback(ConnectedCallback callback);
     void SetDisconnectedCallback(DisconnectedCallback callback);
     void SetRxCallback(RxCallback callback);
+    /*
+        \brief This function sets a callback that is invoked instead of the RxCallback, for receivers that want to retain RX buffers
+    */
+    void SetRxBufferCallback(RxBufferCallback callback);
+    /*
+        \brief This function sets a callback that is invoked instead of the other RX callbacks, with all the messages that are available at once
+    */
+    void SetRxBatchCallback(RxBatchCallback callback);
     void SetErrorCallback(ErrorCallback callback);
+    void SetTxHighWatermarkCallback(TxWatermarkCallback callback);
+    void SetTxLowWatermarkCallback(TxWatermarkCallback callback);
 
     /*
         \brief This function starts the worker threads that are responsible for:
@@ -65,14 +141,88 @@ public:
     */
     bool Start();
     /*
-        \brief This function reports whether all of the worker threads are running and ready to do work
+        \brief This function registers the client with a shared reactor instead of starting worker threads.
+            The reactor's event loop drives connecting, sending and receiving without blocking, and all callbacks are executed on that event loop's thread.
+            With the reactor's IO_URING backend, receives and sends are submitted to the event loop's io_uring, and the client must not be destroyed on that event loop's thread.
+    */
+    bool Start(ClientReactor& reactor);
+    /*
+        \brief This function reports whether all of the worker threads (or the reactor) are running and ready to do work
     */
     bool IsRunning() const;
     ClientState GetClientState() const;
     bool RequestOpen();
+    /*
+        \brief This function closes the connection, or cancels a connection attempt that is in progress or reconnecting.
+            Cancelling an attempt does not call the disconnected callback, since the client never connected.
+    */
     bool RequestClose();
-    bool EnqueuePayload(const std::span<char>& tx_bytes);
+    /*
+        \brief This function copies the payload into the TX queue
+    */
+    bool EnqueuePayload(const std::span<char>& tx_bytes, TxCompletionCallback completion_callback = nullptr, size_t lane = 0);
+    /*
+        \brief When framing is enabled, each payload is sent as one frame, and payloads that exceed the maximum frame size are rejected.
+            When TX lanes are enabled, the payload is queued on the given lane, and a lane outside of TxLaneOptions::lane_count is rejected (as is any lane but 0 without lanes).
+            The following functions take ownership of (or a reference to) the payload, so its bytes are never copied in user space before being handed to the kernel
+    */
+    bool EnqueuePayload(std::vector<char>&& tx_bytes, TxCompletionCallback completion_callback = nullptr, size_t lane = 0);
+    bool EnqueuePayload(std::unique_ptr<char[]> tx_bytes, size_t size, TxCompletionCallback completion_callback = nullptr, size_t lane = 0);
+    bool EnqueuePayload(SharedPayload tx_bytes, TxCompletionCallback completion_callback = nullptr, size_t lane = 0);
+    /*
+        \brief This function seals the memfd and passes it to the peer as a descriptor when memfd transfer applies (see MemfdTransferOptions),
+            regardless of its size. Otherwise the payload is sent inline from its mapping, and a payload that is already sealed is rejected.
+    */
+    bool EnqueuePayload(MemfdPayload tx_bytes, TxCompletionCallback completion_callback = nullptr, size_t lane = 0);
+    /*
+        \brief The following functions enqueue the payload like EnqueuePayload(), except that they fail right away instead of waiting when the TX queue is full
+    */
+    bool TryEnqueuePayload(const std::span<char>& tx_bytes, TxCompletionCallback completion_callback = nullptr, size_t lane = 0);
+    bool TryEnqueuePayload(std::vector<char>&& tx_bytes, TxCompletionCallback completion_callback = nullptr, size_t lane = 0);
+    bool TryEnqueuePayload(std::unique_ptr<char[]> tx_bytes, size_t size, TxCompletionCallback completion_callback = nullptr, size_t lane = 0);
+    bool TryEnqueuePayload(SharedPayload tx_bytes, TxCompletionCallback completion_callback = nullptr, size_t lane = 0);
+    /*
+        \brief This function drops every payload that was enqueued before the call, except one that is already partially sent (with TX lanes, one whose chunks have started to go out).
+            The payloads are discarded by the TX worker (or the reactor's event loop), which reports them to their completion callbacks as not sent.
+    */
     void ClearOutboundPayloads();
+    /*
+        \brief This function returns a snapshot of the client's runtime statistics. It is safe to call from any thread, while the client is running.
+    */
+    ClientStatistics GetStatistics() const;
+    /*
+        \brief This function returns the number of payloads that wait in the TX queue, without taking a statistics snapshot. The depth is only tracked
+            when the TX queue is bounded (see TxQueueOptions) or statistics are compiled in, and is zero otherwise.
+    */
+    size_t GetTxQueueDepth() const;
+
+    /*
+        \brief Awaitables for C++20 coroutines (see ClientTask). They suspend the coroutine without blocking a thread, and the client resumes it on the thread that completes
+            the operation: the connection monitor thread (or the reactor's event loop) for Connect(), the TX consumer for Send() and the RX consumer for Receive().
+            A coroutine must not be left suspended on a client that is destroyed.
+    */
+    class ConnectAwaitable;
+    class SendAwaitable;
+    class ReceiveAwaitable;
+
+    /*
+        \brief This function requests a connection and resumes with true once the client is connected, or with false if the attempt failed or was cancelled.
+            An attempt that is already in progress (or reconnecting) is awaited instead of starting another one. Like Receive(), it switches the client over to
+            coroutine delivery, so a reply that arrives before the coroutine has come around to Receive() is not lost to the RX callbacks.
+    */
+    ConnectAwaitable Connect();
+    /*
+        \brief This function enqueues the payload like EnqueuePayload() and resumes with its completion status. The span's bytes are borrowed rather than copied,
+            since the coroutine stays suspended until the client is done with them.
+    */
+    SendAwaitable Send(std::span<const char> tx_bytes, size_t lane = 0);
+    SendAwaitable Send(std::vector<char>&& tx_bytes, size_t lane = 0);
+    SendAwaitable Send(SharedPayload tx_bytes, size_t lane = 0);
+    /*
+        \brief This function resumes with the next received message (a whole frame when framing is enabled), or with an empty one once the connection has ended.
+            From the first call to it (or to Connect()) on, the RX callbacks are no longer invoked, and messages that arrive while no coroutine is waiting are queued for the next call.
+    */
+    ReceiveAwaitable Receive();
 
 private:
 
@@ -82,6 +232,8 @@ private:
     {
         TCP_IPV4,
         UNIX_DOMAIN,
+        UNIX_SEQPACKET,
+        SHARED_MEMORY,
         UNDEFINED
     };
 
@@ -91,6 +243,75 @@ private:
         std::string ip_address = "0.0.0.0";
         uint16_t port = 0;
         std::string unix_socket_path = "/";
+        std::string shared_memory_name = "/";
+    };
+
+    enum class TxResult
+    {
+        SENT,
+        WOULD_BLOCK,
+        FAILED,
+        // The send failed because the connection is gone, and the payload is kept for the next connection
+        CONNECTION_LOST
+    };
+
+    struct TxPayload
+    {
+        std::variant<std::vector<char>, std::unique_ptr<char[]>, SharedPayload, MemfdPayload> storage {};
+        // A view of the bytes held by the storage. It is never written through, even when the storage is a SharedPayload.
+        std::span<char> bytes {};
+        TxCompletionCallback completion_callback {};
+        // The value of m_tx_clear_generation when the payload was enqueued
+        uint64_t clear_generation = 0;
+        // Only set when latency histograms are recorded
+        uint64_t enqueue_timestamp = 0;
+        // The length header that precedes the bytes on the wire when framing is enabled. It is sent from its own iovec.
+        FrameHeader frame_header {};
+        size_t frame_header_size = 0;
+        // The sequence number of the last zero-copy send that included any of the bytes. The storage is retained until the kernel has reported that send.
+        std::optional<uint32_t> zero_copy_sequence {};
+        // Only used with TX lanes, where the frame header holds a chunk header instead. A lane chunk is a view into a payload that its lane holds
+        // until the last chunk has been sent, so the chunk owns nothing and only completing the last one completes the payload.
+        size_t lane = 0;
+        bool is_lane_chunk = false;
+        // Set when the bytes belong to a coroutine that awaits the send (see Send()). They are only valid until the completion, so they are never sent with MSG_ZEROCOPY.
+        bool is_borrowed = false;
+        // Set when the storage is a sealed memfd that goes to the peer as a descriptor (see MemfdTransferOptions). The frame header then marks a memfd frame
+        // and there are no bytes. The descriptor is passed with the first send that includes any of the header, and must not be passed twice on one connection.
+        bool is_memfd_frame = false;
+        bool is_memfd_passed = false;
+
+        size_t GetFrameSize() const
+        {
+            return frame_header_size + bytes.size();
+        }
+    };
+
+    // The TX consumer's state of a lane. Only one payload per lane is cut into chunks at a time, so the peer never sees two messages of the same lane interleaved.
+    struct TxLane
+    {
+        // The payload that is being cut into chunks. A payload that fits into a single chunk is handed over whole instead.
+        std::optional<TxPayload> payload;
+        size_t cut_bytes = 0;
+        size_t sent_bytes = 0;
+        // The last zero-copy send of any chunk that has left m_tx_in_flight
+        std::optional<uint32_t> zero_copy_sequence;
+        // The bytes the lane may still send in the current round of WEIGHTED scheduling
+        size_t deficit = 0;
+    };
+
+    // A received message that waits for the executor (see RxDispatchOptions), along with the latency timestamp of the read that completed it
+    struct RxDispatchedMessage
+    {
+        RxBufferRef buffer;
+        std::span<char> bytes;
+        uint64_t read_timestamp = 0;
+    };
+
+    struct TxCompletion
+    {
+        TxCompletionCallback callback;
+        bool is_sent = false;
     };
 
     enum class WorkerThreadState
@@ -101,28 +322,170 @@ private:
         INACTIVE
     };
 
-    static constexpr size_t RX_BUFFER_SIZE = 1024;
-    static constexpr std::chrono::milliseconds RX_CONNECTION_POLL_INTERVAL { 1 };
     static constexpr int DEFAULT_FILE_DESCRIPTOR { -1 };
+    static constexpr size_t MAX_REACTOR_READS_PER_EVENT { 16 };
+    // The kernel's SCM_MAX_FD, which it does not export: the most descriptors that one message can pass
+    static constexpr size_t MAX_MEMFDS_PER_MESSAGE { 253 };
+    // Set in the queued TX bytes while they are above the high watermark, so that a crossing is decided by the same atomic update that moves the bytes
+    static constexpr uint64_t TX_QUEUE_ABOVE_HIGH_WATERMARK { uint64_t { 1 } << 63 };
+    // The messages that one executor task delivers before it hands its thread back and queues another task
+    static constexpr size_t MAX_RX_DISPATCH_MESSAGES_PER_TASK { 64 };
+    // How often an idle TX worker thread checks for zero-copy reports while sends are still unreported
+    static constexpr std::chrono::milliseconds ZERO_COPY_REPORT_POLL_INTERVAL { 1 };
 
     Endpoint m_endpoint;
+    const ClientOptions m_options;
+    // Decided once on construction (see MemfdTransferOptions and UnixSocketOptions)
+    const bool m_memfd_transfer_enabled;
+    const bool m_framing_enabled;
     ClientState m_client_state { ClientState::NOT_CONNECTED };
 
     mutable std::shared_mutex m_client_state_mutex;
-    std::list<std::vector<char>> m_tx_queue;
-    std::mutex m_tx_queue_mutex;
+    // Producers push onto the lock-free queues and never wait for the network. Only the TX consumer (the TX worker thread or the reactor's event loop) pops from them.
+    // There is one queue per TX lane, or a single one when lanes are disabled.
+    std::deque<MpscQueue<TxPayload>> m_tx_queues = std::deque<MpscQueue<TxPayload>>(GetTxLaneCount(m_options.tx_lanes));
+    std::atomic<uint64_t> m_tx_clear_generation { 0 };
+    // The following are only maintained when TxQueueOptions bounds the queue or sets a high watermark. Producers reserve room before pushing, and the TX consumer gives it back as it pops.
+    std::atomic<size_t> m_tx_queued_payloads { 0 };
+    std::atomic<uint64_t> m_tx_queued_bytes { 0 };
+    std::mutex m_tx_queue_space_mutex;
+    std::condition_variable m_tx_queue_space_condition;
+    std::atomic<size_t> m_tx_queue_space_waiters { 0 };
+    // Only locked with the DROP_OLDEST policy, where producers pop the oldest payloads themselves. Their completions are handed to the TX consumer to execute.
+    std::mutex m_tx_queue_pop_mutex;
+    std::vector<TxCompletion> m_tx_dropped_completions;
+    TxWatermarkCallback m_tx_high_watermark_callback = [](){};
+    TxWatermarkCallback m_tx_low_watermark_callback = [](){};
+    // Recursive, since a watermark callback may enqueue a payload that crosses the other watermark
+    std::recursive_mutex m_tx_watermark_callback_mutex;
+    std::atomic<bool> m_tx_reported_above_high_watermark { false };
+    // The following are only touched by the TX consumer: the payloads pulled off the queue for the next sends (the front one may be partially sent),
+    // the number of bytes of the front payload that have already been sent, the gather list for the next send and the completions of finished payloads
+    std::deque<TxPayload> m_tx_in_flight;
+    size_t m_tx_payload_offset { 0 };
+    uint64_t m_tx_applied_clear_generation { 0 };
+    std::vector<iovec> m_tx_iovecs;
+    // Only used with SEQPACKET sockets, where every gathered payload goes as a message of its own that points into the gather list
+    std::vector<mmsghdr> m_tx_messages;
+    // Set when the gather list includes borrowed bytes, which rules out a zero-copy send
+    bool m_tx_iovecs_borrowed { false };
+    // The memfds of the gathered memfd frames that have not been passed yet, and the control message that passes them
+    std::vector<int> m_tx_memfds;
+    alignas(cmsghdr) std::array<char, CMSG_SPACE(sizeof(int) * MAX_MEMFDS_PER_MESSAGE)> m_tx_memfd_control {};
+    std::vector<TxCompletion> m_tx_completions;
+    std::vector<TxCompletion> m_tx_completions_executing;
+    // Only touched by the TX consumer, and only used when TX lanes are enabled
+    std::vector<TxLane> m_tx_lanes = std::vector<TxLane>(m_options.tx_lanes.enabled ? m_tx_queues.size() : 0);
+    size_t m_tx_scheduled_lane { 0 };
+    // Set when the current socket accepted SO_ZEROCOPY
+    std::atomic<bool> m_zero_copy_socket { false };
+    // The following are only touched by the TX consumer. Zero-copy sends are numbered per socket, and completed payloads that were part of one are retained
+    // until the kernel has reported every send up to and including their last one. The reports may arrive out of order.
+    uint64_t m_tx_zero_copy_connection_generation { 0 };
+    bool m_tx_zero_copy_fallback { false };
+    uint32_t m_tx_zero_copy_next_sequence { 0 };
+    uint32_t m_tx_zero_copy_completed_sequence { 0 };
+    std::vector<std::pair<uint32_t, uint32_t>> m_tx_zero_copy_reported_ranges;
+    std::deque<TxPayload> m_tx_zero_copy_retained;
     ConnectedCallback m_connected_callback = [](){};
     DisconnectedCallback m_disconnected_callback = [](){};
     std::mutex m_disconnected_callback_mutex;
     RxCallback m_rx_callback = [](const std::span<char>& rx_bytes){(void)rx_bytes;};
+    RxBufferCallback m_rx_buffer_callback;
+    RxBatchCallback m_rx_batch_callback;
+    // Only touched by the RX consumer. The messages of the batch that is being gathered, along with the latency timestamps of the reads that completed them.
+    std::vector<RxMessage> m_rx_batch;
+    std::vector<uint64_t> m_rx_batch_read_timestamps;
+    // Only touched by the RX consumer (the RX worker thread or the reactor's event loop). The current buffer is reused for every read unless a callback retained it.
+    const std::shared_ptr<RxBufferPool> m_rx_buffer_pool;
+    RxBufferRef m_rx_buffer;
+    // Only used with SEQPACKET sockets. Every message of a batch is read into a buffer of its own, which is reused like the current buffer.
+    // Only the buffers of the messages that the last read filled need replacing, unless the pool has grown its buffers since they were acquired.
+    std::vector<RxBufferRef> m_rx_message_buffers;
+    std::vector<iovec> m_rx_message_iovecs;
+    std::vector<mmsghdr> m_rx_messages;
+    size_t m_rx_message_count { 0 };
+    size_t m_rx_message_buffer_size { 0 };
+    // Only used with RX dispatch. At most one task of this client is handed over to the executor at a time, which is what keeps its messages in order.
+    // The destructor stops the dispatch and waits until no task is handed over any more, since a task refers to the client.
+    const std::shared_ptr<CallbackExecutor> m_rx_executor;
+    std::mutex m_rx_dispatch_mutex;
+    // Bumped under the mutex whenever the executor makes room or a task ends, and on stopping. The RX consumer and the destructor wait on it for those.
+    std::atomic<uint64_t> m_rx_dispatch_generation { 0 };
+    std::deque<RxDispatchedMessage> m_rx_dispatch_queue;
+    // Only touched by the task that is handed over, which gathers the queued messages here for the batch callback
+    std::vector<RxMessage> m_rx_dispatch_batch;
+    std::vector<uint64_t> m_rx_dispatch_batch_read_timestamps;
+    size_t m_rx_dispatch_queued_bytes { 0 };
+    bool m_rx_dispatch_scheduled { false };
+    bool m_rx_dispatch_stopped { false };
+    // Only used in reactor mode. Set under the mutex once the queue is full, and cleared by the task that makes room again, which posts the resume of reading.
+    std::atomic<bool> m_rx_dispatch_paused { false };
+    // The latency timestamp of the read whose bytes are being delivered
+    uint64_t m_rx_read_timestamp { 0 };
+    // Only set when framing is enabled. The decoder is reset whenever the RX consumer finds that the connection generation has changed.
+    std::unique_ptr<FrameDecoder> m_rx_frame_decoder;
+    // Only used with memfd transfer. The received memfds wait here for their frames, which never arrive ahead of them.
+    std::deque<int> m_rx_memfds;
+    alignas(cmsghdr) std::array<char, CMSG_SPACE(sizeof(int) * MAX_MEMFDS_PER_MESSAGE)> m_rx_memfd_control {};
+    // Set when the kernel had to drop received descriptors, after which the memfds no longer match their frames
+    bool m_rx_memfds_lost { false };
+    // Set when a memfd frame has failed and been reported, so that the decoder's failure is not reported again
+    bool m_rx_memfd_failed { false };
+    // Incremented on every established connection. The RX worker thread waits on it while the client is not connected.
+    std::atomic<uint64_t> m_connection_generation { 0 };
+    uint64_t m_rx_connection_generation { 0 };
+    // Set from the moment an established connection is lost until reconnecting succeeds or ends. The TX consumer keeps its payloads while it is set.
+    std::atomic<bool> m_reconnecting { false };
+    // The following are only touched by the thread that reconnects (the connection monitor thread or the reactor's event loop),
+    // except that in worker thread mode the thread that noticed the loss hands them over through the connection monitor semaphore
+    size_t m_reconnect_attempt { 0 };
+    std::chrono::steady_clock::time_point m_connection_lost_time;
+    std::minstd_rand m_reconnect_random_engine { std::random_device{}() };
+    ReactorTimerId m_reactor_reconnect_timer { 0 };
+    ReactorTimerId m_reactor_connect_timer { 0 };
+    // The connection generation of the TX consumer's last send, which tells it when a partially sent payload has to be sent again
+    uint64_t m_tx_connection_generation { 0 };
+    // Coroutines waiting in Connect() and Receive(), and the messages that arrived while no coroutine was waiting in Receive()
+    std::vector<ConnectAwaitable*> m_connect_awaiters;
+    std::mutex m_connect_awaiters_mutex;
+    std::atomic<bool> m_rx_awaited { false };
+    std::deque<ReceiveAwaitable*> m_rx_awaiters;
+    std::deque<RxMessage> m_rx_awaited_messages;
+    std::mutex m_rx_awaiters_mutex;
     ErrorCallback m_error_callback = [](const Error& error, const std::optional<std::span<char>>& failed_tx_payload){(void)error; (void)failed_tx_payload;};
     std::mutex m_error_callback_mutex;
-    int m_client_file_descriptor { DEFAULT_FILE_DESCRIPTOR };
+    // In SHARED_MEMORY mode the descriptor is that of the shared memory object, and only marks that a connection is open
+    std::atomic<int> m_client_file_descriptor { DEFAULT_FILE_DESCRIPTOR };
+    // Only used in SHARED_MEMORY mode. The RX and TX worker threads each keep their own reference to the mapped segment, which is only unmapped
+    // once neither of them can still be copying through it.
+    std::atomic<std::shared_ptr<SharedMemoryChannel>> m_shared_memory_channel;
+    std::shared_ptr<SharedMemoryChannel> m_rx_shared_memory_channel;
+    std::shared_ptr<SharedMemoryChannel> m_tx_shared_memory_channel;
+    ClientStatisticsRecorder m_statistics;
 
     bool m_worker_threads_started { false };
 
+    ClientReactor* m_reactor { nullptr };
+    size_t m_reactor_event_loop { 0 };
+    bool m_reactor_watching_socket { false };
+    uint32_t m_reactor_watched_events { 0 };
+    std::atomic<bool> m_reactor_tx_flush_posted { false };
+    // Set while reading is paused for the RX dispatch queue, in which case the socket is not watched for EPOLLIN and no io_uring receive is submitted
+    bool m_reactor_rx_paused { false };
+    // The following are only used with the IO_URING backend. At most one receive and one send are in flight, and the kernel owns
+    // m_rx_buffer (or m_tx_message, its gather list and the front payloads) until the operation completes.
+    bool m_reactor_uses_io_uring { false };
+    bool m_reactor_receive_pending { false };
+    bool m_reactor_send_pending { false };
+    size_t m_reactor_pending_operations { 0 };
+    msghdr m_tx_message {};
+    size_t m_reactor_send_bytes { 0 };
+
     std::thread m_monitor_connection_thread;
     std::binary_semaphore m_monitor_connection_semaphore {0};
+    // An eventfd that wakes the connection monitor thread while it waits for a connection attempt, so that the attempt can be cancelled
+    int m_connect_cancel_file_descriptor { DEFAULT_FILE_DESCRIPTOR };
     WorkerThreadState m_monitor_connection_thread_state { WorkerThreadState::INACTIVE };
     mutable std::shared_mutex m_monitor_connection_thread_state_mutex;
 
@@ -148,25 +511,257 @@ private:
     void SignalRxWorkerThreadShutdown();
 
     void ExecuteErrorCallback(const Error& error, const std::optional<std::span<char>>& tx_payload_opt);
+    void ExecuteTxCompletions();
     void ExecuteDisconnectedCallback();
+    bool AwaitConnection(ConnectAwaitable& awaitable);
+    void ResumeConnectAwaiters(bool is_connected);
+    bool AwaitRxMessage(ReceiveAwaitable& awaitable);
+    void DeliverAwaitedRxMessage(RxMessage&& rx_message);
+    void EndAwaitedRxMessages();
 
     void SetClientState(const ClientState& client_state);
+    bool CompareAndSetClientState(ClientState expected_client_state, ClientState client_state);
     bool OpenConnection();
     bool OpenSocket();
     bool OpenTcpIpv4Socket();
     bool OpenUnixDomainSocket();
-    bool Connect();
+    bool OpenSharedMemorySegment();
+    void ApplySocketOptions(int socket_file_descriptor);
+    void SetSocketOption(int socket_file_descriptor, int level, int option_name, int option_value, const std::string& option_label) const;
+    void RearmTcpQuickAck();
+    bool ConnectSocket();
     bool ConnectToTcpIpv4Address();
     bool ConnectToUnixDomainSocketAddress();
-    void CloseSocket();
+    bool ConnectToSharedMemorySegment();
+    void CloseSharedMemoryChannel();
+    SharedMemoryChannel* GetWorkerSharedMemoryChannel(std::shared_ptr<SharedMemoryChannel>& worker_channel) const;
+    int WaitForConnection();
+    void SignalConnectCancel();
+    bool IsConnectCancelled() const;
+    void CloseSocket(ClientState closed_client_state = ClientState::NOT_CONNECTED);
+    static bool IsConnectionLostError(int error_number);
+    void LoseConnection();
+    void BeginReconnecting();
+    void EndReconnecting(bool is_reconnected);
+    std::chrono::milliseconds GetReconnectDelay();
 
     /* WORKER THREADS */
     void MonitorConnection();
+    void ReconnectLostConnection();
     void ProcessTxPayloads();
     void ProcessRxPayloads();
 
     void JoinThreads();
 
-    bool SendNextPayload();
+    TxResult SendNextPayloads(int flags);
+    TxResult CompleteTxSend(ssize_t sent_bytes);
+    size_t GetTxBatchPayloadLimit() const;
+    size_t GatherTxPayloads();
+    void GatherTxMessages();
+    ssize_t SendTxMessages(int flags);
+    void ConsumeSentBytes(size_t sent_bytes);
+    void FailFrontTxPayload();
+    void CompleteFrontTxPayload(bool is_sent);
+    bool IsTxZeroCopyEligible(size_t batch_bytes);
+    void MarkTxZeroCopyPayloads(size_t sent_bytes);
+    bool HasUnreportedTxZeroCopySends() const;
+    void ReapTxZeroCopyReports();
+    void CompleteTxZeroCopySends(uint32_t first_sequence, uint32_t last_sequence);
+    void ReleaseTxZeroCopyPayloads();
+    static TxPayload CreateTxPayload(std::vector<char>&& tx_bytes, TxCompletionCallback completion_callback);
+    static TxPayload CreateTxPayload(std::unique_ptr<char[]> tx_bytes, size_t size, TxCompletionCallback completion_callback);
+    static TxPayload CreateTxPayload(SharedPayload tx_bytes, TxCompletionCallback completion_callback);
+    static TxPayload CreateBorrowedTxPayload(std::span<const char> tx_bytes);
+    bool EnqueueTxPayload(TxPayload&& tx_payload, bool may_wait, size_t lane);
+    static SocketMode GetUnixSocketMode(const ClientOptions& options);
+    static bool IsMemfdTransferApplicable(SocketMode socket_mode, const ClientOptions& options);
+    static bool IsFramingApplicable(SocketMode socket_mode, const ClientOptions& options);
+    bool IsMemfdTxPayload(const TxPayload& tx_payload) const;
+    bool StoreTxPayloadInMemfd(TxPayload& tx_payload) const;
+    void AttachTxMemfds(msghdr& tx_message);
+    void MarkTxMemfdsPassed();
+    bool IsTxQueueAccounted() const;
+    bool IsTxConsumerThread() const;
+    bool AdmitTxPayload(size_t payload_bytes, bool may_wait);
+    bool TryReserveTxQueueSpace(size_t payload_bytes, bool is_forced);
+    void ReleaseTxQueueSpace(size_t payload_bytes);
+    bool WaitForTxQueueSpace(size_t payload_bytes);
+    void DropOldestTxPayloads(size_t payload_bytes);
+    void WakeTxQueueSpaceWaiters();
+    void ReportTxWatermarkCrossing();
+    void SignalTxConsumer();
+    void PullTxPayloads();
+    std::optional<TxPayload> PopTxPayload(size_t lane, uint64_t clear_generation, bool is_tx_queue_accounted);
+    void DropStaleTxPayloads(uint64_t clear_generation);
+    static size_t GetTxLaneCount(const TxLaneOptions& options);
+    size_t GetTxLaneChunkSize() const;
+    void ScheduleTxLaneChunks(uint64_t clear_generation, bool is_tx_queue_accounted);
+    bool HasTxLaneChunk(size_t lane, uint64_t clear_generation, bool is_tx_queue_accounted);
+    std::optional<size_t> SelectTxLane(uint64_t clear_generation, bool is_tx_queue_accounted);
+    void CutTxLaneChunk(size_t lane);
+    void CompleteTxLaneChunk(TxPayload& tx_chunk);
+    void FailFrontTxLanePayload();
+    void RemoveTxLaneChunks(size_t lane);
+    void RestartTxLanePayloads();
+    void CompleteTxPayload(TxPayload& tx_payload, bool is_sent);
+    void PrepareRxBuffer();
+    ssize_t ReceiveRxBytes(int flags);
+    ssize_t ReceiveRxMessages(int flags);
+    ssize_t ReceiveSharedMemoryBytes(int flags);
+    ssize_t SendSharedMemoryBytes(int flags);
+    void TakeRxMemfds(const msghdr& rx_message);
+    void CloseRxMemfds();
+    bool DeliverRxBytes(size_t read_bytes);
+    bool DeliverRxMemfd();
+    void DeliverRxMessages();
+    void DeliverRxMessage(const RxBufferRef& rx_buffer, const std::span<char>& rx_bytes);
+    bool IsRxDrained(ssize_t read_bytes) const;
+    void DeliverRxBatch();
+    void ExecuteRxBatchCallback(std::vector<RxMessage>& rx_messages, std::vector<uint64_t>& read_timestamps);
+    static std::shared_ptr<CallbackExecutor> CreateRxExecutor(const RxDispatchOptions& options);
+    void DispatchRxMessage(const RxBufferRef& rx_buffer, const std::span<char>& rx_bytes);
+    bool HasRxDispatchRoom(size_t message_bytes) const;
+    void ExecuteRxDispatch();
+    bool IsRxDispatchResumable();
+    void ResumeReactorReceiveLater();
+    void WaitForRxDispatch(std::unique_lock<std::mutex>& lock);
+    void NotifyRxDispatchWaiters();
+    void StopRxDispatch();
+
+    /* REACTOR MODE */
+    void OnReactorEvents(uint32_t events) override;
+    void OpenReactorConnection();
+    void CompleteReactorConnection();
+    void CloseReactorConnection(bool notify_disconnected, ClientState closed_client_state = ClientState::NOT_CONNECTED);
+    void FailReactorConnectionAttempt();
+    void LoseReactorConnection();
+    void ScheduleReactorReconnect();
+    void AttemptReactorReconnect();
+    void CancelReactorReconnect();
+    void TimeOutReactorConnection();
+    void CancelReactorConnectTimeout();
+    void UpdateReactorWatch(bool wants_writable);
+    void FlushReactorTxPayloads();
+    void ReceiveReactorPayloads();
+    void PauseReactorReceive();
+    void ResumeReactorReceive();
+    void OnReactorCompletion(ReactorOperation operation, uint16_t tag, int32_t result) override;
+    uint16_t GetReactorConnectionTag() const;
+    void SubmitReactorReceive();
+    void SubmitReactorSend();
+    void CompleteReactorReceive(int32_t result, bool is_current_connection);
+    void CompleteReactorSend(int32_t result, bool is_current_connection);
 };
+
+class ApplicationClient::ConnectAwaitable
+{
+public:
+
+    explicit ConnectAwaitable(ApplicationClient& client)
+    : m_client(client)
+    {
+    }
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle)
+    {
+        m_handle = handle;
+        return m_client.AwaitConnection(*this);
+    }
+
+    bool await_resume() const noexcept
+    {
+        return m_is_connected;
+    }
+
+private:
+
+    friend class ApplicationClient;
+
+    ApplicationClient& m_client;
+    std::coroutine_handle<> m_handle;
+    bool m_is_connected { false };
+};
+
+class ApplicationClient::SendAwaitable
+{
+public:
+
+    SendAwaitable(ApplicationClient& client, TxPayload&& tx_payload, size_t lane)
+    : m_client(client)
+    , m_tx_payload(std::move(tx_payload))
+    , m_lane(lane)
+    {
+    }
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle)
+    {
+        m_handle = handle;
+        m_tx_payload.completion_callback = [this](bool is_sent)
+        {
+            m_is_sent = is_sent;
+            m_handle.resume();
+        };
+
+        // Once the payload is queued, the TX consumer may resume the coroutine before this returns, so nothing of the awaitable is touched afterwards
+        return m_client.EnqueueTxPayload(std::move(m_tx_payload), true, m_lane);
+    }
+
+    bool await_resume() const noexcept
+    {
+        return m_is_sent;
+    }
+
+private:
+
+    ApplicationClient& m_client;
+    TxPayload m_tx_payload;
+    const size_t m_lane;
+    std::coroutine_handle<> m_handle;
+    bool m_is_sent { false };
+};
+
+class ApplicationClient::ReceiveAwaitable
+{
+public:
+
+    explicit ReceiveAwaitable(ApplicationClient& client)
+    : m_client(client)
+    {
+    }
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle)
+    {
+        m_handle = handle;
+        return m_client.AwaitRxMessage(*this);
+    }
+
+    RxMessage await_resume() noexcept
+    {
+        return std::move(m_rx_message);
+    }
+
+private:
+
+    friend class ApplicationClient;
+
+    ApplicationClient& m_client;
+    std::coroutine_handle<> m_handle;
+    RxMessage m_rx_message;
+};
+
 } // namespace InterProcessCommunication
\ No newline at end of file
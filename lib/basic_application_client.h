@@ -0,0 +1,368 @@
+#pragma once
+
+#include "client_error.h"
+#include "client_transport.h"
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <concepts>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace InterProcessCommunication
+{
+
+/*
+    \brief The handler of a BasicApplicationClient receives the bytes of every read through OnReceive(). It may also define any of
+        OnConnected(), OnDisconnected() and OnError(Error), which the client only calls if they exist.
+*/
+template <typename T>
+concept RxHandler = requires(T& handler, std::span<char> rx_bytes)
+{
+    handler.OnReceive(rx_bytes);
+};
+
+/*
+    \brief A handler that forwards to callbacks set at runtime, for a BasicApplicationClient whose handler is not known at compile time.
+        Every call goes through a std::function, as with ApplicationClient.
+*/
+struct FunctionHandler
+{
+    std::function<void(std::span<char> rx_bytes)> rx_callback = [](std::span<char>){};
+    std::function<void()> connected_callback = [](){};
+    std::function<void()> disconnected_callback = [](){};
+    std::function<void(Error error)> error_callback = [](Error){};
+
+    void OnReceive(std::span<char> rx_bytes)
+    {
+        rx_callback(rx_bytes);
+    }
+
+    void OnConnected()
+    {
+        connected_callback();
+    }
+
+    void OnDisconnected()
+    {
+        disconnected_callback();
+    }
+
+    void OnError(Error error)
+    {
+        error_callback(error);
+    }
+};
+
+/*
+    \brief A lean client whose transport (see TcpTransport and UnixTransport) and handler are fixed at compile time, so the RX thread calls the handler
+        directly, where it can be inlined, and carries no branches for other socket types or delivery modes. It is meant for hot paths that need none of
+        ApplicationClient's runtime features: there is no TX queue, framing, reconnecting or reactor mode. Connect() blocks until the connection is made,
+        and Send() blocks on the caller's thread until the kernel has accepted every byte.
+        The RX thread calls OnReceive() with the bytes of every read and OnDisconnected() once the connection has ended, on either side.
+        OnConnected() runs on the thread that calls Connect(), and OnError() on the thread whose operation failed.
+*/
+template <typename Transport, RxHandler Handler>
+class BasicApplicationClient
+{
+public:
+
+    using Endpoint = typename Transport::Endpoint;
+
+    static constexpr size_t DEFAULT_RX_BUFFER_SIZE { 64 * 1024 };
+
+    BasicApplicationClient(const BasicApplicationClient&) = delete;
+    BasicApplicationClient& operator=(const BasicApplicationClient&) = delete;
+    BasicApplicationClient(BasicApplicationClient&&) = delete;
+    BasicApplicationClient& operator=(BasicApplicationClient&&) = delete;
+
+    ~BasicApplicationClient()
+    {
+        Close();
+
+        // Close() leaves joining to others when the handler called it from the RX thread
+        if(m_rx_thread.joinable())
+        {
+            m_rx_thread.join();
+        }
+    }
+
+    /*
+        \brief The handler is default constructed in place, so it may hold members that can not be moved, such as a mutex
+    */
+    explicit BasicApplicationClient(Endpoint endpoint, size_t rx_buffer_size = DEFAULT_RX_BUFFER_SIZE)
+    : m_endpoint(std::move(endpoint))
+    , m_handler()
+    , m_rx_buffer(std::max<size_t>(rx_buffer_size, 1))
+    {
+    }
+
+    BasicApplicationClient(Endpoint endpoint, Handler handler, size_t rx_buffer_size = DEFAULT_RX_BUFFER_SIZE) requires std::move_constructible<Handler>
+    : m_endpoint(std::move(endpoint))
+    , m_handler(std::move(handler))
+    , m_rx_buffer(std::max<size_t>(rx_buffer_size, 1))
+    {
+    }
+
+    /*
+        \brief This function connects to the endpoint and starts the RX thread. It fails while a connection is established, and on the RX thread.
+    */
+    bool Connect()
+    {
+        std::unique_lock<std::mutex> lock(m_connection_mutex);
+
+        // The RX thread can not wait for itself to end
+        if(m_is_connected || m_rx_thread.get_id() == std::this_thread::get_id())
+        {
+            return false;
+        }
+
+        // The RX thread of the previous connection has ended by now, or is about to. It is joined without the lock, since its OnDisconnected() may call Close().
+        std::thread previous_rx_thread = std::move(m_rx_thread);
+
+        lock.unlock();
+
+        if(previous_rx_thread.joinable())
+        {
+            previous_rx_thread.join();
+        }
+
+        lock.lock();
+
+        // Another Connect() got in while the lock was released
+        if(m_is_connected || m_rx_thread.joinable())
+        {
+            return false;
+        }
+
+        const int socket_file_descriptor = Transport::Open();
+
+        if(socket_file_descriptor < 0)
+        {
+            NotifyError(Error::SOCKET_OPEN_FAILURE);
+            return false;
+        }
+
+        if(not Transport::Connect(socket_file_descriptor, m_endpoint))
+        {
+            close(socket_file_descriptor);
+            NotifyError(Error::SOCKET_CONNECT_FAILURE);
+            return false;
+        }
+
+        m_file_descriptor = socket_file_descriptor;
+        m_is_connected = true;
+
+        if constexpr(requires { m_handler.OnConnected(); })
+        {
+            m_handler.OnConnected();
+        }
+
+        m_rx_thread = std::thread(&BasicApplicationClient::ReceiveRxBytes, this);
+
+        return true;
+    }
+
+    /*
+        \brief This function sends all of the bytes before it returns, and may be called from any thread. It fails if the client is not connected.
+    */
+    bool Send(std::span<const char> tx_bytes)
+    {
+        // Only keeps the bytes of concurrent sends from interleaving. Close() never waits for it, so it can always interrupt a send that is blocked.
+        std::lock_guard<std::mutex> lock(m_tx_mutex);
+
+        const FileDescriptorUse socket_use(*this);
+
+        if(socket_use.file_descriptor < 0)
+        {
+            return false;
+        }
+
+        while(not tx_bytes.empty())
+        {
+            // A peer that has gone away has to show up as EPIPE rather than as a SIGPIPE that ends the process
+            const ssize_t sent_bytes = send(socket_use.file_descriptor, tx_bytes.data(), tx_bytes.size(), MSG_NOSIGNAL);
+
+            if(sent_bytes < 0)
+            {
+                if(errno == EINTR)
+                {
+                    continue;
+                }
+
+                // A send that Close() interrupted is only a failure for the caller
+                if(m_is_connected)
+                {
+                    const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to send payload!";
+                    perror(error_message.c_str());
+                    NotifyError(Error::SOCKET_SEND_FAILURE);
+                }
+
+                return false;
+            }
+
+            tx_bytes = tx_bytes.subspan(sent_bytes);
+        }
+
+        return true;
+    }
+
+    /*
+        \brief This function ends the connection and waits for the RX thread, unless the handler calls it from the RX thread or another Close() is already waiting for it.
+            A Send() that is blocked fails right away.
+    */
+    void Close()
+    {
+        std::thread rx_thread;
+
+        {
+            std::lock_guard<std::mutex> lock(m_connection_mutex);
+
+            m_is_connected = false;
+
+            const FileDescriptorUse socket_use(*this);
+
+            // Shutting the socket down wakes the RX thread, which closes it, and fails any send that is blocked on it
+            if(socket_use.file_descriptor >= 0)
+            {
+                shutdown(socket_use.file_descriptor, SHUT_RDWR);
+            }
+
+            // The RX thread leaves joining itself to the destructor or the next Connect()
+            if(m_rx_thread.get_id() != std::this_thread::get_id())
+            {
+                rx_thread = std::move(m_rx_thread);
+            }
+        }
+
+        // Joined without the lock, since the handler may call Close() from the RX thread in the meantime
+        if(rx_thread.joinable())
+        {
+            rx_thread.join();
+        }
+    }
+
+    bool IsConnected() const
+    {
+        return m_is_connected;
+    }
+
+    Handler& GetHandler()
+    {
+        return m_handler;
+    }
+
+private:
+
+    static constexpr std::string_view CLASS_NAME = "BasicApplicationClient";
+
+    const Endpoint m_endpoint;
+    Handler m_handler;
+    std::vector<char> m_rx_buffer;
+
+    // Serialises Connect() and Close(), which start the RX thread and take it over for joining. Neither holds it while joining.
+    std::mutex m_connection_mutex;
+    // Serialises Send() calls
+    std::mutex m_tx_mutex;
+    // Send() and Close() count themselves in m_file_descriptor_users before they load the descriptor. The RX thread takes the descriptor away first
+    // and closes it once no user is left, so a descriptor is never used after it was closed (and possibly reused for another file).
+    std::atomic<int> m_file_descriptor { -1 };
+    std::atomic<size_t> m_file_descriptor_users { 0 };
+    std::atomic<bool> m_is_connected { false };
+    std::thread m_rx_thread;
+
+    // Holds the socket's descriptor open for as long as it is in scope. The descriptor is negative when there is no connection.
+    struct FileDescriptorUse
+    {
+        BasicApplicationClient& client;
+        int file_descriptor;
+
+        explicit FileDescriptorUse(BasicApplicationClient& owner)
+        : client(owner)
+        , file_descriptor((++owner.m_file_descriptor_users, owner.m_file_descriptor.load()))
+        {
+        }
+
+        FileDescriptorUse(const FileDescriptorUse&) = delete;
+        FileDescriptorUse& operator=(const FileDescriptorUse&) = delete;
+
+        ~FileDescriptorUse()
+        {
+            if(--client.m_file_descriptor_users == 0)
+            {
+                client.m_file_descriptor_users.notify_all();
+            }
+        }
+    };
+
+    void ReceiveRxBytes()
+    {
+        // Only Connect() and the end of this thread change the descriptor, and Connect() waits for this thread first
+        const int socket_file_descriptor = m_file_descriptor;
+
+        while(true)
+        {
+            const ssize_t read_bytes = recv(socket_file_descriptor, m_rx_buffer.data(), m_rx_buffer.size(), 0);
+
+            if(read_bytes > 0)
+            {
+                m_handler.OnReceive(std::span<char>(m_rx_buffer.data(), read_bytes));
+                continue;
+            }
+
+            if(read_bytes < 0 && errno == EINTR)
+            {
+                continue;
+            }
+
+            // A failed read is only an error while the connection was meant to stay open
+            if(read_bytes < 0 && m_is_connected)
+            {
+                const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to read!";
+                perror(error_message.c_str());
+                NotifyError(Error::SOCKET_READ_FAILURE);
+            }
+
+            break;
+        }
+
+        m_is_connected = false;
+        m_file_descriptor = -1;
+
+        // A send that is still blocked on the socket fails once the socket is shut down, which also covers a peer that stopped reading
+        shutdown(socket_file_descriptor, SHUT_RDWR);
+
+        size_t file_descriptor_users = m_file_descriptor_users;
+
+        while(file_descriptor_users != 0)
+        {
+            m_file_descriptor_users.wait(file_descriptor_users);
+            file_descriptor_users = m_file_descriptor_users;
+        }
+
+        close(socket_file_descriptor);
+
+        if constexpr(requires { m_handler.OnDisconnected(); })
+        {
+            m_handler.OnDisconnected();
+        }
+    }
+
+    void NotifyError(Error error)
+    {
+        if constexpr(requires { m_handler.OnError(error); })
+        {
+            m_handler.OnError(error);
+        }
+    }
+};
+
+} // namespace InterProcessCommunication
@@ -0,0 +1,80 @@
+#include "allocation_counter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+namespace
+{
+std::atomic<uint64_t> allocation_count { 0 };
+
+void* Allocate(std::size_t size)
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+
+    if(void* memory = std::malloc(size == 0 ? 1 : size))
+    {
+        return memory;
+    }
+
+    throw std::bad_alloc();
+}
+
+void* AllocateAligned(std::size_t size, std::align_val_t alignment)
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+
+    const std::size_t alignment_bytes = static_cast<std::size_t>(alignment);
+
+    // aligned_alloc() requires the size to be a multiple of the alignment
+    if(void* memory = std::aligned_alloc(alignment_bytes, (size + alignment_bytes - 1) / alignment_bytes * alignment_bytes))
+    {
+        return memory;
+    }
+
+    throw std::bad_alloc();
+}
+} // namespace
+
+uint64_t GetAllocationCount()
+{
+    return allocation_count.load(std::memory_order_relaxed);
+}
+
+} // namespace InterProcessCommunication::Benchmark
+
+/*
+    Replacing the global allocation functions routes every operator new in the executable (including the client library) through the counter.
+    The array and nothrow forms of the standard library forward to these. The sized forms are defined as well, since the compiler calls them directly.
+*/
+void* operator new(std::size_t size)
+{
+    return InterProcessCommunication::Benchmark::Allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return InterProcessCommunication::Benchmark::AllocateAligned(size, alignment);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept
+{
+    std::free(memory);
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+/*
+    \brief The process-wide number of heap allocations made through operator new, which the benchmark executable replaces.
+        The count includes every thread, so benchmarks should only compare it across phases in which the other threads do not allocate.
+*/
+uint64_t GetAllocationCount();
+
+} // namespace InterProcessCommunication::Benchmark
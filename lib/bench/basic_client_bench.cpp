@@ -0,0 +1,175 @@
+#include "basic_application_client.h"
+#include "loopback_client.h"
+#include <benchmark/benchmark.h>
+#include <atomic>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+namespace
+{
+
+constexpr size_t DISPATCH_MESSAGE_SIZE = 64;
+constexpr uint64_t BYTES_PER_ITERATION = 1024 * 1024;
+// Small reads make the per-read dispatch cost show next to the recv() it follows
+constexpr size_t STREAM_RX_BUFFER_SIZE = 256;
+
+struct CountingHandler
+{
+    uint64_t rx_byte_count = 0;
+
+    void OnReceive(std::span<char> rx_bytes)
+    {
+        rx_byte_count += rx_bytes.size();
+    }
+};
+
+// Publishes every read, as the end-to-end benchmark needs to wait on the count
+struct StreamHandler
+{
+    std::atomic<uint64_t> received_bytes { 0 };
+
+    void OnReceive(std::span<char> rx_bytes)
+    {
+        received_bytes += rx_bytes.size();
+        received_bytes.notify_all();
+    }
+};
+
+/*
+    Every iteration dispatches one 64-byte message to a handler, the way the RX thread of each client does, without any socket involved.
+    FunctionHandler calls its callback through a std::function, as ApplicationClient does, while a handler that is known at compile time is called directly.
+*/
+template <RxHandler Handler>
+void BM_RxDispatch(benchmark::State& state, Handler& handler)
+{
+    std::vector<char> message(DISPATCH_MESSAGE_SIZE, 'x');
+
+    for(auto _ : state)
+    {
+        handler.OnReceive(std::span<char>(message));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_RxDispatchFunctionHandler(benchmark::State& state)
+{
+    uint64_t rx_byte_count = 0;
+
+    FunctionHandler handler;
+    handler.rx_callback = [&](std::span<char> rx_bytes){ rx_byte_count += rx_bytes.size(); };
+
+    BM_RxDispatch(state, handler);
+    benchmark::DoNotOptimize(rx_byte_count);
+}
+
+void BM_RxDispatchInlineHandler(benchmark::State& state)
+{
+    CountingHandler handler;
+
+    BM_RxDispatch(state, handler);
+    benchmark::DoNotOptimize(handler.rx_byte_count);
+}
+
+void WaitForStreamedBytes(benchmark::State& state, const std::atomic<uint64_t>& received_bytes)
+{
+    const uint64_t initial_received_bytes = received_bytes;
+    uint64_t expected_bytes = initial_received_bytes + BYTES_PER_ITERATION;
+
+    for(auto _ : state)
+    {
+        uint64_t current_bytes = received_bytes;
+
+        while(current_bytes < expected_bytes)
+        {
+            received_bytes.wait(current_bytes);
+            current_bytes = received_bytes;
+        }
+
+        expected_bytes = current_bytes + BYTES_PER_ITERATION;
+    }
+
+    state.SetBytesProcessed(received_bytes - initial_received_bytes);
+}
+
+/*
+    The source server streams to the client over a unix domain socket as fast as it reads, and the client reads it in small pieces.
+    Every iteration waits until another megabyte has arrived.
+*/
+void BM_RxStreamApplicationClient(benchmark::State& state)
+{
+    // Declared ahead of the client, since the client's callback refers to it until the client is destroyed
+    std::atomic<uint64_t> received_bytes { 0 };
+
+    ClientOptions options;
+    options.rx_buffer.buffer_size = STREAM_RX_BUFFER_SIZE;
+    options.rx_buffer.max_buffer_size = STREAM_RX_BUFFER_SIZE;
+
+    const std::unique_ptr<LoopbackServer> server = CreateLoopbackServer(LoopbackServerMode::SOURCE, Transport::UNIX);
+    const std::unique_ptr<ApplicationClient> client = CreateLoopbackClient(*server, Transport::UNIX, options);
+
+    client->SetRxCallback([&](const std::span<char>& rx_bytes)
+    {
+        received_bytes += rx_bytes.size();
+        received_bytes.notify_all();
+    });
+
+    StartAndConnect(*client);
+    WaitForStreamedBytes(state, received_bytes);
+
+    client->RequestClose();
+}
+
+void BM_RxStreamBasicFunctionHandler(benchmark::State& state)
+{
+    std::atomic<uint64_t> received_bytes { 0 };
+
+    const std::unique_ptr<LoopbackServer> server = CreateLoopbackServer(LoopbackServerMode::SOURCE, Transport::UNIX);
+
+    FunctionHandler handler;
+    handler.rx_callback = [&](std::span<char> rx_bytes)
+    {
+        received_bytes += rx_bytes.size();
+        received_bytes.notify_all();
+    };
+
+    using Client = BasicApplicationClient<UnixTransport, FunctionHandler>;
+    Client client(UnixTransport::Endpoint { server->GetUnixSocketPath() }, std::move(handler), STREAM_RX_BUFFER_SIZE);
+
+    if(not client.Connect())
+    {
+        state.SkipWithError("Failed to connect");
+        return;
+    }
+
+    WaitForStreamedBytes(state, received_bytes);
+}
+
+void BM_RxStreamBasicInlineHandler(benchmark::State& state)
+{
+    const std::unique_ptr<LoopbackServer> server = CreateLoopbackServer(LoopbackServerMode::SOURCE, Transport::UNIX);
+
+    using Client = BasicApplicationClient<UnixTransport, StreamHandler>;
+    Client client(UnixTransport::Endpoint { server->GetUnixSocketPath() }, STREAM_RX_BUFFER_SIZE);
+
+    if(not client.Connect())
+    {
+        state.SkipWithError("Failed to connect");
+        return;
+    }
+
+    WaitForStreamedBytes(state, client.GetHandler().received_bytes);
+}
+
+} // namespace
+
+BENCHMARK(BM_RxDispatchFunctionHandler);
+BENCHMARK(BM_RxDispatchInlineHandler);
+
+BENCHMARK(BM_RxStreamApplicationClient)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_RxStreamBasicFunctionHandler)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_RxStreamBasicInlineHandler)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+} // namespace InterProcessCommunication::Benchmark
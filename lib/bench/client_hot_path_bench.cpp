@@ -0,0 +1,195 @@
+#include "loopback_client.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <vector>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+namespace
+{
+
+constexpr uint64_t BYTES_PER_ITERATION = 1024 * 1024;
+constexpr size_t ROUND_TRIP_MESSAGE_SIZE = 64;
+
+/*
+    Every iteration enqueues a megabyte worth of payloads of the given size and waits until the sink server has read all of them.
+*/
+void BM_TxThroughput(benchmark::State& state, Transport transport)
+{
+    const size_t payload_size = state.range(0);
+    const size_t payloads_per_iteration = std::max<size_t>(1, BYTES_PER_ITERATION / payload_size);
+
+    const std::unique_ptr<LoopbackServer> server = CreateLoopbackServer(LoopbackServerMode::SINK, transport);
+    const std::unique_ptr<ApplicationClient> client = CreateLoopbackClient(*server, transport);
+
+    StartAndConnect(*client);
+
+    std::string payload(payload_size, 'x');
+    uint64_t expected_bytes = 0;
+
+    for(auto _ : state)
+    {
+        for(size_t count = 0; count < payloads_per_iteration; ++count)
+        {
+            client->EnqueuePayload(std::span<char>(payload));
+        }
+
+        expected_bytes += payloads_per_iteration * payload_size;
+        server->WaitForReceivedBytes(expected_bytes);
+    }
+
+    state.SetItemsProcessed(state.iterations() * payloads_per_iteration);
+    state.SetBytesProcessed(state.iterations() * payloads_per_iteration * payload_size);
+}
+
+/*
+    The source server streams to the client as fast as it reads, and every iteration waits until another megabyte has arrived.
+*/
+void BM_RxThroughput(benchmark::State& state, Transport transport)
+{
+    // Declared ahead of the client, since the client's callback refers to it until the client is destroyed
+    std::atomic<uint64_t> received_bytes { 0 };
+
+    const std::unique_ptr<LoopbackServer> server = CreateLoopbackServer(LoopbackServerMode::SOURCE, transport);
+    const std::unique_ptr<ApplicationClient> client = CreateLoopbackClient(*server, transport);
+
+    client->SetRxCallback([&](const std::span<char>& rx_bytes)
+    {
+        received_bytes += rx_bytes.size();
+        received_bytes.notify_all();
+    });
+
+    StartAndConnect(*client);
+
+    const uint64_t initial_received_bytes = received_bytes;
+    uint64_t expected_bytes = initial_received_bytes + BYTES_PER_ITERATION;
+
+    for(auto _ : state)
+    {
+        uint64_t current_bytes = received_bytes;
+
+        while(current_bytes < expected_bytes)
+        {
+            received_bytes.wait(current_bytes);
+            current_bytes = received_bytes;
+        }
+
+        expected_bytes = current_bytes + BYTES_PER_ITERATION;
+    }
+
+    state.SetBytesProcessed(received_bytes - initial_received_bytes);
+}
+
+/*
+    Every iteration is one round trip of a small message through the echo server. Besides the mean, the percentiles of the individual round trips are reported.
+*/
+void BM_RoundTripLatency(benchmark::State& state, Transport transport)
+{
+    std::atomic<uint64_t> received_bytes { 0 };
+
+    const std::unique_ptr<LoopbackServer> server = CreateLoopbackServer(LoopbackServerMode::ECHO, transport);
+    const std::unique_ptr<ApplicationClient> client = CreateLoopbackClient(*server, transport);
+
+    client->SetRxCallback([&](const std::span<char>& rx_bytes)
+    {
+        received_bytes += rx_bytes.size();
+        received_bytes.notify_all();
+    });
+
+    StartAndConnect(*client);
+
+    std::string message(ROUND_TRIP_MESSAGE_SIZE, 'x');
+    uint64_t expected_bytes = 0;
+    std::vector<double> round_trip_microseconds;
+
+    for(auto _ : state)
+    {
+        const std::chrono::steady_clock::time_point send_time = std::chrono::steady_clock::now();
+
+        client->EnqueuePayload(std::span<char>(message));
+        expected_bytes += ROUND_TRIP_MESSAGE_SIZE;
+
+        uint64_t current_bytes = received_bytes;
+
+        while(current_bytes < expected_bytes)
+        {
+            received_bytes.wait(current_bytes);
+            current_bytes = received_bytes;
+        }
+
+        round_trip_microseconds.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - send_time).count());
+    }
+
+    std::sort(round_trip_microseconds.begin(), round_trip_microseconds.end());
+
+    const auto percentile = [&](double fraction)
+    {
+        return round_trip_microseconds[static_cast<size_t>(fraction * (round_trip_microseconds.size() - 1))];
+    };
+
+    state.SetItemsProcessed(state.iterations());
+    state.counters["p50_us"] = percentile(0.5);
+    state.counters["p90_us"] = percentile(0.9);
+    state.counters["p99_us"] = percentile(0.99);
+    state.counters["p999_us"] = percentile(0.999);
+    state.counters["max_us"] = round_trip_microseconds.back();
+}
+
+/*
+    Every iteration opens a connection and closes it again, waiting for the connected and disconnected callbacks in between.
+*/
+void BM_ConnectDisconnectChurn(benchmark::State& state, Transport transport)
+{
+    std::atomic<uint64_t> connection_count { 0 };
+    std::atomic<uint64_t> disconnection_count { 0 };
+
+    const std::unique_ptr<LoopbackServer> server = CreateLoopbackServer(LoopbackServerMode::SINK, transport);
+    const std::unique_ptr<ApplicationClient> client = CreateLoopbackClient(*server, transport);
+
+    client->SetConnectionCallback([&]()
+    {
+        ++connection_count;
+        connection_count.notify_all();
+    });
+
+    client->SetDisconnectedCallback([&]()
+    {
+        ++disconnection_count;
+        disconnection_count.notify_all();
+    });
+
+    StartAndConnect(*client);
+    client->RequestClose();
+    disconnection_count.wait(0);
+
+    for(auto _ : state)
+    {
+        const uint64_t previous_connection_count = connection_count;
+        const uint64_t previous_disconnection_count = disconnection_count;
+
+        client->RequestOpen();
+        connection_count.wait(previous_connection_count);
+
+        client->RequestClose();
+        disconnection_count.wait(previous_disconnection_count);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_TxThroughput, tcp, Transport::TCP)->Arg(64)->Arg(1024)->Arg(16 * 1024)->Arg(256 * 1024)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_TxThroughput, unix_domain, Transport::UNIX)->Arg(64)->Arg(1024)->Arg(16 * 1024)->Arg(256 * 1024)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_RxThroughput, tcp, Transport::TCP)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_RxThroughput, unix_domain, Transport::UNIX)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_RoundTripLatency, tcp, Transport::TCP)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_RoundTripLatency, unix_domain, Transport::UNIX)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_ConnectDisconnectChurn, tcp, Transport::TCP)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_ConnectDisconnectChurn, unix_domain, Transport::UNIX)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+} // namespace InterProcessCommunication::Benchmark
@@ -0,0 +1,86 @@
+#include "client_pool.h"
+#include "loopback_client.h"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+namespace
+{
+
+constexpr std::chrono::milliseconds POOL_STATE_POLL_INTERVAL { 1 };
+constexpr size_t PAYLOAD_SIZE = 4096;
+constexpr uint64_t PAYLOADS_PER_BATCH = 1000;
+
+std::unique_ptr<ClientPool> CreateLoopbackPool(const LoopbackServer& server, Transport transport, size_t connection_count, PoolDistribution distribution)
+{
+    ClientPoolOptions options;
+    options.connection_count = connection_count;
+    options.distribution = distribution;
+
+    if(transport == Transport::UNIX)
+    {
+        return std::make_unique<ClientPool>(server.GetUnixSocketPath(), options);
+    }
+
+    return std::make_unique<ClientPool>(server.GetIpv4Address(), server.GetPort(), options);
+}
+
+void StartAndConnect(ClientPool& pool)
+{
+    pool.Start();
+
+    while(not pool.IsRunning())
+    {
+        std::this_thread::sleep_for(POOL_STATE_POLL_INTERVAL);
+    }
+
+    pool.RequestOpen();
+
+    while(pool.GetConnectedCount() != pool.GetConnectionCount())
+    {
+        std::this_thread::sleep_for(POOL_STATE_POLL_INTERVAL);
+    }
+}
+
+/*
+    Every batch stripes a thousand 4 KiB payloads over the pool's connections and waits until the sink server has read all of them.
+    One connection is the plain client, and the larger pools show how far more sockets and TX threads carry the same load.
+*/
+void BM_PoolThroughput(benchmark::State& state, PoolDistribution distribution, Transport transport)
+{
+    const size_t connection_count = state.range(0);
+
+    const std::unique_ptr<LoopbackServer> server = CreateLoopbackServer(LoopbackServerMode::SINK, transport);
+    const std::unique_ptr<ClientPool> pool = CreateLoopbackPool(*server, transport, connection_count, distribution);
+    const SharedPayload payload = std::make_shared<const std::vector<char>>(PAYLOAD_SIZE, 'x');
+
+    StartAndConnect(*pool);
+
+    uint64_t sent_bytes = 0;
+
+    while(state.KeepRunningBatch(PAYLOADS_PER_BATCH))
+    {
+        for(uint64_t count = 0; count < PAYLOADS_PER_BATCH; ++count)
+        {
+            pool->EnqueuePayload(payload);
+        }
+
+        sent_bytes += PAYLOADS_PER_BATCH * PAYLOAD_SIZE;
+        server->WaitForReceivedBytes(sent_bytes);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(sent_bytes);
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_PoolThroughput, round_robin_tcp, PoolDistribution::ROUND_ROBIN, Transport::TCP)->RangeMultiplier(2)->Range(1, 16)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_PoolThroughput, least_queued_tcp, PoolDistribution::LEAST_QUEUED, Transport::TCP)->RangeMultiplier(2)->Range(1, 16)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_PoolThroughput, round_robin_unix, PoolDistribution::ROUND_ROBIN, Transport::UNIX)->RangeMultiplier(2)->Range(1, 16)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_PoolThroughput, least_queued_unix, PoolDistribution::LEAST_QUEUED, Transport::UNIX)->RangeMultiplier(2)->Range(1, 16)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+} // namespace InterProcessCommunication::Benchmark
@@ -0,0 +1,129 @@
+#include "application_client.h"
+#include "client_reactor.h"
+#include "loopback_server.h"
+#include <benchmark/benchmark.h>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+namespace
+{
+
+enum class ClientDriver
+{
+    WORKER_THREADS,
+    REACTOR
+};
+
+constexpr size_t MESSAGE_SIZE = 64;
+constexpr std::chrono::milliseconds CLIENT_STATE_POLL_INTERVAL { 1 };
+
+uint64_t GetProcessThreadCount()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+
+    while(std::getline(status, line))
+    {
+        if(line.rfind("Threads:", 0) == 0)
+        {
+            return std::stoull(line.substr(8));
+        }
+    }
+
+    return 0;
+}
+
+/*
+    Every iteration sends one message from each client to an echo server and waits until all of the echoes have been received.
+    This exercises the connect, send and receive paths of every connection while most of the connections sit idle in between.
+*/
+void BM_EchoFanOut(benchmark::State& state, ClientDriver client_driver)
+{
+    const size_t connection_count = state.range(0);
+
+    LoopbackServer server(LoopbackServerMode::ECHO);
+    ClientReactor reactor;
+    std::vector<std::unique_ptr<ApplicationClient>> clients;
+    std::atomic<uint64_t> received_bytes { 0 };
+
+    if(client_driver == ClientDriver::REACTOR)
+    {
+        reactor.Start();
+    }
+
+    for(size_t index = 0; index < connection_count; ++index)
+    {
+        clients.emplace_back(std::make_unique<ApplicationClient>(server.GetIpv4Address(), server.GetPort()));
+
+        clients.back()->SetRxCallback([&](const std::span<char>& rx_bytes)
+        {
+            received_bytes += rx_bytes.size();
+            received_bytes.notify_all();
+        });
+
+        if(client_driver == ClientDriver::REACTOR)
+        {
+            clients.back()->Start(reactor);
+        }
+        else
+        {
+            clients.back()->Start();
+
+            while(not clients.back()->IsRunning())
+            {
+                std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+            }
+        }
+
+        clients.back()->RequestOpen();
+    }
+
+    for(const std::unique_ptr<ApplicationClient>& client : clients)
+    {
+        while(client->GetClientState() != ClientState::CONNECTED)
+        {
+            std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+        }
+    }
+
+    server.WaitForConnections(connection_count);
+
+    std::string message(MESSAGE_SIZE, 'x');
+    uint64_t expected_bytes = 0;
+
+    for(auto _ : state)
+    {
+        for(const std::unique_ptr<ApplicationClient>& client : clients)
+        {
+            client->EnqueuePayload(std::span<char>(message));
+        }
+
+        expected_bytes += connection_count * MESSAGE_SIZE;
+
+        uint64_t current_bytes = received_bytes;
+
+        while(current_bytes < expected_bytes)
+        {
+            received_bytes.wait(current_bytes);
+            current_bytes = received_bytes;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * connection_count);
+    state.SetBytesProcessed(state.iterations() * connection_count * MESSAGE_SIZE);
+    state.counters["process_threads"] = GetProcessThreadCount();
+
+    // The clients hold callbacks that refer to this stack frame, so they must be gone before it unwinds
+    clients.clear();
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_EchoFanOut, worker_threads, ClientDriver::WORKER_THREADS)->Arg(1)->Arg(100)->Arg(1000)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_EchoFanOut, reactor, ClientDriver::REACTOR)->Arg(1)->Arg(100)->Arg(1000)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+} // namespace InterProcessCommunication::Benchmark
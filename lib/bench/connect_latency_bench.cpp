@@ -0,0 +1,68 @@
+#include "application_client.h"
+#include "loopback_server.h"
+#include <benchmark/benchmark.h>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+namespace
+{
+
+constexpr std::chrono::milliseconds CLIENT_STATE_POLL_INTERVAL { 1 };
+
+/*
+    The source server starts streaming as soon as it accepts a connection, so every iteration times RequestOpen() up to the first RX callback.
+    Tearing the connection down again is not part of the measured time.
+*/
+void BM_ConnectToFirstByte(benchmark::State& state)
+{
+    LoopbackServer server(LoopbackServerMode::SOURCE);
+    ApplicationClient client(server.GetIpv4Address(), server.GetPort());
+
+    std::atomic<bool> is_first_byte_received { false };
+    std::chrono::steady_clock::time_point first_byte_time;
+
+    client.SetRxCallback([&](const std::span<char>& rx_bytes)
+    {
+        (void)rx_bytes;
+
+        if(not is_first_byte_received)
+        {
+            first_byte_time = std::chrono::steady_clock::now();
+            is_first_byte_received = true;
+            is_first_byte_received.notify_all();
+        }
+    });
+
+    client.Start();
+
+    while(not client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    for(auto _ : state)
+    {
+        is_first_byte_received = false;
+
+        const std::chrono::steady_clock::time_point open_time = std::chrono::steady_clock::now();
+        client.RequestOpen();
+
+        is_first_byte_received.wait(false);
+
+        state.SetIterationTime(std::chrono::duration<double>(first_byte_time - open_time).count());
+
+        client.RequestClose();
+
+        while(client.GetClientState() != ClientState::NOT_CONNECTED)
+        {
+            std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+        }
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_ConnectToFirstByte)->UseManualTime()->Unit(benchmark::kMicrosecond);
+
+} // namespace InterProcessCommunication::Benchmark
@@ -0,0 +1,176 @@
+#include "client_task.h"
+#include "loopback_client.h"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+namespace
+{
+
+enum class ClientApi
+{
+    CALLBACKS,
+    COROUTINES
+};
+
+constexpr size_t ROUND_TRIP_MESSAGE_SIZE = 64;
+constexpr size_t SEND_MESSAGE_SIZE = 1024;
+constexpr uint64_t OPERATIONS_PER_BATCH = 1000;
+
+// The echo server returns the frames as they are, so every echo arrives as one message on either API
+ClientOptions CreateFramingOptions()
+{
+    ClientOptions options;
+    options.framing.enabled = true;
+
+    return options;
+}
+
+SharedPayload CreateMessage(size_t message_size)
+{
+    return std::make_shared<const std::vector<char>>(message_size, 'x');
+}
+
+ClientTask AwaitConnection(ApplicationClient& client)
+{
+    co_await client.Connect();
+}
+
+ClientTask ExchangeRoundTrips(ApplicationClient& client, const SharedPayload& message, uint64_t round_trip_count)
+{
+    for(uint64_t count = 0; count < round_trip_count; ++count)
+    {
+        co_await client.Send(message);
+
+        const RxMessage rx_message = co_await client.Receive();
+        benchmark::DoNotOptimize(rx_message.bytes.data());
+    }
+}
+
+ClientTask SendMessages(ApplicationClient& client, const SharedPayload& message, uint64_t message_count)
+{
+    for(uint64_t count = 0; count < message_count; ++count)
+    {
+        co_await client.Send(message);
+    }
+}
+
+void WaitUntilZero(std::atomic<uint64_t>& counter)
+{
+    uint64_t current_count = counter;
+
+    while(current_count != 0)
+    {
+        counter.wait(current_count);
+        current_count = counter;
+    }
+}
+
+/*
+    Every batch runs a chain of round trips through the echo server, where each echo triggers the next request on the client's own threads.
+    The callback chain enqueues the next request from the RX callback, the coroutine awaits the send and then the echo, so the difference is the coroutine machinery.
+*/
+void BM_RoundTripChain(benchmark::State& state, ClientApi client_api, Transport transport)
+{
+    // Declared ahead of the client, since the client's callback refers to it until the client is destroyed
+    std::atomic<uint64_t> remaining_round_trips { 0 };
+
+    const std::unique_ptr<LoopbackServer> server = CreateLoopbackServer(LoopbackServerMode::ECHO, transport);
+    const std::unique_ptr<ApplicationClient> client = CreateLoopbackClient(*server, transport, CreateFramingOptions());
+    const SharedPayload message = CreateMessage(ROUND_TRIP_MESSAGE_SIZE);
+
+    client->SetRxCallback([&](const std::span<char>&)
+    {
+        if(--remaining_round_trips > 0)
+        {
+            client->EnqueuePayload(message);
+        }
+        else
+        {
+            remaining_round_trips.notify_all();
+        }
+    });
+
+    StartAndConnect(*client);
+
+    if(client_api == ClientApi::COROUTINES)
+    {
+        AwaitConnection(*client).Wait();
+    }
+
+    while(state.KeepRunningBatch(OPERATIONS_PER_BATCH))
+    {
+        if(client_api == ClientApi::COROUTINES)
+        {
+            ExchangeRoundTrips(*client, message, OPERATIONS_PER_BATCH).Wait();
+        }
+        else
+        {
+            remaining_round_trips = OPERATIONS_PER_BATCH;
+            client->EnqueuePayload(message);
+            WaitUntilZero(remaining_round_trips);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/*
+    Every batch sends a chain of messages to the sink server with one message in flight at a time, where each completion triggers the next send.
+*/
+void BM_SendCompletionChain(benchmark::State& state, ClientApi client_api, Transport transport)
+{
+    std::atomic<uint64_t> remaining_sends { 0 };
+
+    const std::unique_ptr<LoopbackServer> server = CreateLoopbackServer(LoopbackServerMode::SINK, transport);
+    const std::unique_ptr<ApplicationClient> client = CreateLoopbackClient(*server, transport);
+    const SharedPayload message = CreateMessage(SEND_MESSAGE_SIZE);
+
+    StartAndConnect(*client);
+
+    TxCompletionCallback completion_callback = [&](bool)
+    {
+        if(--remaining_sends > 0)
+        {
+            client->EnqueuePayload(message, completion_callback);
+        }
+        else
+        {
+            remaining_sends.notify_all();
+        }
+    };
+
+    while(state.KeepRunningBatch(OPERATIONS_PER_BATCH))
+    {
+        if(client_api == ClientApi::COROUTINES)
+        {
+            SendMessages(*client, message, OPERATIONS_PER_BATCH).Wait();
+        }
+        else
+        {
+            remaining_sends = OPERATIONS_PER_BATCH;
+            client->EnqueuePayload(message, completion_callback);
+            WaitUntilZero(remaining_sends);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * SEND_MESSAGE_SIZE);
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_RoundTripChain, callbacks_tcp, ClientApi::CALLBACKS, Transport::TCP)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_RoundTripChain, coroutines_tcp, ClientApi::COROUTINES, Transport::TCP)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_RoundTripChain, callbacks_unix, ClientApi::CALLBACKS, Transport::UNIX)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_RoundTripChain, coroutines_unix, ClientApi::COROUTINES, Transport::UNIX)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_SendCompletionChain, callbacks_tcp, ClientApi::CALLBACKS, Transport::TCP)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SendCompletionChain, coroutines_tcp, ClientApi::COROUTINES, Transport::TCP)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SendCompletionChain, callbacks_unix, ClientApi::CALLBACKS, Transport::UNIX)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SendCompletionChain, coroutines_unix, ClientApi::COROUTINES, Transport::UNIX)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+} // namespace InterProcessCommunication::Benchmark
@@ -0,0 +1,65 @@
+#include "loopback_client.h"
+#include <unistd.h>
+#include <atomic>
+#include <string>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+namespace
+{
+
+constexpr std::chrono::milliseconds CLIENT_STATE_POLL_INTERVAL { 1 };
+
+std::atomic<uint64_t> unix_socket_path_count { 0 };
+
+} // namespace
+
+std::unique_ptr<LoopbackServer> CreateLoopbackServer(LoopbackServerMode mode, Transport transport)
+{
+    if(transport == Transport::UNIX || transport == Transport::UNIX_SEQPACKET)
+    {
+        // A path per server keeps a slow teardown of the previous server from unlinking the next one's socket
+        const std::string unix_socket_path = "/tmp/application_client_bench_" + std::to_string(getpid()) + "_" + std::to_string(unix_socket_path_count++) + ".sock";
+        return std::make_unique<LoopbackServer>(mode, unix_socket_path, transport == Transport::UNIX_SEQPACKET ? SOCK_SEQPACKET : SOCK_STREAM);
+    }
+
+    return std::make_unique<LoopbackServer>(mode);
+}
+
+std::unique_ptr<ApplicationClient> CreateLoopbackClient(const LoopbackServer& server, Transport transport, const ClientOptions& options)
+{
+    if(transport == Transport::UNIX_SEQPACKET)
+    {
+        ClientOptions seqpacket_options = options;
+        seqpacket_options.unix_socket.type = UnixSocketType::SEQPACKET;
+
+        return std::make_unique<ApplicationClient>(server.GetUnixSocketPath(), seqpacket_options);
+    }
+
+    if(transport == Transport::UNIX)
+    {
+        return std::make_unique<ApplicationClient>(server.GetUnixSocketPath(), options);
+    }
+
+    return std::make_unique<ApplicationClient>(server.GetIpv4Address(), server.GetPort(), options);
+}
+
+void StartAndConnect(ApplicationClient& client)
+{
+    client.Start();
+
+    while(not client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    client.RequestOpen();
+
+    while(client.GetClientState() != ClientState::CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+}
+
+} // namespace InterProcessCommunication::Benchmark
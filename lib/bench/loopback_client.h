@@ -0,0 +1,31 @@
+#pragma once
+
+#include "application_client.h"
+#include "loopback_server.h"
+#include <memory>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+enum class Transport
+{
+    TCP,
+    UNIX,
+    // A unix domain socket that keeps message boundaries (see UnixSocketOptions)
+    UNIX_SEQPACKET
+};
+
+/*
+    \brief This function starts a loopback server on the given transport. Unix domain socket servers listen on a fresh path under /tmp.
+*/
+std::unique_ptr<LoopbackServer> CreateLoopbackServer(LoopbackServerMode mode, Transport transport);
+/*
+    \brief This function creates a client for the server's transport without starting it. A UNIX_SEQPACKET client gets its socket type set in the options.
+*/
+std::unique_ptr<ApplicationClient> CreateLoopbackClient(const LoopbackServer& server, Transport transport, const ClientOptions& options = {});
+/*
+    \brief This function starts the client's worker threads and blocks until the client is connected
+*/
+void StartAndConnect(ApplicationClient& client);
+
+} // namespace InterProcessCommunication::Benchmark
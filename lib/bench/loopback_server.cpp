@@ -0,0 +1,428 @@
+#include "loopback_server.h"
+#include <arpa/inet.h>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <algorithm>
+#include <unistd.h>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace InterProcessCommunication::Benchmark
+{
+LoopbackServer::~LoopbackServer()
+{
+    m_running = false;
+
+    const uint64_t wakeup_count = 1;
+    (void)write(m_wakeup_file_descriptor, &wakeup_count, sizeof(wakeup_count));
+
+    if(m_thread.joinable())
+    {
+        m_thread.join();
+    }
+
+    for(const int connection_file_descriptor : m_connection_file_descriptors)
+    {
+        close(connection_file_descriptor);
+    }
+
+    close(m_wakeup_file_descriptor);
+    close(m_epoll_file_descriptor);
+    close(m_listen_file_descriptor);
+
+    if(not m_unix_socket_path.empty())
+    {
+        unlink(m_unix_socket_path.c_str());
+    }
+}
+
+LoopbackServer::LoopbackServer(LoopbackServerMode mode)
+: m_mode(mode)
+{
+    m_listen_file_descriptor = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+
+    const int socket_option = 1;
+    setsockopt(m_listen_file_descriptor, SOL_SOCKET, SO_REUSEADDR, &socket_option, sizeof(socket_option));
+
+    // Let the kernel pick a free port so that benchmarks never collide with each other or the tests
+    sockaddr_in address {};
+    address.sin_family = AF_INET;
+    address.sin_port = 0;
+    inet_pton(AF_INET, m_ipv4_address.c_str(), &address.sin_addr);
+
+    if(bind(m_listen_file_descriptor, (sockaddr*)&address, sizeof(address)) < 0 || listen(m_listen_file_descriptor, SOMAXCONN) < 0)
+    {
+        throw std::runtime_error("LoopbackServer -> Failed to listen on the loopback interface");
+    }
+
+    socklen_t address_length = sizeof(address);
+    getsockname(m_listen_file_descriptor, (sockaddr*)&address, &address_length);
+    m_port = ntohs(address.sin_port);
+
+    StartEventLoop();
+}
+
+LoopbackServer::LoopbackServer(LoopbackServerMode mode, const std::string& unix_socket_path, int socket_type)
+: m_mode(mode)
+, m_socket_type(socket_type)
+, m_unix_socket_path(unix_socket_path)
+{
+    m_listen_file_descriptor = socket(AF_UNIX, socket_type | SOCK_NONBLOCK, 0);
+
+    unlink(m_unix_socket_path.c_str());
+
+    sockaddr_un address {};
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, m_unix_socket_path.c_str(), sizeof(address.sun_path) - 1);
+
+    if(bind(m_listen_file_descriptor, (sockaddr*)&address, sizeof(address)) < 0 || listen(m_listen_file_descriptor, SOMAXCONN) < 0)
+    {
+        throw std::runtime_error("LoopbackServer -> Failed to listen on unix domain socket: " + m_unix_socket_path);
+    }
+
+    StartEventLoop();
+}
+
+const std::string& LoopbackServer::GetIpv4Address() const
+{
+    return m_ipv4_address;
+}
+
+uint16_t LoopbackServer::GetPort() const
+{
+    return m_port;
+}
+
+const std::string& LoopbackServer::GetUnixSocketPath() const
+{
+    return m_unix_socket_path;
+}
+
+uint64_t LoopbackServer::GetConnectionCount() const
+{
+    return m_connection_count;
+}
+
+uint64_t LoopbackServer::GetReceivedBytes() const
+{
+    return m_received_bytes;
+}
+
+void LoopbackServer::SetRxObserver(RxObserver rx_observer)
+{
+    m_rx_observer = std::move(rx_observer);
+}
+
+void LoopbackServer::WaitForConnections(uint64_t connection_count) const
+{
+    uint64_t current_count = m_connection_count;
+
+    while(current_count < connection_count)
+    {
+        m_connection_count.wait(current_count);
+        current_count = m_connection_count;
+    }
+}
+
+void LoopbackServer::WaitForReceivedBytes(uint64_t received_bytes) const
+{
+    uint64_t current_bytes = m_received_bytes;
+
+    while(current_bytes < received_bytes)
+    {
+        m_received_bytes.wait(current_bytes);
+        current_bytes = m_received_bytes;
+    }
+}
+
+void LoopbackServer::StartEventLoop()
+{
+    m_epoll_file_descriptor = epoll_create1(EPOLL_CLOEXEC);
+    m_wakeup_file_descriptor = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    epoll_event listen_event {};
+    listen_event.events = EPOLLIN;
+    listen_event.data.fd = m_listen_file_descriptor;
+    epoll_ctl(m_epoll_file_descriptor, EPOLL_CTL_ADD, m_listen_file_descriptor, &listen_event);
+
+    epoll_event wakeup_event {};
+    wakeup_event.events = EPOLLIN;
+    wakeup_event.data.fd = m_wakeup_file_descriptor;
+    epoll_ctl(m_epoll_file_descriptor, EPOLL_CTL_ADD, m_wakeup_file_descriptor, &wakeup_event);
+
+    m_thread = std::thread(&LoopbackServer::RunEventLoop, this);
+}
+
+void LoopbackServer::RunEventLoop()
+{
+    epoll_event events[MAX_EVENTS_PER_WAIT];
+
+    while(m_running)
+    {
+        const int event_count = epoll_wait(m_epoll_file_descriptor, events, MAX_EVENTS_PER_WAIT, -1);
+
+        for(int index = 0; index < event_count; ++index)
+        {
+            const int file_descriptor = events[index].data.fd;
+
+            if(file_descriptor == m_wakeup_file_descriptor)
+            {
+                continue;
+            }
+
+            if(file_descriptor == m_listen_file_descriptor)
+            {
+                AcceptConnections();
+                continue;
+            }
+
+            ServeConnection(file_descriptor, events[index].events);
+        }
+    }
+}
+
+void LoopbackServer::AcceptConnections()
+{
+    while(true)
+    {
+        const int connection_file_descriptor = accept4(m_listen_file_descriptor, nullptr, nullptr, SOCK_NONBLOCK);
+
+        if(connection_file_descriptor < 0)
+        {
+            return;
+        }
+
+        epoll_event connection_event {};
+        connection_event.events = m_mode == LoopbackServerMode::SOURCE ? (EPOLLIN | EPOLLOUT | EPOLLRDHUP) : (EPOLLIN | EPOLLRDHUP);
+        connection_event.data.fd = connection_file_descriptor;
+        epoll_ctl(m_epoll_file_descriptor, EPOLL_CTL_ADD, connection_file_descriptor, &connection_event);
+        m_connection_file_descriptors.push_back(connection_file_descriptor);
+
+        ++m_connection_count;
+        m_connection_count.notify_all();
+    }
+}
+
+void LoopbackServer::ServeConnection(int connection_file_descriptor, uint32_t events)
+{
+    if(m_mode == LoopbackServerMode::SOURCE && (events & EPOLLOUT) && not (events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)))
+    {
+        StreamToConnection(connection_file_descriptor);
+        return;
+    }
+
+    if(m_socket_type == SOCK_SEQPACKET)
+    {
+        ServeMessages(connection_file_descriptor);
+        return;
+    }
+
+    iovec rx_iovec {.iov_base = m_rx_buffer.data(), .iov_len = m_rx_buffer.size()};
+    msghdr rx_message {};
+    rx_message.msg_iov = &rx_iovec;
+    rx_message.msg_iovlen = 1;
+    rx_message.msg_control = m_rx_control.data();
+    rx_message.msg_controllen = m_rx_control.size();
+
+    const ssize_t read_bytes = recvmsg(connection_file_descriptor, &rx_message, MSG_DONTWAIT | MSG_CMSG_CLOEXEC);
+
+    if(read_bytes == 0 || (read_bytes < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+    {
+        CloseConnection(connection_file_descriptor);
+        return;
+    }
+
+    if(read_bytes < 0)
+    {
+        return;
+    }
+
+    const std::vector<int> rx_file_descriptors = TakeFileDescriptors(rx_message);
+
+    if(m_mode == LoopbackServerMode::ECHO)
+    {
+        WriteAll(connection_file_descriptor, m_rx_buffer.data(), read_bytes, rx_file_descriptors);
+    }
+
+    for(const int rx_file_descriptor : rx_file_descriptors)
+    {
+        close(rx_file_descriptor);
+    }
+
+    if(m_rx_observer)
+    {
+        m_rx_observer(std::span<char>(m_rx_buffer.data(), read_bytes));
+    }
+
+    m_received_bytes += read_bytes;
+    m_received_bytes.notify_all();
+}
+
+void LoopbackServer::ServeMessages(int connection_file_descriptor)
+{
+    constexpr size_t message_capacity = RX_BUFFER_SIZE / MAX_MESSAGES_PER_READ;
+
+    std::array<iovec, MAX_MESSAGES_PER_READ> message_iovecs {};
+    std::array<mmsghdr, MAX_MESSAGES_PER_READ> messages {};
+
+    for(size_t index = 0; index < MAX_MESSAGES_PER_READ; ++index)
+    {
+        message_iovecs[index] = iovec{.iov_base = m_rx_buffer.data() + index * message_capacity, .iov_len = message_capacity};
+        messages[index].msg_hdr.msg_iov = &message_iovecs[index];
+        messages[index].msg_hdr.msg_iovlen = 1;
+    }
+
+    const int read_messages = recvmmsg(connection_file_descriptor, messages.data(), messages.size(), MSG_DONTWAIT, nullptr);
+
+    if(read_messages < 0)
+    {
+        if(errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+        {
+            CloseConnection(connection_file_descriptor);
+        }
+
+        return;
+    }
+
+    // An empty message marks the end of the connection, after the messages that arrived before it
+    const size_t message_count = std::find_if(messages.begin(), messages.begin() + read_messages, [](const mmsghdr& message){ return message.msg_len == 0; }) - messages.begin();
+    uint64_t read_bytes = 0;
+
+    for(size_t index = 0; index < message_count; ++index)
+    {
+        message_iovecs[index].iov_len = messages[index].msg_len;
+        read_bytes += messages[index].msg_len;
+
+        if(m_rx_observer)
+        {
+            m_rx_observer(std::span<char>(static_cast<char*>(message_iovecs[index].iov_base), messages[index].msg_len));
+        }
+    }
+
+    for(size_t sent_messages = 0; m_mode == LoopbackServerMode::ECHO && sent_messages < message_count;)
+    {
+        const int sent_count = sendmmsg(connection_file_descriptor, messages.data() + sent_messages, message_count - sent_messages, MSG_DONTWAIT | MSG_NOSIGNAL);
+
+        if(sent_count < 0)
+        {
+            if(errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            {
+                break;
+            }
+
+            pollfd writable {.fd = connection_file_descriptor, .events = POLLOUT, .revents = 0};
+            poll(&writable, 1, -1);
+            continue;
+        }
+
+        sent_messages += sent_count;
+    }
+
+    m_received_bytes += read_bytes;
+    m_received_bytes.notify_all();
+
+    if(message_count < static_cast<size_t>(read_messages))
+    {
+        CloseConnection(connection_file_descriptor);
+    }
+}
+
+void LoopbackServer::StreamToConnection(int connection_file_descriptor)
+{
+    // The receive buffer doubles as the source of the streamed bytes, since nothing is read in SOURCE mode
+    const ssize_t sent_bytes = send(connection_file_descriptor, m_rx_buffer.data(), m_rx_buffer.size(), MSG_DONTWAIT | MSG_NOSIGNAL);
+
+    if(sent_bytes < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+    {
+        CloseConnection(connection_file_descriptor);
+    }
+}
+
+void LoopbackServer::CloseConnection(int connection_file_descriptor)
+{
+    epoll_ctl(m_epoll_file_descriptor, EPOLL_CTL_DEL, connection_file_descriptor, nullptr);
+    close(connection_file_descriptor);
+    std::erase(m_connection_file_descriptors, connection_file_descriptor);
+}
+
+std::vector<int> LoopbackServer::TakeFileDescriptors(const msghdr& rx_message)
+{
+    std::vector<int> file_descriptors;
+
+    for(cmsghdr* control_message = CMSG_FIRSTHDR(&rx_message); control_message != nullptr; control_message = CMSG_NXTHDR(const_cast<msghdr*>(&rx_message), control_message))
+    {
+        if(control_message->cmsg_level != SOL_SOCKET || control_message->cmsg_type != SCM_RIGHTS)
+        {
+            continue;
+        }
+
+        const size_t descriptor_count = (control_message->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+
+        for(size_t index = 0; index < descriptor_count; ++index)
+        {
+            int file_descriptor = -1;
+            std::memcpy(&file_descriptor, CMSG_DATA(control_message) + index * sizeof(int), sizeof(int));
+            file_descriptors.push_back(file_descriptor);
+        }
+    }
+
+    return file_descriptors;
+}
+
+void LoopbackServer::WriteAll(int connection_file_descriptor, const char* data, size_t size, const std::vector<int>& file_descriptors)
+{
+    // The descriptors go back with the first echoed byte, just as they arrived with the first byte of the read
+    alignas(cmsghdr) std::array<char, CMSG_SPACE(sizeof(int) * MAX_FILE_DESCRIPTORS_PER_READ)> tx_control {};
+    size_t tx_control_size = 0;
+
+    if(not file_descriptors.empty())
+    {
+        tx_control_size = CMSG_SPACE(sizeof(int) * file_descriptors.size());
+
+        msghdr control_header {};
+        control_header.msg_control = tx_control.data();
+        control_header.msg_controllen = tx_control_size;
+
+        cmsghdr* control_message = CMSG_FIRSTHDR(&control_header);
+        control_message->cmsg_level = SOL_SOCKET;
+        control_message->cmsg_type = SCM_RIGHTS;
+        control_message->cmsg_len = CMSG_LEN(sizeof(int) * file_descriptors.size());
+        std::memcpy(CMSG_DATA(control_message), file_descriptors.data(), sizeof(int) * file_descriptors.size());
+    }
+
+    while(size > 0)
+    {
+        iovec tx_iovec {.iov_base = const_cast<char*>(data), .iov_len = size};
+        msghdr tx_message {};
+        tx_message.msg_iov = &tx_iovec;
+        tx_message.msg_iovlen = 1;
+        tx_message.msg_control = tx_control_size > 0 ? tx_control.data() : nullptr;
+        tx_message.msg_controllen = tx_control_size;
+
+        const ssize_t sent_bytes = sendmsg(connection_file_descriptor, &tx_message, MSG_DONTWAIT | MSG_NOSIGNAL);
+
+        if(sent_bytes < 0)
+        {
+            if(errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            {
+                return;
+            }
+
+            pollfd writable {.fd = connection_file_descriptor, .events = POLLOUT, .revents = 0};
+            poll(&writable, 1, -1);
+            continue;
+        }
+
+        data += sent_bytes;
+        size -= sent_bytes;
+        tx_control_size = 0;
+    }
+}
+
+} // namespace InterProcessCommunication::Benchmark
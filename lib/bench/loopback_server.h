@@ -0,0 +1,96 @@
+#pragma once
+
+#include <sys/socket.h>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+enum class LoopbackServerMode
+{
+    SINK,
+    ECHO,
+    SOURCE
+};
+
+/*
+    \brief A single-threaded epoll server on the loopback interface (or a unix domain socket) that stands in for the remote peer in benchmarks.
+        A unix domain socket server may listen on a SOCK_SEQPACKET socket instead, where it reads a batch of messages at a time and ECHO mode sends every one of them back as one.
+        In SINK mode it discards everything it reads, in ECHO mode it writes every byte back to the connection it came from,
+        together with any descriptors that were passed with SCM_RIGHTS, and in SOURCE mode it streams bytes to every connection for as long as the connection is writable.
+*/
+class LoopbackServer
+{
+public:
+
+    LoopbackServer(const LoopbackServer&) = delete;
+    LoopbackServer& operator=(const LoopbackServer&) = delete;
+    LoopbackServer(LoopbackServer&&) = delete;
+    LoopbackServer& operator=(LoopbackServer&&) = delete;
+    ~LoopbackServer();
+    explicit LoopbackServer(LoopbackServerMode mode);
+    LoopbackServer(LoopbackServerMode mode, const std::string& unix_socket_path, int socket_type = SOCK_STREAM);
+
+    const std::string& GetIpv4Address() const;
+    uint16_t GetPort() const;
+    const std::string& GetUnixSocketPath() const;
+
+    uint64_t GetConnectionCount() const;
+    uint64_t GetReceivedBytes() const;
+
+    using RxObserver = std::function<void(const std::span<char>& rx_bytes)>;
+
+    /*
+        \brief This function sets a callback that sees every read in SINK and ECHO mode, on the server's thread. It must be set before the first client connects.
+    */
+    void SetRxObserver(RxObserver rx_observer);
+
+    void WaitForConnections(uint64_t connection_count) const;
+    void WaitForReceivedBytes(uint64_t received_bytes) const;
+
+private:
+
+    static constexpr int MAX_EVENTS_PER_WAIT { 256 };
+    static constexpr size_t RX_BUFFER_SIZE { 65536 };
+    static constexpr size_t MAX_FILE_DESCRIPTORS_PER_READ { 253 };
+    // Every message of a SEQPACKET read gets an equal share of the RX buffer
+    static constexpr size_t MAX_MESSAGES_PER_READ { 64 };
+
+    const std::string m_ipv4_address { "127.0.0.1" };
+    const LoopbackServerMode m_mode;
+    const int m_socket_type { SOCK_STREAM };
+    std::string m_unix_socket_path;
+    uint16_t m_port { 0 };
+
+    int m_listen_file_descriptor { -1 };
+    int m_epoll_file_descriptor { -1 };
+    int m_wakeup_file_descriptor { -1 };
+
+    std::atomic<bool> m_running { true };
+    std::atomic<uint64_t> m_connection_count { 0 };
+    std::atomic<uint64_t> m_received_bytes { 0 };
+
+    std::vector<int> m_connection_file_descriptors;
+    std::vector<char> m_rx_buffer = std::vector<char>(RX_BUFFER_SIZE);
+    std::vector<char> m_rx_control = std::vector<char>(CMSG_SPACE(sizeof(int) * MAX_FILE_DESCRIPTORS_PER_READ));
+    RxObserver m_rx_observer;
+    std::thread m_thread;
+
+    void StartEventLoop();
+    void RunEventLoop();
+    void AcceptConnections();
+    void ServeConnection(int connection_file_descriptor, uint32_t events);
+    void ServeMessages(int connection_file_descriptor);
+    void StreamToConnection(int connection_file_descriptor);
+    void CloseConnection(int connection_file_descriptor);
+    static std::vector<int> TakeFileDescriptors(const msghdr& rx_message);
+    void WriteAll(int connection_file_descriptor, const char* data, size_t size, const std::vector<int>& file_descriptors);
+};
+
+} // namespace InterProcessCommunication::Benchmark
@@ -0,0 +1,89 @@
+#include "loopback_client.h"
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <memory>
+#include <semaphore>
+#include <vector>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+namespace
+{
+
+enum class TxPath
+{
+    INLINE,
+    MEMFD_COPIED,
+    MEMFD_IN_PLACE
+};
+
+ClientOptions CreateRoundTripOptions(TxPath tx_path)
+{
+    ClientOptions options;
+    options.framing.enabled = true;
+    options.framing.max_frame_size = 64 * 1024 * 1024;
+    options.rx_buffer.buffer_size = 64 * 1024;
+    options.rx_buffer.max_buffer_size = 1024 * 1024;
+    options.memfd_transfer.enabled = tx_path != TxPath::INLINE;
+    options.memfd_transfer.min_payload_size = 0;
+
+    return options;
+}
+
+/*
+    Every iteration writes one payload, sends it through the echo server over a unix domain socket and waits until the client has received it back
+    and scanned every byte. Inline payloads are copied through both sockets' buffers in each direction, while a memfd payload is copied into
+    the memfd once (or written there in place by the producer) and only its descriptor and a 4-byte header travel through the sockets.
+*/
+void BM_MemfdRoundTrip(benchmark::State& state, TxPath tx_path)
+{
+    const size_t payload_size = state.range(0);
+
+    const std::unique_ptr<LoopbackServer> server = CreateLoopbackServer(LoopbackServerMode::ECHO, Transport::UNIX);
+    const std::unique_ptr<ApplicationClient> client = CreateLoopbackClient(*server, Transport::UNIX, CreateRoundTripOptions(tx_path));
+
+    std::binary_semaphore rx_semaphore(0);
+    bool is_intact = true;
+
+    client->SetRxCallback([&](const std::span<char>& rx_bytes)
+    {
+        is_intact = is_intact && rx_bytes.size() == payload_size && std::memchr(rx_bytes.data(), 'y', rx_bytes.size()) == nullptr;
+        rx_semaphore.release();
+    });
+
+    StartAndConnect(*client);
+
+    for(auto _ : state)
+    {
+        if(tx_path == TxPath::MEMFD_IN_PLACE)
+        {
+            std::optional<MemfdPayload> memfd_payload = MemfdPayload::Create(payload_size);
+            std::memset(memfd_payload->GetBytes().data(), 'x', payload_size);
+            client->EnqueuePayload(std::move(memfd_payload.value()));
+        }
+        else
+        {
+            std::vector<char> payload(payload_size);
+            std::memset(payload.data(), 'x', payload_size);
+            client->EnqueuePayload(std::move(payload));
+        }
+
+        rx_semaphore.acquire();
+    }
+
+    if(not is_intact)
+    {
+        state.SkipWithError("Received a payload that differs from the sent one");
+    }
+
+    state.SetBytesProcessed(state.iterations() * payload_size);
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_MemfdRoundTrip, inline, TxPath::INLINE)->RangeMultiplier(4)->Range(64 * 1024, 16 * 1024 * 1024)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_MemfdRoundTrip, memfd_copied, TxPath::MEMFD_COPIED)->RangeMultiplier(4)->Range(64 * 1024, 16 * 1024 * 1024)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_MemfdRoundTrip, memfd_in_place, TxPath::MEMFD_IN_PLACE)->RangeMultiplier(4)->Range(64 * 1024, 16 * 1024 * 1024)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+} // namespace InterProcessCommunication::Benchmark
@@ -0,0 +1,175 @@
+#include "client_reactor.h"
+#include "loopback_client.h"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+namespace
+{
+
+enum class ClientDriver
+{
+    WORKER_THREADS,
+    EPOLL_REACTOR,
+    IO_URING_REACTOR
+};
+
+constexpr size_t ROUND_TRIP_MESSAGE_SIZE = 64;
+constexpr size_t THROUGHPUT_MESSAGE_SIZE = 16 * 1024;
+constexpr std::chrono::milliseconds CLIENT_STATE_POLL_INTERVAL { 1 };
+
+/*
+    Connects connection_count echo clients through the given driver. The reactor is only created for the reactor drivers,
+    so the worker thread runs do not pay for an idle event loop.
+*/
+class EchoClients
+{
+public:
+
+    EchoClients(ClientDriver client_driver, Transport transport, size_t connection_count)
+    : m_server(CreateLoopbackServer(LoopbackServerMode::ECHO, transport))
+    {
+        if(client_driver != ClientDriver::WORKER_THREADS)
+        {
+            m_reactor.emplace(1, client_driver == ClientDriver::IO_URING_REACTOR ? ReactorBackend::IO_URING : ReactorBackend::EPOLL);
+            m_reactor->Start();
+        }
+
+        for(size_t index = 0; index < connection_count; ++index)
+        {
+            m_clients.emplace_back(CreateLoopbackClient(*m_server, transport));
+
+            m_clients.back()->SetRxCallback([this](const std::span<char>& rx_bytes)
+            {
+                m_received_bytes += rx_bytes.size();
+                m_received_bytes.notify_all();
+            });
+
+            if(m_reactor.has_value())
+            {
+                m_clients.back()->Start(*m_reactor);
+            }
+            else
+            {
+                m_clients.back()->Start();
+
+                while(not m_clients.back()->IsRunning())
+                {
+                    std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+                }
+            }
+
+            m_clients.back()->RequestOpen();
+        }
+
+        for(const std::unique_ptr<ApplicationClient>& client : m_clients)
+        {
+            while(client->GetClientState() != ClientState::CONNECTED)
+            {
+                std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+            }
+        }
+
+        m_server->WaitForConnections(connection_count);
+    }
+
+    ~EchoClients()
+    {
+        // The clients must be gone before the reactor that drives them
+        m_clients.clear();
+    }
+
+    const std::vector<std::unique_ptr<ApplicationClient>>& GetClients() const
+    {
+        return m_clients;
+    }
+
+    void WaitForReceivedBytes(uint64_t expected_bytes)
+    {
+        uint64_t current_bytes = m_received_bytes;
+
+        while(current_bytes < expected_bytes)
+        {
+            m_received_bytes.wait(current_bytes);
+            current_bytes = m_received_bytes;
+        }
+    }
+
+private:
+
+    std::unique_ptr<LoopbackServer> m_server;
+    std::optional<ClientReactor> m_reactor;
+    std::vector<std::unique_ptr<ApplicationClient>> m_clients;
+    std::atomic<uint64_t> m_received_bytes { 0 };
+};
+
+/*
+    A single client sends a small message and waits for its echo before sending the next one, so every iteration is one round trip.
+*/
+void BM_EchoRoundTrip(benchmark::State& state, ClientDriver client_driver, Transport transport)
+{
+    EchoClients echo_clients(client_driver, transport, 1);
+    ApplicationClient& client = *echo_clients.GetClients().front();
+
+    std::string message(ROUND_TRIP_MESSAGE_SIZE, 'x');
+    uint64_t expected_bytes = 0;
+
+    for(auto _ : state)
+    {
+        client.EnqueuePayload(std::span<char>(message));
+        expected_bytes += ROUND_TRIP_MESSAGE_SIZE;
+        echo_clients.WaitForReceivedBytes(expected_bytes);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/*
+    Every client sends one large message per iteration and the iteration ends once all of the echoes are back,
+    so the event loop has many connections with bulk data in flight at the same time.
+*/
+void BM_EchoThroughput(benchmark::State& state, ClientDriver client_driver, Transport transport)
+{
+    const size_t connection_count = state.range(0);
+
+    EchoClients echo_clients(client_driver, transport, connection_count);
+
+    std::string message(THROUGHPUT_MESSAGE_SIZE, 'x');
+    uint64_t expected_bytes = 0;
+
+    for(auto _ : state)
+    {
+        for(const std::unique_ptr<ApplicationClient>& client : echo_clients.GetClients())
+        {
+            client->EnqueuePayload(std::span<char>(message));
+        }
+
+        expected_bytes += connection_count * THROUGHPUT_MESSAGE_SIZE;
+        echo_clients.WaitForReceivedBytes(expected_bytes);
+    }
+
+    state.SetItemsProcessed(state.iterations() * connection_count);
+    state.SetBytesProcessed(state.iterations() * connection_count * THROUGHPUT_MESSAGE_SIZE);
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_EchoRoundTrip, worker_threads_tcp, ClientDriver::WORKER_THREADS, Transport::TCP)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_EchoRoundTrip, epoll_tcp, ClientDriver::EPOLL_REACTOR, Transport::TCP)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_EchoRoundTrip, io_uring_tcp, ClientDriver::IO_URING_REACTOR, Transport::TCP)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_EchoRoundTrip, worker_threads_unix, ClientDriver::WORKER_THREADS, Transport::UNIX)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_EchoRoundTrip, epoll_unix, ClientDriver::EPOLL_REACTOR, Transport::UNIX)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_EchoRoundTrip, io_uring_unix, ClientDriver::IO_URING_REACTOR, Transport::UNIX)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_EchoThroughput, worker_threads_tcp, ClientDriver::WORKER_THREADS, Transport::TCP)->Arg(64)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_EchoThroughput, epoll_tcp, ClientDriver::EPOLL_REACTOR, Transport::TCP)->Arg(64)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_EchoThroughput, io_uring_tcp, ClientDriver::IO_URING_REACTOR, Transport::TCP)->Arg(64)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_EchoThroughput, worker_threads_unix, ClientDriver::WORKER_THREADS, Transport::UNIX)->Arg(64)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_EchoThroughput, epoll_unix, ClientDriver::EPOLL_REACTOR, Transport::UNIX)->Arg(64)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_EchoThroughput, io_uring_unix, ClientDriver::IO_URING_REACTOR, Transport::UNIX)->Arg(64)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+} // namespace InterProcessCommunication::Benchmark
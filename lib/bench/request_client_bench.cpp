@@ -0,0 +1,100 @@
+#include "loopback_client.h"
+#include "request_client.h"
+#include <benchmark/benchmark.h>
+#include <memory>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+namespace
+{
+
+constexpr size_t REQUEST_BODY_SIZE = 64;
+constexpr uint64_t REQUESTS_PER_BATCH = 1000;
+
+std::unique_ptr<RequestClient> CreateLoopbackRequestClient(const LoopbackServer& server, Transport transport)
+{
+    ClientOptions client_options;
+    client_options.socket = SocketOptions::LowLatency();
+
+    if(transport == Transport::UNIX)
+    {
+        return std::make_unique<RequestClient>(server.GetUnixSocketPath(), client_options);
+    }
+
+    return std::make_unique<RequestClient>(server.GetIpv4Address(), server.GetPort(), client_options);
+}
+
+bool TakeUnsentRequest(std::atomic<uint64_t>& unsent_requests)
+{
+    uint64_t current_count = unsent_requests;
+
+    while(current_count > 0 && not unsent_requests.compare_exchange_weak(current_count, current_count - 1))
+    {
+    }
+
+    return current_count > 0;
+}
+
+/*
+    Every batch sends a thousand requests to the echo server, which returns each request as its own reply, with up to the given number of requests in flight.
+    Every reply makes room for the next request, so one request in flight is the serialised request/response pattern that the pipelining replaces.
+*/
+void BM_PipelinedRequests(benchmark::State& state, Transport transport)
+{
+    const size_t requests_in_flight = state.range(0);
+
+    // Declared ahead of the client, since its reply callbacks refer to them until the client is destroyed
+    std::atomic<uint64_t> unsent_requests { 0 };
+    std::atomic<uint64_t> unanswered_requests { 0 };
+    ReplyCallback reply_callback;
+
+    const std::unique_ptr<LoopbackServer> server = CreateLoopbackServer(LoopbackServerMode::ECHO, transport);
+    const std::unique_ptr<RequestClient> request_client = CreateLoopbackRequestClient(*server, transport);
+    const std::string body(REQUEST_BODY_SIZE, 'x');
+
+    reply_callback = [&](RequestReply&& reply)
+    {
+        benchmark::DoNotOptimize(reply.body.data());
+
+        if(TakeUnsentRequest(unsent_requests))
+        {
+            request_client->SendRequest(std::span<const char>(body), reply_callback);
+        }
+
+        if(--unanswered_requests == 0)
+        {
+            unanswered_requests.notify_all();
+        }
+    };
+
+    StartAndConnect(request_client->GetClient());
+
+    while(state.KeepRunningBatch(REQUESTS_PER_BATCH))
+    {
+        unsent_requests = REQUESTS_PER_BATCH;
+        unanswered_requests = REQUESTS_PER_BATCH;
+
+        for(size_t count = 0; count < requests_in_flight && TakeUnsentRequest(unsent_requests); ++count)
+        {
+            request_client->SendRequest(std::span<const char>(body), reply_callback);
+        }
+
+        uint64_t current_count = unanswered_requests;
+
+        while(current_count != 0)
+        {
+            unanswered_requests.wait(current_count);
+            current_count = unanswered_requests;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_PipelinedRequests, tcp, Transport::TCP)->Arg(1)->Arg(8)->Arg(64)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_PipelinedRequests, unix_domain, Transport::UNIX)->Arg(1)->Arg(8)->Arg(64)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+} // namespace InterProcessCommunication::Benchmark
@@ -0,0 +1,210 @@
+#include "loopback_client.h"
+#include <benchmark/benchmark.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+namespace
+{
+
+constexpr size_t MESSAGE_SIZE = 64;
+// A frame of the default framing options holds a 4-byte big-endian length
+constexpr size_t FRAME_HEADER_SIZE = 4;
+constexpr size_t FRAMES_PER_WRITE = 240;
+constexpr size_t RX_BUFFER_SIZE = 16 * 1024;
+constexpr size_t MAX_BATCH_MESSAGES = 1024;
+
+// Stands in for the queue that an application hands its messages on to, which takes a lock per hand-off
+struct MessageSink
+{
+    std::mutex mutex;
+    size_t message_count = 0;
+    uint64_t byte_count = 0;
+    size_t hand_off_count = 0;
+    std::atomic<size_t> published_messages { 0 };
+
+    void Publish(size_t received_messages)
+    {
+        published_messages += received_messages;
+        published_messages.notify_all();
+    }
+};
+
+std::vector<char> CreateFrames()
+{
+    std::vector<char> frames;
+    frames.reserve(FRAMES_PER_WRITE * (FRAME_HEADER_SIZE + MESSAGE_SIZE));
+
+    for(size_t index = 0; index < FRAMES_PER_WRITE; ++index)
+    {
+        for(int shift = 24; shift >= 0; shift -= 8)
+        {
+            frames.push_back(static_cast<char>((MESSAGE_SIZE >> shift) & 0xFF));
+        }
+
+        frames.insert(frames.end(), MESSAGE_SIZE, 'x');
+    }
+
+    return frames;
+}
+
+// Listens on a unix domain socket of its own, so that the benchmark thread can write to the client's connection itself
+int ListenOnUnixSocket(const std::string& unix_socket_path)
+{
+    unlink(unix_socket_path.c_str());
+
+    const int listen_file_descriptor = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    sockaddr_un address {};
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, unix_socket_path.c_str(), sizeof(address.sun_path) - 1);
+
+    if(listen_file_descriptor < 0 || bind(listen_file_descriptor, (sockaddr*)&address, sizeof(address)) < 0 || listen(listen_file_descriptor, 1) < 0)
+    {
+        close(listen_file_descriptor);
+        return -1;
+    }
+
+    return listen_file_descriptor;
+}
+
+bool WriteAll(int file_descriptor, const std::vector<char>& bytes)
+{
+    size_t written_bytes = 0;
+
+    while(written_bytes < bytes.size())
+    {
+        const ssize_t sent_bytes = send(file_descriptor, bytes.data() + written_bytes, bytes.size() - written_bytes, MSG_NOSIGNAL);
+
+        if(sent_bytes <= 0)
+        {
+            return false;
+        }
+
+        written_bytes += sent_bytes;
+    }
+
+    return true;
+}
+
+/*
+    The benchmark thread streams 64-byte framed messages to the client over a unix domain socket as fast as the client takes them, so the RX consumer
+    sets the pace. Without batching every message takes an RX callback call and a lock of its own, while the batch callback is called once with everything
+    that the RX consumer found available, and locks once. messages_per_call and messages_per_read show how much of the stream each call and each read took.
+*/
+void BM_RxMessageStream(benchmark::State& state, bool is_batched)
+{
+    const std::string unix_socket_path = "/tmp/rx_batch_bench_" + std::to_string(getpid()) + ".sock";
+    const int listen_file_descriptor = ListenOnUnixSocket(unix_socket_path);
+
+    if(listen_file_descriptor < 0)
+    {
+        state.SkipWithError("Failed to listen");
+        return;
+    }
+
+    ClientOptions options;
+    options.framing.enabled = true;
+    options.rx_buffer.buffer_size = RX_BUFFER_SIZE;
+    options.rx_buffer.max_buffer_size = RX_BUFFER_SIZE;
+    options.rx_batch.max_messages = MAX_BATCH_MESSAGES;
+    // A batch retains the buffers of every read that went into it
+    options.rx_buffer.max_pooled_buffers = MAX_BATCH_MESSAGES / FRAMES_PER_WRITE + 2;
+
+    MessageSink sink;
+    const std::unique_ptr<ApplicationClient> client = std::make_unique<ApplicationClient>(unix_socket_path, options);
+
+    if(is_batched)
+    {
+        client->SetRxBatchCallback([&](std::span<const RxMessage> rx_messages)
+        {
+            {
+                std::lock_guard<std::mutex> lock(sink.mutex);
+
+                for(const RxMessage& rx_message : rx_messages)
+                {
+                    ++sink.message_count;
+                    sink.byte_count += rx_message.bytes.size();
+                }
+
+                ++sink.hand_off_count;
+            }
+
+            sink.Publish(rx_messages.size());
+        });
+    }
+    else
+    {
+        client->SetRxCallback([&](const std::span<char>& rx_bytes)
+        {
+            {
+                std::lock_guard<std::mutex> lock(sink.mutex);
+                ++sink.message_count;
+                sink.byte_count += rx_bytes.size();
+                ++sink.hand_off_count;
+            }
+
+            sink.Publish(1);
+        });
+    }
+
+    StartAndConnect(*client);
+
+    const int connection_file_descriptor = accept(listen_file_descriptor, nullptr, nullptr);
+    const std::vector<char> frames = CreateFrames();
+    const uint64_t initial_recv_calls = client->GetStatistics().recv_calls;
+    size_t written_messages = 0;
+
+    for(auto _ : state)
+    {
+        if(not WriteAll(connection_file_descriptor, frames))
+        {
+            state.SkipWithError("Failed to write");
+            break;
+        }
+
+        written_messages += FRAMES_PER_WRITE;
+    }
+
+    // The messages still in the socket are a small fraction of the run, and are left out of the timing
+    size_t current_messages = sink.published_messages;
+
+    while(current_messages < written_messages)
+    {
+        sink.published_messages.wait(current_messages);
+        current_messages = sink.published_messages;
+    }
+
+    const uint64_t recv_calls = client->GetStatistics().recv_calls - initial_recv_calls;
+    size_t hand_off_count = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(sink.mutex);
+        hand_off_count = sink.hand_off_count;
+    }
+
+    client->RequestClose();
+    close(connection_file_descriptor);
+    close(listen_file_descriptor);
+    unlink(unix_socket_path.c_str());
+
+    state.SetItemsProcessed(written_messages);
+    state.counters["messages_per_call"] = static_cast<double>(written_messages) / std::max<size_t>(hand_off_count, 1);
+
+    if constexpr(ClientStatisticsRecorder::IS_COMPILED_IN)
+    {
+        state.counters["messages_per_read"] = static_cast<double>(written_messages) / std::max<uint64_t>(recv_calls, 1);
+    }
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_RxMessageStream, per_message, false)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_RxMessageStream, batched, true)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+} // namespace InterProcessCommunication::Benchmark
@@ -0,0 +1,82 @@
+#include "allocation_counter.h"
+#include "application_client.h"
+#include "loopback_server.h"
+#include "syscall_counter.h"
+#include <benchmark/benchmark.h>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+namespace
+{
+
+constexpr uint64_t BYTES_PER_ITERATION = 1024 * 1024;
+constexpr std::chrono::milliseconds CLIENT_STATE_POLL_INTERVAL { 1 };
+
+/*
+    The source server streams to the client as fast as it reads, and every iteration waits until another megabyte has arrived.
+    The server neither receives nor allocates while streaming, so the counted recv calls and allocations were made by the client.
+*/
+void BM_RxStream(benchmark::State& state, size_t buffer_size, size_t max_buffer_size)
+{
+    ClientOptions options;
+    options.rx_buffer.buffer_size = buffer_size;
+    options.rx_buffer.max_buffer_size = max_buffer_size;
+
+    LoopbackServer server(LoopbackServerMode::SOURCE);
+    ApplicationClient client(server.GetIpv4Address(), server.GetPort(), options);
+
+    std::atomic<uint64_t> received_bytes { 0 };
+
+    client.SetRxCallback([&](const std::span<char>& rx_bytes)
+    {
+        received_bytes += rx_bytes.size();
+        received_bytes.notify_all();
+    });
+
+    client.Start();
+
+    while(not client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    client.RequestOpen();
+
+    while(client.GetClientState() != ClientState::CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    uint64_t expected_bytes = received_bytes + BYTES_PER_ITERATION;
+    const uint64_t initial_received_bytes = received_bytes;
+    const uint64_t initial_allocations = GetAllocationCount();
+    const uint64_t initial_recv_calls = GetSyscallCounts().recv_calls;
+
+    for(auto _ : state)
+    {
+        uint64_t current_bytes = received_bytes;
+
+        while(current_bytes < expected_bytes)
+        {
+            received_bytes.wait(current_bytes);
+            current_bytes = received_bytes;
+        }
+
+        expected_bytes = current_bytes + BYTES_PER_ITERATION;
+    }
+
+    const double megabytes = static_cast<double>(received_bytes - initial_received_bytes) / BYTES_PER_ITERATION;
+
+    state.SetBytesProcessed(received_bytes - initial_received_bytes);
+    state.counters["allocations_per_mb"] = (GetAllocationCount() - initial_allocations) / megabytes;
+    state.counters["recv_calls_per_mb"] = (GetSyscallCounts().recv_calls - initial_recv_calls) / megabytes;
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_RxStream, fixed_1k, 1024, 1024)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_RxStream, fixed_64k, 64 * 1024, 64 * 1024)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_RxStream, adaptive_1k_to_256k, 1024, 256 * 1024)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+} // namespace InterProcessCommunication::Benchmark
@@ -0,0 +1,93 @@
+#include "loopback_client.h"
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <semaphore>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+namespace
+{
+
+constexpr size_t MESSAGE_SIZE = 512;
+constexpr size_t MESSAGES_PER_BURST = 64;
+constexpr std::chrono::microseconds HANDLER_TIME { 100 };
+constexpr std::chrono::microseconds READ_POLL_INTERVAL { 20 };
+
+/*
+    Every iteration sends a burst of framed messages to the echo server, whose RX callback takes 100 us per message (sleeping, like a handler that waits on I/O),
+    and waits until every callback has run. Both modes take about as long to deliver the burst, but drain_us shows how long the echoed bytes sat in the socket
+    before the RX consumer had read all of them: with the callbacks inline, reading waits for every callback ahead of it, while with dispatch it carries on right away.
+*/
+void BM_SlowHandlerBurst(benchmark::State& state, bool is_dispatched)
+{
+    if constexpr(not ClientStatisticsRecorder::IS_COMPILED_IN)
+    {
+        state.SkipWithError("The drain time is read from the statistics, which are compiled out");
+        return;
+    }
+
+    ClientOptions options;
+    options.framing.enabled = true;
+    options.tx_batch.enabled = true;
+    options.rx_dispatch.enabled = is_dispatched;
+    options.rx_dispatch.max_queued_messages = MESSAGES_PER_BURST;
+
+    std::atomic<size_t> received_messages { 0 };
+    std::binary_semaphore burst_semaphore(0);
+
+    const std::unique_ptr<LoopbackServer> server = CreateLoopbackServer(LoopbackServerMode::ECHO, Transport::UNIX);
+    const std::unique_ptr<ApplicationClient> client = CreateLoopbackClient(*server, Transport::UNIX, options);
+
+    client->SetRxCallback([&](const std::span<char>&)
+    {
+        std::this_thread::sleep_for(HANDLER_TIME);
+
+        if(++received_messages == MESSAGES_PER_BURST)
+        {
+            burst_semaphore.release();
+        }
+    });
+
+    StartAndConnect(*client);
+
+    const SharedPayload message = std::make_shared<const std::vector<char>>(MESSAGE_SIZE, 'x');
+    // Every message comes back behind a 4-byte frame header
+    const uint64_t burst_bytes = MESSAGES_PER_BURST * (MESSAGE_SIZE + 4);
+    uint64_t expected_rx_bytes = client->GetStatistics().rx_bytes;
+    std::chrono::nanoseconds drain_time { 0 };
+
+    for(auto _ : state)
+    {
+        received_messages = 0;
+        const auto burst_start = std::chrono::steady_clock::now();
+
+        for(size_t count = 0; count < MESSAGES_PER_BURST; ++count)
+        {
+            client->EnqueuePayload(message);
+        }
+
+        expected_rx_bytes += burst_bytes;
+
+        while(client->GetStatistics().rx_bytes < expected_rx_bytes)
+        {
+            std::this_thread::sleep_for(READ_POLL_INTERVAL);
+        }
+
+        drain_time += std::chrono::steady_clock::now() - burst_start;
+
+        burst_semaphore.acquire();
+    }
+
+    client->RequestClose();
+
+    state.SetItemsProcessed(state.iterations() * MESSAGES_PER_BURST);
+    state.counters["drain_us"] = std::chrono::duration<double, std::micro>(drain_time).count() / state.iterations();
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_SlowHandlerBurst, inline, false)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SlowHandlerBurst, dispatched, true)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+} // namespace InterProcessCommunication::Benchmark
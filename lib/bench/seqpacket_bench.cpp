@@ -0,0 +1,124 @@
+#include "loopback_client.h"
+#include "syscall_counter.h"
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <semaphore>
+#include <string>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+namespace
+{
+
+// Messages only have boundaries on a stream socket when they are framed
+constexpr size_t STREAM_FRAME_HEADER_SIZE = 4;
+
+ClientOptions CreateMessageOptions(Transport transport)
+{
+    ClientOptions options;
+    options.tx_batch.enabled = true;
+    options.framing.enabled = transport != Transport::UNIX_SEQPACKET;
+    options.rx_buffer.buffer_size = 4096;
+    options.rx_buffer.max_buffer_size = 4096;
+    options.unix_socket.rx_batch_messages = 64;
+
+    return options;
+}
+
+/*
+    Every iteration enqueues a burst of messages and waits until the sink server has read all of them. The sink server never sends,
+    so every counted send syscall was made by the client: gather writes of framed bytes on a stream socket, or sendmmsg() calls on a SEQPACKET socket.
+*/
+void BM_MessageTxBurst(benchmark::State& state, Transport transport)
+{
+    constexpr size_t MESSAGES_PER_ITERATION = 256;
+
+    const size_t message_size = state.range(0);
+    const size_t wire_size = transport == Transport::UNIX_SEQPACKET ? message_size : message_size + STREAM_FRAME_HEADER_SIZE;
+
+    const std::unique_ptr<LoopbackServer> server = CreateLoopbackServer(LoopbackServerMode::SINK, transport);
+    const std::unique_ptr<ApplicationClient> client = CreateLoopbackClient(*server, transport, CreateMessageOptions(transport));
+
+    StartAndConnect(*client);
+
+    const SharedPayload message = std::make_shared<const std::vector<char>>(message_size, 'x');
+    uint64_t expected_bytes = server->GetReceivedBytes();
+    const uint64_t initial_send_calls = GetSyscallCounts().send_calls;
+
+    for(auto _ : state)
+    {
+        for(size_t count = 0; count < MESSAGES_PER_ITERATION; ++count)
+        {
+            client->EnqueuePayload(message);
+        }
+
+        expected_bytes += MESSAGES_PER_ITERATION * wire_size;
+        server->WaitForReceivedBytes(expected_bytes);
+    }
+
+    const uint64_t message_count = state.iterations() * MESSAGES_PER_ITERATION;
+    const uint64_t send_calls = GetSyscallCounts().send_calls - initial_send_calls;
+
+    client->RequestClose();
+
+    state.SetItemsProcessed(message_count);
+    state.SetBytesProcessed(message_count * message_size);
+    state.counters["syscalls_per_message"] = static_cast<double>(send_calls) / message_count;
+}
+
+/*
+    Every iteration sends a burst of messages to the echo server and waits until all of them have come back through the RX callback.
+    On a stream socket the client splits the echoed bytes into frames, on a SEQPACKET socket the kernel hands them over a batch of messages at a time.
+    A burst of a single message measures the round trip latency.
+*/
+void BM_MessageEchoBurst(benchmark::State& state, Transport transport)
+{
+    const size_t message_size = state.range(0);
+    const size_t burst_size = state.range(1);
+
+    const std::unique_ptr<LoopbackServer> server = CreateLoopbackServer(LoopbackServerMode::ECHO, transport);
+    const std::unique_ptr<ApplicationClient> client = CreateLoopbackClient(*server, transport, CreateMessageOptions(transport));
+
+    std::atomic<size_t> received_messages { 0 };
+    std::binary_semaphore burst_semaphore(0);
+
+    client->SetRxCallback([&](const std::span<char>&)
+    {
+        if(++received_messages == burst_size)
+        {
+            burst_semaphore.release();
+        }
+    });
+
+    StartAndConnect(*client);
+
+    const SharedPayload message = std::make_shared<const std::vector<char>>(message_size, 'x');
+
+    for(auto _ : state)
+    {
+        received_messages = 0;
+
+        for(size_t count = 0; count < burst_size; ++count)
+        {
+            client->EnqueuePayload(message);
+        }
+
+        burst_semaphore.acquire();
+    }
+
+    client->RequestClose();
+
+    state.SetItemsProcessed(state.iterations() * burst_size);
+    state.SetBytesProcessed(state.iterations() * burst_size * message_size);
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_MessageTxBurst, unix_stream_framed, Transport::UNIX)->Arg(64)->Arg(512)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_MessageTxBurst, unix_seqpacket, Transport::UNIX_SEQPACKET)->Arg(64)->Arg(512)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_MessageEchoBurst, unix_stream_framed, Transport::UNIX)->ArgsProduct({{64, 512}, {1, 256}})->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_MessageEchoBurst, unix_seqpacket, Transport::UNIX_SEQPACKET)->ArgsProduct({{64, 512}, {1, 256}})->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+} // namespace InterProcessCommunication::Benchmark
@@ -0,0 +1,137 @@
+#include "loopback_client.h"
+#include "shared_memory_peer.h"
+#include <benchmark/benchmark.h>
+#include <unistd.h>
+#include <memory>
+#include <semaphore>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+namespace
+{
+
+constexpr std::chrono::milliseconds CLIENT_STATE_POLL_INTERVAL { 1 };
+
+// Writes every byte it receives back to the client, like the loopback server's ECHO mode
+class SharedMemoryEchoPeer
+{
+public:
+
+    SharedMemoryEchoPeer(const std::string& name, uint32_t busy_wait_microseconds)
+    : m_peer(SharedMemoryPeer::Create(name, SharedMemoryPeer::DEFAULT_RING_SIZE, busy_wait_microseconds))
+    , m_thread([this]()
+    {
+        std::vector<char> rx_bytes(64 * 1024);
+
+        if(not m_peer->WaitForClient())
+        {
+            return;
+        }
+
+        while(true)
+        {
+            const ssize_t read_bytes = m_peer->Receive(rx_bytes);
+
+            if(read_bytes <= 0 || not m_peer->SendAll(std::span<const char>(rx_bytes.data(), read_bytes)))
+            {
+                return;
+            }
+        }
+    })
+    {
+    }
+
+    ~SharedMemoryEchoPeer()
+    {
+        m_peer->Close();
+        m_thread.join();
+    }
+
+private:
+
+    const std::unique_ptr<SharedMemoryPeer> m_peer;
+    std::thread m_thread;
+};
+
+void ConnectClient(ApplicationClient& client)
+{
+    client.Start();
+
+    while(not client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    client.RequestOpen();
+
+    while(client.GetClientState() != ClientState::CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+}
+
+/*
+    Every iteration sends one framed message to an echo peer and waits until the client has received it back, so the time per iteration is one round trip.
+    Over a unix domain socket every message costs a send and a receive system call at either end. Through shared memory a side only enters the kernel
+    to sleep when its ring is empty, and to wake the other side when that side sleeps, which busy-waiting avoids altogether when each side has a core of its own.
+*/
+void BM_SharedMemoryRoundTrip(benchmark::State& state, bool is_shared_memory, uint32_t busy_wait_microseconds)
+{
+    const size_t message_size = state.range(0);
+
+    ClientOptions options;
+    options.framing.enabled = true;
+    options.rx_buffer.buffer_size = 64 * 1024;
+    options.rx_buffer.max_buffer_size = 64 * 1024;
+    options.shared_memory.busy_wait_microseconds = busy_wait_microseconds;
+
+    const std::string segment_name = "/application_client_bench_" + std::to_string(getpid());
+    std::unique_ptr<SharedMemoryEchoPeer> echo_peer;
+    std::unique_ptr<LoopbackServer> server;
+    std::unique_ptr<ApplicationClient> client;
+
+    if(is_shared_memory)
+    {
+        echo_peer = std::make_unique<SharedMemoryEchoPeer>(segment_name, busy_wait_microseconds);
+        client = std::make_unique<ApplicationClient>(SharedMemoryEndpoint{.name = segment_name}, options);
+    }
+    else
+    {
+        server = CreateLoopbackServer(LoopbackServerMode::ECHO, Transport::UNIX);
+        client = CreateLoopbackClient(*server, Transport::UNIX, options);
+    }
+
+    std::binary_semaphore rx_semaphore(0);
+
+    client->SetRxCallback([&](const std::span<char>&)
+    {
+        rx_semaphore.release();
+    });
+
+    ConnectClient(*client);
+
+    const SharedPayload message = std::make_shared<const std::vector<char>>(message_size, 'x');
+
+    for(auto _ : state)
+    {
+        client->EnqueuePayload(message);
+        rx_semaphore.acquire();
+    }
+
+    client->RequestClose();
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * message_size);
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_SharedMemoryRoundTrip, unix, false, 0)->RangeMultiplier(16)->Range(64, 16 * 1024)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SharedMemoryRoundTrip, shared_memory, true, 0)->RangeMultiplier(16)->Range(64, 16 * 1024)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SharedMemoryRoundTrip, shared_memory_busy_wait, true, 50)->RangeMultiplier(16)->Range(64, 16 * 1024)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+} // namespace InterProcessCommunication::Benchmark
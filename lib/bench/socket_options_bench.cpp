@@ -0,0 +1,134 @@
+#include "loopback_client.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <vector>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+namespace
+{
+
+enum class SocketPreset
+{
+    DEFAULT,
+    LOW_LATENCY,
+    BULK_THROUGHPUT
+};
+
+constexpr size_t ROUND_TRIP_MESSAGE_SIZE = 64;
+constexpr size_t BULK_PAYLOAD_SIZE = 256 * 1024;
+constexpr uint64_t BULK_BYTES_PER_ITERATION = 16 * 1024 * 1024;
+
+ClientOptions CreatePresetOptions(SocketPreset socket_preset)
+{
+    ClientOptions options;
+
+    if(socket_preset == SocketPreset::LOW_LATENCY)
+    {
+        options.socket = SocketOptions::LowLatency();
+    }
+    else if(socket_preset == SocketPreset::BULK_THROUGHPUT)
+    {
+        options.socket = SocketOptions::BulkThroughput();
+    }
+
+    return options;
+}
+
+/*
+    Every iteration is one round trip of a small message through the echo server, which is where Nagle's algorithm and delayed ACKs show up.
+*/
+void BM_PresetRoundTripLatency(benchmark::State& state, SocketPreset socket_preset, Transport transport)
+{
+    std::atomic<uint64_t> received_bytes { 0 };
+
+    const std::unique_ptr<LoopbackServer> server = CreateLoopbackServer(LoopbackServerMode::ECHO, transport);
+    const std::unique_ptr<ApplicationClient> client = CreateLoopbackClient(*server, transport, CreatePresetOptions(socket_preset));
+
+    client->SetRxCallback([&](const std::span<char>& rx_bytes)
+    {
+        received_bytes += rx_bytes.size();
+        received_bytes.notify_all();
+    });
+
+    StartAndConnect(*client);
+
+    std::string message(ROUND_TRIP_MESSAGE_SIZE, 'x');
+    uint64_t expected_bytes = 0;
+    std::vector<double> round_trip_microseconds;
+
+    for(auto _ : state)
+    {
+        const std::chrono::steady_clock::time_point send_time = std::chrono::steady_clock::now();
+
+        client->EnqueuePayload(std::span<char>(message));
+        expected_bytes += ROUND_TRIP_MESSAGE_SIZE;
+
+        uint64_t current_bytes = received_bytes;
+
+        while(current_bytes < expected_bytes)
+        {
+            received_bytes.wait(current_bytes);
+            current_bytes = received_bytes;
+        }
+
+        round_trip_microseconds.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - send_time).count());
+    }
+
+    std::sort(round_trip_microseconds.begin(), round_trip_microseconds.end());
+
+    const auto percentile = [&](double fraction)
+    {
+        return round_trip_microseconds[static_cast<size_t>(fraction * (round_trip_microseconds.size() - 1))];
+    };
+
+    state.SetItemsProcessed(state.iterations());
+    state.counters["p50_us"] = percentile(0.5);
+    state.counters["p99_us"] = percentile(0.99);
+}
+
+/*
+    Every iteration enqueues 16 MB in large payloads and waits until the sink server has read all of them.
+*/
+void BM_PresetBulkThroughput(benchmark::State& state, SocketPreset socket_preset, Transport transport)
+{
+    const size_t payloads_per_iteration = BULK_BYTES_PER_ITERATION / BULK_PAYLOAD_SIZE;
+
+    const std::unique_ptr<LoopbackServer> server = CreateLoopbackServer(LoopbackServerMode::SINK, transport);
+    const std::unique_ptr<ApplicationClient> client = CreateLoopbackClient(*server, transport, CreatePresetOptions(socket_preset));
+
+    StartAndConnect(*client);
+
+    std::string payload(BULK_PAYLOAD_SIZE, 'x');
+    uint64_t expected_bytes = 0;
+
+    for(auto _ : state)
+    {
+        for(size_t count = 0; count < payloads_per_iteration; ++count)
+        {
+            client->EnqueuePayload(std::span<char>(payload));
+        }
+
+        expected_bytes += BULK_BYTES_PER_ITERATION;
+        server->WaitForReceivedBytes(expected_bytes);
+    }
+
+    state.SetBytesProcessed(state.iterations() * BULK_BYTES_PER_ITERATION);
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_PresetRoundTripLatency, default_tcp, SocketPreset::DEFAULT, Transport::TCP)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_PresetRoundTripLatency, low_latency_tcp, SocketPreset::LOW_LATENCY, Transport::TCP)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_PresetRoundTripLatency, bulk_throughput_tcp, SocketPreset::BULK_THROUGHPUT, Transport::TCP)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_PresetRoundTripLatency, default_unix, SocketPreset::DEFAULT, Transport::UNIX)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_PresetRoundTripLatency, low_latency_unix, SocketPreset::LOW_LATENCY, Transport::UNIX)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_PresetBulkThroughput, default_tcp, SocketPreset::DEFAULT, Transport::TCP)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_PresetBulkThroughput, low_latency_tcp, SocketPreset::LOW_LATENCY, Transport::TCP)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_PresetBulkThroughput, bulk_throughput_tcp, SocketPreset::BULK_THROUGHPUT, Transport::TCP)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_PresetBulkThroughput, default_unix, SocketPreset::DEFAULT, Transport::UNIX)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_PresetBulkThroughput, bulk_throughput_unix, SocketPreset::BULK_THROUGHPUT, Transport::UNIX)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+} // namespace InterProcessCommunication::Benchmark
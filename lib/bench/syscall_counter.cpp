@@ -0,0 +1,72 @@
+#include "syscall_counter.h"
+#include <atomic>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+namespace
+{
+std::atomic<uint64_t> send_calls { 0 };
+std::atomic<uint64_t> recv_calls { 0 };
+} // namespace
+
+SyscallCounts GetSyscallCounts()
+{
+    return SyscallCounts{.send_calls = send_calls.load(), .recv_calls = recv_calls.load()};
+}
+
+} // namespace InterProcessCommunication::Benchmark
+
+/*
+    Definitions in the executable take precedence over libc, so the client library's socket calls are routed through these wrappers.
+*/
+extern "C"
+{
+
+ssize_t send(int file_descriptor, const void* buffer, size_t length, int flags)
+{
+    ++InterProcessCommunication::Benchmark::send_calls;
+    return syscall(SYS_sendto, file_descriptor, buffer, length, flags, nullptr, 0);
+}
+
+ssize_t sendmsg(int file_descriptor, const msghdr* message, int flags)
+{
+    ++InterProcessCommunication::Benchmark::send_calls;
+    return syscall(SYS_sendmsg, file_descriptor, message, flags);
+}
+
+int sendmmsg(int file_descriptor, mmsghdr* messages, unsigned int message_count, int flags)
+{
+    ++InterProcessCommunication::Benchmark::send_calls;
+    return syscall(SYS_sendmmsg, file_descriptor, messages, message_count, flags);
+}
+
+ssize_t writev(int file_descriptor, const iovec* iovecs, int iovec_count)
+{
+    ++InterProcessCommunication::Benchmark::send_calls;
+    return syscall(SYS_writev, file_descriptor, iovecs, iovec_count);
+}
+
+ssize_t recv(int file_descriptor, void* buffer, size_t length, int flags)
+{
+    ++InterProcessCommunication::Benchmark::recv_calls;
+    return syscall(SYS_recvfrom, file_descriptor, buffer, length, flags, nullptr, nullptr);
+}
+
+ssize_t recvmsg(int file_descriptor, msghdr* message, int flags)
+{
+    ++InterProcessCommunication::Benchmark::recv_calls;
+    return syscall(SYS_recvmsg, file_descriptor, message, flags);
+}
+
+int recvmmsg(int file_descriptor, mmsghdr* messages, unsigned int message_count, int flags, timespec* timeout)
+{
+    ++InterProcessCommunication::Benchmark::recv_calls;
+    return syscall(SYS_recvmmsg, file_descriptor, messages, message_count, flags, timeout);
+}
+
+} // extern "C"
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+/*
+    \brief Process-wide counts of the socket syscalls made through the libc wrappers, which the benchmark executable interposes.
+        The loopback server shares the counters, so benchmarks should only read the direction that the server does not use.
+*/
+struct SyscallCounts
+{
+    uint64_t send_calls = 0;
+    uint64_t recv_calls = 0;
+};
+
+SyscallCounts GetSyscallCounts();
+
+} // namespace InterProcessCommunication::Benchmark
@@ -0,0 +1,71 @@
+#include "application_client.h"
+#include "loopback_server.h"
+#include "syscall_counter.h"
+#include <benchmark/benchmark.h>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+namespace
+{
+
+constexpr size_t MESSAGES_PER_ITERATION = 1024;
+constexpr std::chrono::milliseconds CLIENT_STATE_POLL_INTERVAL { 1 };
+
+/*
+    Every iteration enqueues a burst of small messages and waits until the sink server has read all of them.
+    The sink server never sends, so every counted send syscall was made by the client.
+*/
+void BM_TxBurst(benchmark::State& state, bool batched)
+{
+    const size_t message_size = state.range(0);
+
+    ClientOptions options;
+    options.tx_batch.enabled = batched;
+
+    LoopbackServer server(LoopbackServerMode::SINK);
+    ApplicationClient client(server.GetIpv4Address(), server.GetPort(), options);
+
+    client.Start();
+
+    while(not client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    client.RequestOpen();
+
+    while(client.GetClientState() != ClientState::CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    std::string message(message_size, 'x');
+    uint64_t expected_bytes = server.GetReceivedBytes();
+    const uint64_t initial_send_calls = GetSyscallCounts().send_calls;
+
+    for(auto _ : state)
+    {
+        for(size_t count = 0; count < MESSAGES_PER_ITERATION; ++count)
+        {
+            client.EnqueuePayload(std::span<char>(message));
+        }
+
+        expected_bytes += MESSAGES_PER_ITERATION * message_size;
+        server.WaitForReceivedBytes(expected_bytes);
+    }
+
+    const uint64_t message_count = state.iterations() * MESSAGES_PER_ITERATION;
+    const uint64_t send_calls = GetSyscallCounts().send_calls - initial_send_calls;
+
+    state.SetItemsProcessed(message_count);
+    state.SetBytesProcessed(message_count * message_size);
+    state.counters["syscalls_per_message"] = static_cast<double>(send_calls) / message_count;
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_TxBurst, unbatched, false)->Arg(40)->Arg(200)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_TxBurst, batched, true)->Arg(40)->Arg(200)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+} // namespace InterProcessCommunication::Benchmark
@@ -0,0 +1,153 @@
+#include "loopback_client.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+namespace
+{
+
+enum class LaneSetup
+{
+    // Every payload shares one lane, which is the FIFO order of a client without lanes
+    SINGLE_LANE,
+    STRICT_LANES,
+    WEIGHTED_LANES
+};
+
+constexpr size_t CONTROL_LANE = 0;
+constexpr size_t BULK_LANE = 1;
+constexpr size_t BULK_PAYLOAD_SIZE = 1024 * 1024;
+constexpr uint64_t MAX_OUTSTANDING_BULK_PAYLOADS = 4;
+
+ClientOptions CreateLaneOptions(LaneSetup lane_setup)
+{
+    ClientOptions options;
+    options.tx_lanes.enabled = true;
+    options.tx_lanes.lane_count = lane_setup == LaneSetup::SINGLE_LANE ? 1 : 2;
+    options.tx_lanes.scheduling = lane_setup == LaneSetup::WEIGHTED_LANES ? TxLaneScheduling::WEIGHTED : TxLaneScheduling::STRICT;
+    options.tx_lanes.weights = {4, 1};
+    // Lanes only order the bytes that the kernel has not accepted yet, so the unsent bytes in a TCP socket's buffer are kept few
+    options.socket.tcp_not_sent_low_watermark = 64 * 1024;
+
+    return options;
+}
+
+uint64_t GetSteadyClockNanoseconds()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/*
+    The client keeps a few megabyte payloads of bulk traffic queued at all times, and every iteration sends one small control message that carries its send time.
+    The sink server reassembles the lanes and records how long each control message took to arrive, and the percentiles of those times are reported.
+*/
+void BM_ControlLatencyUnderBulkLoad(benchmark::State& state, LaneSetup lane_setup, Transport transport)
+{
+    // Declared ahead of the server and the client, since their callbacks refer to them until they are destroyed
+    std::atomic<uint64_t> received_control_messages { 0 };
+    std::atomic<uint64_t> completed_bulk_payloads { 0 };
+    std::atomic<uint64_t> sent_bulk_payloads { 0 };
+    std::vector<double> control_latency_microseconds;
+
+    ChunkDecoder decoder([&](size_t lane, const std::span<char>& message)
+    {
+        // With a single lane the bulk payloads arrive on the control lane as well, and only their size tells them apart
+        if(lane != CONTROL_LANE || message.size() != sizeof(uint64_t))
+        {
+            return;
+        }
+
+        uint64_t send_time = 0;
+        std::memcpy(&send_time, message.data(), sizeof(send_time));
+        control_latency_microseconds.push_back((GetSteadyClockNanoseconds() - send_time) / 1000.0);
+
+        ++received_control_messages;
+        received_control_messages.notify_all();
+    });
+
+    const std::unique_ptr<LoopbackServer> server = CreateLoopbackServer(LoopbackServerMode::SINK, transport);
+
+    server->SetRxObserver([&](const std::span<char>& rx_bytes)
+    {
+        decoder.Decode(rx_bytes);
+    });
+
+    const std::unique_ptr<ApplicationClient> client = CreateLoopbackClient(*server, transport, CreateLaneOptions(lane_setup));
+    const size_t bulk_lane = lane_setup == LaneSetup::SINGLE_LANE ? CONTROL_LANE : BULK_LANE;
+
+    StartAndConnect(*client);
+
+    const SharedPayload bulk_payload = std::make_shared<const std::vector<char>>(BULK_PAYLOAD_SIZE, 'b');
+    uint64_t enqueued_bulk_payloads = 0;
+    uint64_t sent_control_messages = 0;
+
+    for(auto _ : state)
+    {
+        while(enqueued_bulk_payloads - completed_bulk_payloads < MAX_OUTSTANDING_BULK_PAYLOADS)
+        {
+            client->EnqueuePayload(bulk_payload, [&](bool is_sent)
+            {
+                sent_bulk_payloads += is_sent ? 1 : 0;
+                ++completed_bulk_payloads;
+                completed_bulk_payloads.notify_all();
+            }, bulk_lane);
+
+            ++enqueued_bulk_payloads;
+        }
+
+        const uint64_t send_time = GetSteadyClockNanoseconds();
+        std::vector<char> control_message(sizeof(send_time));
+        std::memcpy(control_message.data(), &send_time, sizeof(send_time));
+
+        client->EnqueuePayload(std::move(control_message), nullptr, CONTROL_LANE);
+        ++sent_control_messages;
+
+        uint64_t current_control_messages = received_control_messages;
+
+        while(current_control_messages < sent_control_messages)
+        {
+            received_control_messages.wait(current_control_messages);
+            current_control_messages = received_control_messages;
+        }
+    }
+
+    // The queued bulk payloads are dropped, and the one that is partially sent is finished before the client shuts down
+    client->ClearOutboundPayloads();
+
+    uint64_t current_bulk_payloads = completed_bulk_payloads;
+
+    while(current_bulk_payloads < enqueued_bulk_payloads)
+    {
+        completed_bulk_payloads.wait(current_bulk_payloads);
+        current_bulk_payloads = completed_bulk_payloads;
+    }
+
+    std::sort(control_latency_microseconds.begin(), control_latency_microseconds.end());
+
+    const auto percentile = [&](double fraction)
+    {
+        return control_latency_microseconds[static_cast<size_t>(fraction * (control_latency_microseconds.size() - 1))];
+    };
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(sent_bulk_payloads * BULK_PAYLOAD_SIZE);
+    state.counters["p50_us"] = percentile(0.5);
+    state.counters["p99_us"] = percentile(0.99);
+    state.counters["p999_us"] = percentile(0.999);
+    state.counters["max_us"] = control_latency_microseconds.back();
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_ControlLatencyUnderBulkLoad, single_lane_tcp, LaneSetup::SINGLE_LANE, Transport::TCP)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_ControlLatencyUnderBulkLoad, strict_lanes_tcp, LaneSetup::STRICT_LANES, Transport::TCP)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_ControlLatencyUnderBulkLoad, weighted_lanes_tcp, LaneSetup::WEIGHTED_LANES, Transport::TCP)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_ControlLatencyUnderBulkLoad, single_lane_unix, LaneSetup::SINGLE_LANE, Transport::UNIX)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_ControlLatencyUnderBulkLoad, strict_lanes_unix, LaneSetup::STRICT_LANES, Transport::UNIX)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_ControlLatencyUnderBulkLoad, weighted_lanes_unix, LaneSetup::WEIGHTED_LANES, Transport::UNIX)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+} // namespace InterProcessCommunication::Benchmark
@@ -0,0 +1,131 @@
+#include "loopback_client.h"
+#include "mpsc_queue.h"
+#include <benchmark/benchmark.h>
+#include <list>
+#include <memory>
+#include <mutex>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+namespace
+{
+
+constexpr size_t MESSAGE_SIZE = 64;
+constexpr int ENQUEUES_PER_PRODUCER = 50000;
+
+std::unique_ptr<LoopbackServer> contention_server;
+std::unique_ptr<ApplicationClient> contention_client;
+
+/*
+    Every benchmark thread is a producer that hammers the same connected client with EnqueuePayload() calls.
+    The TX worker drains the queue to a sink server concurrently, so producers compete with each other and with the consumer.
+*/
+void BM_ClientEnqueueContention(benchmark::State& state, Transport transport)
+{
+    // Google Benchmark releases the other threads into the timed loop only after every thread reached it, so thread 0 can set up the shared client here
+    if(state.thread_index() == 0)
+    {
+        contention_server = CreateLoopbackServer(LoopbackServerMode::SINK, transport);
+        contention_client = CreateLoopbackClient(*contention_server, transport);
+        StartAndConnect(*contention_client);
+    }
+
+    std::string message(MESSAGE_SIZE, 'x');
+
+    for(auto _ : state)
+    {
+        contention_client->EnqueuePayload(std::span<char>(message));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+
+    if(state.thread_index() == 0)
+    {
+        // Every producer has left the timed loop at this point, so draining the queue does not affect the measurement
+        contention_server->WaitForReceivedBytes(static_cast<uint64_t>(state.iterations()) * state.threads() * MESSAGE_SIZE);
+        contention_client.reset();
+        contention_server.reset();
+    }
+}
+
+/*
+    The same producer contention against the bare queues, with one consumer thread draining: the previous std::list guarded by a mutex versus MpscQueue.
+*/
+template <typename Queue>
+void BM_QueueContention(benchmark::State& state)
+{
+    static std::unique_ptr<Queue> queue;
+    static std::thread consumer;
+    static std::atomic<bool> is_consuming { false };
+
+    if(state.thread_index() == 0)
+    {
+        queue = std::make_unique<Queue>();
+        is_consuming = true;
+        consumer = std::thread([]()
+        {
+            while(is_consuming || not queue->IsEmpty())
+            {
+                queue->Pop();
+            }
+        });
+    }
+
+    for(auto _ : state)
+    {
+        queue->Push(std::vector<char>(MESSAGE_SIZE, 'x'));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+
+    if(state.thread_index() == 0)
+    {
+        is_consuming = false;
+        consumer.join();
+        queue.reset();
+    }
+}
+
+class MutexListQueue
+{
+public:
+    void Push(std::vector<char>&& value)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_list.emplace_back(std::move(value));
+    }
+
+    std::optional<std::vector<char>> Pop()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if(m_list.empty())
+        {
+            return std::nullopt;
+        }
+
+        std::vector<char> value = std::move(m_list.front());
+        m_list.pop_front();
+        return value;
+    }
+
+    bool IsEmpty()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_list.empty();
+    }
+
+private:
+    std::mutex m_mutex;
+    std::list<std::vector<char>> m_list;
+};
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_ClientEnqueueContention, tcp, Transport::TCP)->ThreadRange(1, 16)->Iterations(ENQUEUES_PER_PRODUCER)->UseRealTime();
+BENCHMARK_CAPTURE(BM_ClientEnqueueContention, unix_domain, Transport::UNIX)->ThreadRange(1, 16)->Iterations(ENQUEUES_PER_PRODUCER)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_QueueContention, MutexListQueue)->ThreadRange(1, 16)->Iterations(ENQUEUES_PER_PRODUCER)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_QueueContention, MpscQueue<std::vector<char>>)->ThreadRange(1, 16)->Iterations(ENQUEUES_PER_PRODUCER)->UseRealTime();
+
+} // namespace InterProcessCommunication::Benchmark
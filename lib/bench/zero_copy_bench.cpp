@@ -0,0 +1,75 @@
+#include "application_client.h"
+#include "loopback_server.h"
+#include <benchmark/benchmark.h>
+#include <sys/resource.h>
+
+namespace InterProcessCommunication::Benchmark
+{
+
+namespace
+{
+
+constexpr double BYTES_PER_GIGABYTE = 1024.0 * 1024.0 * 1024.0;
+constexpr std::chrono::milliseconds CLIENT_STATE_POLL_INTERVAL { 1 };
+
+double GetProcessCpuSeconds()
+{
+    rusage usage {};
+    getrusage(RUSAGE_SELF, &usage);
+
+    return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+}
+
+/*
+    Every iteration enqueues one shared payload, so the client never copies it in user space, and waits until the sink server has read it.
+    The CPU time is that of the whole process and includes the sink server's reads, which are the same with and without zero-copy sends.
+    On the loopback interface the kernel reports that it copied the bytes, after which the client falls back to regular sends.
+*/
+void BM_TxCpuPerGigabyte(benchmark::State& state, bool zero_copy)
+{
+    const size_t payload_size = state.range(0);
+
+    ClientOptions options;
+    options.zero_copy.enabled = zero_copy;
+
+    LoopbackServer server(LoopbackServerMode::SINK);
+    ApplicationClient client(server.GetIpv4Address(), server.GetPort(), options);
+
+    client.Start();
+
+    while(not client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    client.RequestOpen();
+
+    while(client.GetClientState() != ClientState::CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    const SharedPayload payload = std::make_shared<const std::vector<char>>(payload_size, 'x');
+    uint64_t expected_bytes = server.GetReceivedBytes();
+    const uint64_t initial_received_bytes = expected_bytes;
+    const double initial_cpu_seconds = GetProcessCpuSeconds();
+
+    for(auto _ : state)
+    {
+        client.EnqueuePayload(payload);
+        expected_bytes += payload_size;
+        server.WaitForReceivedBytes(expected_bytes);
+    }
+
+    const double gigabytes = (server.GetReceivedBytes() - initial_received_bytes) / BYTES_PER_GIGABYTE;
+
+    state.SetBytesProcessed(state.iterations() * payload_size);
+    state.counters["cpu_seconds_per_gb"] = (GetProcessCpuSeconds() - initial_cpu_seconds) / gigabytes;
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_TxCpuPerGigabyte, copy, false)->Arg(16 * 1024)->Arg(256 * 1024)->Arg(4 * 1024 * 1024)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_TxCpuPerGigabyte, zero_copy, true)->Arg(16 * 1024)->Arg(256 * 1024)->Arg(4 * 1024 * 1024)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+} // namespace InterProcessCommunication::Benchmark
@@ -0,0 +1,66 @@
+#include "callback_executor.h"
+#include <algorithm>
+
+namespace InterProcessCommunication
+{
+ThreadPoolExecutor::~ThreadPoolExecutor()
+{
+    m_task_semaphore.release(m_threads.size());
+
+    for(std::thread& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+ThreadPoolExecutor::ThreadPoolExecutor(size_t thread_count)
+{
+    m_threads.reserve(std::max<size_t>(thread_count, 1));
+
+    for(size_t thread_index = 0; thread_index < m_threads.capacity(); ++thread_index)
+    {
+        m_threads.emplace_back(&ThreadPoolExecutor::RunTasks, this);
+    }
+}
+
+void ThreadPoolExecutor::Execute(ExecutorTask task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_task_mutex);
+        m_tasks.push_back(std::move(task));
+    }
+
+    m_task_semaphore.release();
+}
+
+size_t ThreadPoolExecutor::GetThreadCount() const
+{
+    return m_threads.size();
+}
+
+void ThreadPoolExecutor::RunTasks()
+{
+    while(true)
+    {
+        m_task_semaphore.acquire();
+
+        ExecutorTask task;
+
+        {
+            std::lock_guard<std::mutex> lock(m_task_mutex);
+
+            // Every queued task comes with a release of its own, so an empty queue means that the pool is stopping and no task that was handed over is left
+            if(m_tasks.empty())
+            {
+                break;
+            }
+
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+
+        task();
+    }
+}
+
+} // namespace InterProcessCommunication
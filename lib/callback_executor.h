@@ -0,0 +1,60 @@
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <semaphore>
+#include <thread>
+#include <vector>
+
+namespace InterProcessCommunication
+{
+
+using ExecutorTask = std::function<void()>;
+
+/*
+    \brief Runs the tasks that an ApplicationClient hands over, such as its RX callbacks (see RxDispatchOptions). Execute() may be called from any thread,
+        and may run the task on any thread, at any later time, but must run every task it was given. An executor may be shared by any number of clients,
+        and must keep running tasks until every client that uses it has been destroyed.
+*/
+class CallbackExecutor
+{
+public:
+
+    virtual ~CallbackExecutor() = default;
+
+    virtual void Execute(ExecutorTask task) = 0;
+};
+
+/*
+    \brief A fixed number of threads that take the tasks in the order they were handed over. The destructor runs the tasks that are still queued before it joins the threads.
+*/
+class ThreadPoolExecutor : public CallbackExecutor
+{
+public:
+
+    ThreadPoolExecutor(const ThreadPoolExecutor&) = delete;
+    ThreadPoolExecutor& operator=(const ThreadPoolExecutor&) = delete;
+    ThreadPoolExecutor(ThreadPoolExecutor&&) = delete;
+    ThreadPoolExecutor& operator=(ThreadPoolExecutor&&) = delete;
+    ~ThreadPoolExecutor() override;
+    /*
+        \brief The pool starts at least one thread
+    */
+    explicit ThreadPoolExecutor(size_t thread_count = 1);
+
+    void Execute(ExecutorTask task) override;
+    size_t GetThreadCount() const;
+
+private:
+
+    std::mutex m_task_mutex;
+    std::deque<ExecutorTask> m_tasks;
+    // Released once per queued task, and once per thread on stopping
+    std::counting_semaphore<> m_task_semaphore { 0 };
+    std::vector<std::thread> m_threads;
+
+    void RunTasks();
+};
+
+} // namespace InterProcessCommunication
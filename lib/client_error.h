@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+
+namespace InterProcessCommunication
+{
+
+enum class Error
+{
+    SOCKET_OPEN_FAILURE,
+    SOCKET_CLOSE_FAILURE,
+    SOCKET_SEND_FAILURE,
+    SOCKET_READ_FAILURE,
+    SOCKET_CONNECT_FAILURE,
+    FRAME_SIZE_FAILURE,
+    RECONNECT_FAILURE,
+    MEMFD_TRANSFER_FAILURE
+};
+
+// The number of Error values. It must follow the last enumerator.
+constexpr size_t ERROR_COUNT = static_cast<size_t>(Error::MEMFD_TRANSFER_FAILURE) + 1;
+
+} // namespace InterProcessCommunication
@@ -0,0 +1,306 @@
+#pragma once
+
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace InterProcessCommunication
+{
+
+class CallbackExecutor;
+
+/*
+    \brief Controls gather-write batching of queued TX payloads.
+        When enabled, up to max_payloads queued payloads (limited to roughly max_bytes) are flushed with a single sendmsg() call instead of one send() per payload.
+        Batched TCP clients also disable Nagle's algorithm, since the client already coalesces small payloads itself.
+*/
+struct TxBatchOptions
+{
+    bool enabled = false;
+    size_t max_payloads = 64;
+    size_t max_bytes = 64 * 1024;
+};
+
+/*
+    \brief Controls the sizing of the pooled RX buffers that the client reads into.
+        Reads start with buffer_size bytes. When max_buffer_size is larger, the buffer size doubles (up to max_buffer_size) whenever reads keep filling whole buffers.
+        Up to max_pooled_buffers released buffers are kept for reuse, which only matters when RX buffer callbacks retain buffers.
+*/
+struct RxBufferOptions
+{
+    size_t buffer_size = 1024;
+    size_t max_buffer_size = 1024;
+    size_t max_pooled_buffers = 4;
+};
+
+enum class FrameHeaderSize
+{
+    TWO_BYTES = 2,
+    FOUR_BYTES = 4,
+    EIGHT_BYTES = 8
+};
+
+/*
+    \brief Controls length-prefixed message framing. When enabled, every enqueued payload is sent as one frame behind a header holding its length,
+        and the RX callbacks receive whole frames instead of arbitrary recv() fragments.
+        Frames longer than max_frame_size (or than the header can describe) are rejected on enqueue, and drop the connection when received.
+*/
+struct FramingOptions
+{
+    bool enabled = false;
+    FrameHeaderSize header_size = FrameHeaderSize::FOUR_BYTES;
+    std::endian byte_order = std::endian::big;
+    size_t max_frame_size = 16 * 1024 * 1024;
+};
+
+/*
+    \brief Controls MSG_ZEROCOPY sends on TCP connections. When enabled, every send of at least min_send_size bytes lets the kernel transmit straight from the payloads' storage,
+        which the client retains until the kernel reports that it is done with it. Completion callbacks still run as soon as the kernel has accepted the bytes.
+        If the kernel reports that it had to copy the bytes anyway (on the loopback interface, for example), the connection falls back to regular sends.
+        Unix domain sockets and the reactor's IO_URING backend always use regular sends.
+*/
+struct ZeroCopyOptions
+{
+    bool enabled = false;
+    size_t min_send_size = 64 * 1024;
+};
+
+/*
+    \brief Controls passing large payloads over unix domain sockets as sealed memfds. When enabled, a payload of at least min_payload_size bytes (or an explicit MemfdPayload)
+        is written into a memfd that is sealed against changes, and only the descriptor crosses the socket (as SCM_RIGHTS) instead of the bytes being copied through it twice.
+        The receiving side maps the memfd and hands the mapping to the RX callbacks like any other message, and the mapping is released with the last reference to its buffer.
+        The descriptor travels with a frame that has the top bit of its length set and no bytes of its own, so it needs framing with at least FOUR_BYTES headers on both peers,
+        and payloads that go as memfds are not bounded by max_frame_size. It does not apply to TCP connections or with TX lanes enabled, where payloads are sent inline.
+        The IO_URING reactor backend receives without ancillary data, so Start(ClientReactor&) refuses a client with memfd transfer on it.
+*/
+struct MemfdTransferOptions
+{
+    bool enabled = false;
+    size_t min_payload_size = 256 * 1024;
+};
+
+/*
+    \brief Tunes the client's socket. Fields left at zero (or false) keep the kernel's defaults. The TCP_ options and keepalive only apply to TCP connections.
+        An option that the kernel rejects is reported and skipped, and the connection is made without it. For example, SO_BUSY_POLL above net.core.busy_read needs CAP_NET_ADMIN,
+        and SO_SNDBUF/SO_RCVBUF are capped by net.core.wmem_max/rmem_max. The kernel clears TCP_QUICKACK by itself, so it is set again after every read while enabled.
+        LowLatency() and BulkThroughput() return presets for request/response traffic and for bulk transfers.
+*/
+struct SocketOptions
+{
+    bool tcp_no_delay = false;
+    bool tcp_quick_ack = false;
+    int send_buffer_size = 0;
+    int receive_buffer_size = 0;
+    int busy_poll_microseconds = 0;
+    int tcp_not_sent_low_watermark = 0;
+    int priority = 0;
+    bool keep_alive = false;
+    std::chrono::seconds keep_alive_idle { 0 };
+    std::chrono::seconds keep_alive_interval { 0 };
+    int keep_alive_probes = 0;
+
+    /*
+        \brief Small messages leave right away and are acknowledged right away, and the send queue is kept short so that a new message does not wait behind a backlog
+    */
+    static SocketOptions LowLatency()
+    {
+        SocketOptions options;
+        options.tcp_no_delay = true;
+        options.tcp_quick_ack = true;
+        options.busy_poll_microseconds = 50;
+        options.tcp_not_sent_low_watermark = 16 * 1024;
+        // The highest priority that needs no privileges
+        options.priority = 6;
+        return options;
+    }
+
+    /*
+        \brief Large socket buffers keep a window's worth of data in flight. Nagle's algorithm is left on to coalesce the tail of every write.
+    */
+    static SocketOptions BulkThroughput()
+    {
+        SocketOptions options;
+        options.send_buffer_size = 4 * 1024 * 1024;
+        options.receive_buffer_size = 4 * 1024 * 1024;
+        return options;
+    }
+};
+
+enum class UnixSocketType
+{
+    STREAM,
+    SEQPACKET
+};
+
+/*
+    \brief Selects the type of a unix domain socket. A STREAM socket carries a byte stream like a TCP connection. A SEQPACKET socket keeps message boundaries:
+        every enqueued payload goes as one kernel message, and every RX callback receives exactly one message, so framing is neither needed nor applied.
+        Batched payloads (see TxBatchOptions) go with a single sendmmsg() call, and up to rx_batch_messages messages are read with a single recvmmsg() call,
+        each into a pooled RX buffer of its own. The kernel truncates a message that is longer than its RX buffer, and the client drops such a message and reports
+        Error::FRAME_SIZE_FAILURE (the RX buffer grows towards RxBufferOptions::max_buffer_size for the following ones). An empty message is dropped and reported the same way,
+        except that empty messages which fill the rest of a batch read as the end of the connection.
+        Memfd transfer does not apply to SEQPACKET sockets, and the reactor's IO_URING backend can not drive them, since its receives do not report truncation.
+*/
+struct UnixSocketOptions
+{
+    UnixSocketType type = UnixSocketType::STREAM;
+    size_t rx_batch_messages = 16;
+};
+
+enum class TxQueueFullPolicy
+{
+    REJECT,
+    BLOCK,
+    DROP_OLDEST
+};
+
+/*
+    \brief Bounds the payloads that are enqueued but not yet picked up by the TX consumer. The payloads it is already sending (at most one batch) are not counted.
+        A limit of zero leaves that dimension unbounded, so the defaults leave the queue unbounded. A payload that alone exceeds max_bytes is only admitted into an empty queue.
+        When a payload does not fit, EnqueuePayload() applies the full_policy: REJECT fails right away, BLOCK waits up to block_timeout for the TX consumer to make room,
+        and DROP_OLDEST discards the oldest queued payloads (reporting them as not sent). TryEnqueuePayload() never waits, and BLOCK never waits on the TX consumer's own thread either.
+        When high_watermark_bytes is set, the queued bytes reaching it invokes the TX high watermark callback, and then falling to low_watermark_bytes invokes the TX low watermark callback.
+*/
+struct TxQueueOptions
+{
+    size_t max_payloads = 0;
+    size_t max_bytes = 0;
+    TxQueueFullPolicy full_policy = TxQueueFullPolicy::REJECT;
+    std::chrono::milliseconds block_timeout { 1000 };
+    size_t high_watermark_bytes = 0;
+    size_t low_watermark_bytes = 0;
+};
+
+enum class TxLaneScheduling
+{
+    STRICT,
+    WEIGHTED
+};
+
+/*
+    \brief Controls priority lanes for outbound payloads. When enabled, EnqueuePayload() takes a lane (0 is the most important, up to lane_count - 1) and every lane has a queue of its own.
+        Payloads are sent in chunks of at most chunk_size bytes, so a large payload no longer holds up a more important one for longer than a chunk takes to send.
+        STRICT scheduling always sends the next chunk of the most important lane that has one, while WEIGHTED scheduling shares the connection in proportion to the lanes' weights
+        (deficit round robin, a missing or zero weight counts as 1). Every chunk is preceded by a header of CHUNK_HEADER_SIZE bytes (see EncodeChunkHeader()) that names its lane
+        and marks the last chunk of a payload, and the peer reassembles the payloads with a ChunkDecoder. Length-prefixed framing is not applied to outbound payloads while lanes are enabled.
+        Lanes only order the bytes that the kernel has not accepted yet, so on TCP connections they are best paired with SocketOptions::tcp_not_sent_low_watermark.
+*/
+struct TxLaneOptions
+{
+    bool enabled = false;
+    size_t lane_count = 2;
+    TxLaneScheduling scheduling = TxLaneScheduling::STRICT;
+    std::vector<size_t> weights;
+    size_t chunk_size = 16 * 1024;
+};
+
+/*
+    \brief Controls handing received messages over to an executor, so that a slow RX callback does not hold up reading the socket. When enabled, the RX consumer
+        queues every message (a whole frame when framing is enabled) along with its pooled RX buffer and goes straight back to reading, and the RX callbacks
+        run on the executor instead: the given one, which may be shared with other clients, or else a ThreadPoolExecutor of thread_count threads that the client owns.
+        The messages of a client are delivered one at a time and in the order they were received, however many threads the executor has, and a task hands its thread
+        back after a batch of messages, so that clients sharing an executor take turns.
+        The queue holds up to max_queued_messages messages and max_queued_bytes bytes (zero leaves that dimension unbounded). While it is full, the RX consumer waits
+        for the executor to make room, so the socket only backs up once the callbacks have fallen a whole queue behind. In reactor mode the event loop does not wait,
+        but queues the rest of the read it is in (which may take the queue past its limits) and stops reading the socket until the executor has made room.
+        Messages that were received before the connection ended may still be delivered after the disconnected callback, and the messages that are still queued
+        when the client is destroyed are dropped. A client must not be destroyed from one of its own RX callbacks. Coroutines (see ApplicationClient::Receive())
+        are always resumed on the RX consumer.
+*/
+struct RxDispatchOptions
+{
+    bool enabled = false;
+    std::shared_ptr<CallbackExecutor> executor;
+    size_t thread_count = 1;
+    size_t max_queued_messages = 1024;
+    size_t max_queued_bytes = 0;
+};
+
+/*
+    \brief Controls batched RX delivery, which applies while a batch callback is set (see ApplicationClient::SetRxBatchCallback()). The RX consumer then reads on
+        without waiting for as long as bytes are available, and hands every message it has gathered (whole frames when framing is enabled, one per datagram with
+        SEQPACKET sockets) to the callback in a single call once the socket runs dry, the connection ends or max_messages messages have been gathered.
+        A batch retains the RX buffers that its messages lie in until the callback returns, so max_pooled_buffers (see RxBufferOptions) should cover the buffers
+        that max_messages messages fill, and a larger buffer_size lets every read take more of them. With RX dispatch (see RxDispatchOptions) the executor
+        hands the callback up to max_messages queued messages at once instead.
+*/
+struct RxBatchOptions
+{
+    size_t max_messages = 64;
+};
+
+/*
+    \brief Controls how long a connection attempt may take. TCP connections (and every connection in reactor mode) are made without blocking, and an attempt is given up
+        after timeout, reporting Error::SOCKET_CONNECT_FAILURE. Zero waits as long as the kernel does, which for an unreachable TCP host is minutes of SYN retries.
+        RequestClose() cancels an attempt that is in progress.
+*/
+struct ConnectOptions
+{
+    std::chrono::milliseconds timeout { 0 };
+};
+
+/*
+    \brief Controls reconnecting after an established connection is lost: the peer closed it, reading from it failed or it broke while sending.
+        When enabled, the client moves to RECONNECTING instead of NOT_CONNECTED and retries after a delay that starts at initial_delay and is multiplied by multiplier
+        after every failed attempt, up to max_delay. Each delay is randomised by up to jitter (a fraction of the delay) either way, so that many clients that lost
+        the same server do not retry in lockstep. After max_attempts failed attempts (zero retries forever) the client reports Error::RECONNECT_FAILURE and moves to NOT_CONNECTED.
+        RequestClose() cancels reconnecting while the client waits for the next attempt.
+        Queued payloads are kept while reconnecting and are sent in order on the new connection. A partially sent payload is sent again from its first byte,
+        since the peer can not be assumed to have kept the part it received on the lost connection. If reconnecting ends without a connection, the payloads fail
+        like any payload that is sent while the client is not connected.
+*/
+struct ReconnectOptions
+{
+    bool enabled = false;
+    std::chrono::milliseconds initial_delay { 100 };
+    std::chrono::milliseconds max_delay { 10000 };
+    double multiplier = 2.0;
+    double jitter = 0.2;
+    size_t max_attempts = 0;
+};
+
+/*
+    \brief Tunes a client in SHARED_MEMORY mode (see SharedMemoryPeer). When its ring is empty (or full), the client busy-waits for up to busy_wait_microseconds
+        before it sleeps until the peer wakes it. Busy-waiting saves the wake-up system calls on both sides while messages follow each other closely,
+        at the cost of a core that spins in the meantime, so it only pays off when both sides have a core of their own.
+*/
+struct SharedMemoryOptions
+{
+    uint32_t busy_wait_microseconds = 0;
+};
+
+/*
+    \brief Controls the optional parts of the runtime statistics (see ApplicationClient::GetStatistics()).
+        The latency histograms read the clock once per message at either end and take about 8 KB per client, so they are off by default.
+*/
+struct StatisticsOptions
+{
+    bool latency_histograms = false;
+};
+
+/*
+    \brief Construction-time configuration of an ApplicationClient. The defaults reproduce the behaviour of a client constructed without options.
+*/
+struct ClientOptions
+{
+    TxBatchOptions tx_batch;
+    RxBufferOptions rx_buffer;
+    RxDispatchOptions rx_dispatch;
+    RxBatchOptions rx_batch;
+    FramingOptions framing;
+    ZeroCopyOptions zero_copy;
+    MemfdTransferOptions memfd_transfer;
+    StatisticsOptions statistics;
+    TxQueueOptions tx_queue;
+    TxLaneOptions tx_lanes;
+    SocketOptions socket;
+    UnixSocketOptions unix_socket;
+    SharedMemoryOptions shared_memory;
+    ConnectOptions connect;
+    ReconnectOptions reconnect;
+};
+
+} // namespace InterProcessCommunication
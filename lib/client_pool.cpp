@@ -0,0 +1,301 @@
+#include "client_pool.h"
+#include <algorithm>
+
+namespace InterProcessCommunication
+{
+ClientPool::~ClientPool()
+{
+    // The clients call into the pool's callbacks until they are gone, so they go first
+    m_connections.clear();
+}
+
+ClientPool::ClientPool(const std::string& ipv4_address, uint16_t port, const ClientPoolOptions& options)
+: m_distribution(options.distribution)
+{
+    for(size_t connection_index = 0; connection_index < std::max<size_t>(1, options.connection_count); ++connection_index)
+    {
+        AddConnection(std::make_unique<ApplicationClient>(ipv4_address, port, options.client_options));
+    }
+}
+
+ClientPool::ClientPool(const std::string& unix_socket_path, const ClientPoolOptions& options)
+: m_distribution(options.distribution)
+{
+    for(size_t connection_index = 0; connection_index < std::max<size_t>(1, options.connection_count); ++connection_index)
+    {
+        AddConnection(std::make_unique<ApplicationClient>(unix_socket_path, options.client_options));
+    }
+}
+
+void ClientPool::SetConnectionCallback(PoolConnectionCallback callback)
+{
+    m_connected_callback = std::move(callback);
+}
+
+void ClientPool::SetDisconnectedCallback(PoolConnectionCallback callback)
+{
+    m_disconnected_callback = std::move(callback);
+}
+
+void ClientPool::SetRxCallback(PoolRxCallback callback)
+{
+    m_rx_callback = std::move(callback);
+}
+
+void ClientPool::SetErrorCallback(PoolErrorCallback callback)
+{
+    m_error_callback = std::move(callback);
+}
+
+bool ClientPool::Start()
+{
+    bool result = true;
+
+    for(const std::unique_ptr<Connection>& connection : m_connections)
+    {
+        result = connection->client->Start() && result;
+    }
+
+    return result;
+}
+
+bool ClientPool::Start(ClientReactor& reactor)
+{
+    bool result = true;
+
+    for(const std::unique_ptr<Connection>& connection : m_connections)
+    {
+        result = connection->client->Start(reactor) && result;
+    }
+
+    return result;
+}
+
+bool ClientPool::IsRunning() const
+{
+    return std::all_of(m_connections.begin(), m_connections.end(), [](const std::unique_ptr<Connection>& connection)
+    {
+        return connection->client->IsRunning();
+    });
+}
+
+bool ClientPool::RequestOpen()
+{
+    bool result = true;
+
+    for(const std::unique_ptr<Connection>& connection : m_connections)
+    {
+        result = connection->client->RequestOpen() && result;
+    }
+
+    return result;
+}
+
+bool ClientPool::RequestClose()
+{
+    bool result = true;
+
+    for(const std::unique_ptr<Connection>& connection : m_connections)
+    {
+        result = connection->client->RequestClose() && result;
+    }
+
+    return result;
+}
+
+void ClientPool::ClearOutboundPayloads()
+{
+    for(const std::unique_ptr<Connection>& connection : m_connections)
+    {
+        connection->client->ClearOutboundPayloads();
+    }
+}
+
+size_t ClientPool::GetConnectionCount() const
+{
+    return m_connections.size();
+}
+
+size_t ClientPool::GetConnectedCount() const
+{
+    return m_connected_count.load();
+}
+
+ApplicationClient& ClientPool::GetClient(size_t connection_index)
+{
+    return *m_connections.at(connection_index)->client;
+}
+
+ClientStatistics ClientPool::GetStatistics() const
+{
+    ClientStatistics pool_statistics;
+
+    for(const std::unique_ptr<Connection>& connection : m_connections)
+    {
+        const ClientStatistics statistics = connection->client->GetStatistics();
+
+        pool_statistics.tx_messages += statistics.tx_messages;
+        pool_statistics.tx_bytes += statistics.tx_bytes;
+        pool_statistics.rx_messages += statistics.rx_messages;
+        pool_statistics.rx_bytes += statistics.rx_bytes;
+        pool_statistics.tx_queue_depth += statistics.tx_queue_depth;
+        pool_statistics.tx_queue_high_water_mark = std::max(pool_statistics.tx_queue_high_water_mark, statistics.tx_queue_high_water_mark);
+        pool_statistics.rx_dispatch_queue_depth += statistics.rx_dispatch_queue_depth;
+        pool_statistics.rx_dispatch_queue_high_water_mark = std::max(pool_statistics.rx_dispatch_queue_high_water_mark, statistics.rx_dispatch_queue_high_water_mark);
+        pool_statistics.send_calls += statistics.send_calls;
+        pool_statistics.partial_writes += statistics.partial_writes;
+        pool_statistics.recv_calls += statistics.recv_calls;
+        pool_statistics.reconnects += statistics.reconnects;
+        pool_statistics.reconnect_attempts += statistics.reconnect_attempts;
+        pool_statistics.last_time_to_reconnect_nanoseconds = std::max(pool_statistics.last_time_to_reconnect_nanoseconds, statistics.last_time_to_reconnect_nanoseconds);
+        pool_statistics.max_time_to_reconnect_nanoseconds = std::max(pool_statistics.max_time_to_reconnect_nanoseconds, statistics.max_time_to_reconnect_nanoseconds);
+
+        for(size_t error_index = 0; error_index < ERROR_COUNT; ++error_index)
+        {
+            pool_statistics.error_counts[error_index] += statistics.error_counts[error_index];
+        }
+
+        pool_statistics.enqueue_to_send_latency.Merge(statistics.enqueue_to_send_latency);
+        pool_statistics.recv_to_callback_latency.Merge(statistics.recv_to_callback_latency);
+    }
+
+    return pool_statistics;
+}
+
+bool ClientPool::EnqueuePayload(const std::span<char>& tx_bytes, TxCompletionCallback completion_callback, size_t lane)
+{
+    return SelectClient().EnqueuePayload(tx_bytes, std::move(completion_callback), lane);
+}
+
+bool ClientPool::EnqueuePayload(std::vector<char>&& tx_bytes, TxCompletionCallback completion_callback, size_t lane)
+{
+    return SelectClient().EnqueuePayload(std::move(tx_bytes), std::move(completion_callback), lane);
+}
+
+bool ClientPool::EnqueuePayload(std::unique_ptr<char[]> tx_bytes, size_t size, TxCompletionCallback completion_callback, size_t lane)
+{
+    return SelectClient().EnqueuePayload(std::move(tx_bytes), size, std::move(completion_callback), lane);
+}
+
+bool ClientPool::EnqueuePayload(SharedPayload tx_bytes, TxCompletionCallback completion_callback, size_t lane)
+{
+    return SelectClient().EnqueuePayload(std::move(tx_bytes), std::move(completion_callback), lane);
+}
+
+bool ClientPool::EnqueueKeyedPayload(uint64_t key, const std::span<char>& tx_bytes, TxCompletionCallback completion_callback, size_t lane)
+{
+    return SelectKeyedClient(key).EnqueuePayload(tx_bytes, std::move(completion_callback), lane);
+}
+
+bool ClientPool::EnqueueKeyedPayload(uint64_t key, std::vector<char>&& tx_bytes, TxCompletionCallback completion_callback, size_t lane)
+{
+    return SelectKeyedClient(key).EnqueuePayload(std::move(tx_bytes), std::move(completion_callback), lane);
+}
+
+bool ClientPool::EnqueueKeyedPayload(uint64_t key, std::unique_ptr<char[]> tx_bytes, size_t size, TxCompletionCallback completion_callback, size_t lane)
+{
+    return SelectKeyedClient(key).EnqueuePayload(std::move(tx_bytes), size, std::move(completion_callback), lane);
+}
+
+bool ClientPool::EnqueueKeyedPayload(uint64_t key, SharedPayload tx_bytes, TxCompletionCallback completion_callback, size_t lane)
+{
+    return SelectKeyedClient(key).EnqueuePayload(std::move(tx_bytes), std::move(completion_callback), lane);
+}
+
+void ClientPool::AddConnection(std::unique_ptr<ApplicationClient> client)
+{
+    const size_t connection_index = m_connections.size();
+
+    m_connections.emplace_back(std::make_unique<Connection>());
+    Connection& connection = *m_connections.back();
+    connection.client = std::move(client);
+
+    connection.client->SetConnectionCallback([this, &connection, connection_index]()
+    {
+        if(not connection.is_connected.exchange(true))
+        {
+            ++m_connected_count;
+        }
+
+        m_connected_callback(connection_index);
+    });
+
+    connection.client->SetDisconnectedCallback([this, &connection, connection_index]()
+    {
+        if(connection.is_connected.exchange(false))
+        {
+            --m_connected_count;
+        }
+
+        m_disconnected_callback(connection_index);
+    });
+
+    connection.client->SetRxCallback([this, connection_index](const std::span<char>& rx_bytes)
+    {
+        m_rx_callback(connection_index, rx_bytes);
+    });
+
+    connection.client->SetErrorCallback([this, connection_index](const Error& error, const std::optional<std::span<char>>& failed_tx_payload)
+    {
+        m_error_callback(connection_index, error, failed_tx_payload);
+    });
+}
+
+ApplicationClient& ClientPool::SelectClient()
+{
+    const size_t connection_count = m_connections.size();
+    // Relaxed is enough, the counter only has to spread the payloads and does not order anything
+    const size_t first_index = m_next_connection_index.fetch_add(1, std::memory_order_relaxed) % connection_count;
+    // While no connection is up, the payload takes its turn anyway and is handled like any payload enqueued on a client that is not connected
+    const bool skip_disconnected = m_connected_count.load(std::memory_order_relaxed) > 0;
+
+    Connection* selected_connection = nullptr;
+    size_t selected_queue_depth = SIZE_MAX;
+
+    for(size_t offset = 0; offset < connection_count; ++offset)
+    {
+        Connection& connection = *m_connections[(first_index + offset) % connection_count];
+
+        if(skip_disconnected && not connection.is_connected.load(std::memory_order_relaxed))
+        {
+            continue;
+        }
+
+        if(m_distribution == PoolDistribution::ROUND_ROBIN)
+        {
+            return *connection.client;
+        }
+
+        const size_t queue_depth = connection.client->GetTxQueueDepth();
+
+        // An idle connection can not be beaten
+        if(queue_depth == 0)
+        {
+            return *connection.client;
+        }
+
+        if(queue_depth < selected_queue_depth)
+        {
+            selected_connection = &connection;
+            selected_queue_depth = queue_depth;
+        }
+    }
+
+    // Every connection went down while looking for one
+    if(selected_connection == nullptr)
+    {
+        return *m_connections[first_index]->client;
+    }
+
+    return *selected_connection->client;
+}
+
+ApplicationClient& ClientPool::SelectKeyedClient(uint64_t key)
+{
+    // Fibonacci hashing spreads keys that only differ in their high bits, or that are all multiples of the connection count
+    const uint64_t hashed_key = key * 0x9E3779B97F4A7C15ULL;
+
+    return *m_connections[(hashed_key >> 32) % m_connections.size()]->client;
+}
+
+} // namespace InterProcessCommunication
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "application_client.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace InterProcessCommunication
+{
+
+enum class PoolDistribution
+{
+    // Every payload goes to the next connection in turn
+    ROUND_ROBIN,
+    // Every payload goes to the connection with the fewest payloads waiting in its TX queue (see ApplicationClient::GetTxQueueDepth()),
+    // ties going round-robin. Without a tracked queue depth, this is the same as ROUND_ROBIN.
+    LEAST_QUEUED
+};
+
+struct ClientPoolOptions
+{
+    size_t connection_count = 4;
+    PoolDistribution distribution = PoolDistribution::ROUND_ROBIN;
+    // The options of every connection
+    ClientOptions client_options;
+};
+
+using PoolConnectionCallback = std::function<void(size_t connection_index)>;
+using PoolRxCallback = std::function<void(size_t connection_index, const std::span<char>& rx_bytes)>;
+using PoolErrorCallback = std::function<void(size_t connection_index, const Error& error, const std::optional<std::span<char>>& failed_tx_payload)>;
+
+/*
+    \brief Opens several connections to the same endpoint and spreads the enqueued payloads over them, so that sending is not bound to one socket,
+        one TX thread and one TCP window. Payloads without a key are distributed by the pool's PoolDistribution and skip connections that are down
+        (as long as any connection is up). Payloads with a key always take the connection that the key maps to, so the payloads of one key keep their order.
+        Payloads on different connections are not ordered with respect to each other.
+
+        The callbacks of every connection are passed on to the pool's callbacks along with the connection's index, and must be set before the pool is started.
+*/
+class ClientPool
+{
+public:
+
+    ClientPool(const ClientPool&) = delete;
+    ClientPool& operator=(const ClientPool&) = delete;
+    ClientPool(ClientPool&&) = delete;
+    ClientPool& operator=(ClientPool&&) = delete;
+    ~ClientPool();
+    ClientPool(const std::string& ipv4_address, uint16_t port, const ClientPoolOptions& options = {});
+    ClientPool(const std::string& unix_socket_path, const ClientPoolOptions& options = {});
+
+    void SetConnectionCallback(PoolConnectionCallback callback);
+    void SetDisconnectedCallback(PoolConnectionCallback callback);
+    void SetRxCallback(PoolRxCallback callback);
+    void SetErrorCallback(PoolErrorCallback callback);
+
+    /*
+        \brief The following functions apply to every connection, and succeed if they succeed for all of them
+    */
+    bool Start();
+    bool Start(ClientReactor& reactor);
+    bool IsRunning() const;
+    bool RequestOpen();
+    bool RequestClose();
+    void ClearOutboundPayloads();
+
+    size_t GetConnectionCount() const;
+    size_t GetConnectedCount() const;
+    ApplicationClient& GetClient(size_t connection_index);
+    /*
+        \brief This function returns the sum of every connection's statistics. The high-water mark and the maximum time to reconnect are the largest of any connection.
+    */
+    ClientStatistics GetStatistics() const;
+
+    bool EnqueuePayload(const std::span<char>& tx_bytes, TxCompletionCallback completion_callback = nullptr, size_t lane = 0);
+    bool EnqueuePayload(std::vector<char>&& tx_bytes, TxCompletionCallback completion_callback = nullptr, size_t lane = 0);
+    bool EnqueuePayload(std::unique_ptr<char[]> tx_bytes, size_t size, TxCompletionCallback completion_callback = nullptr, size_t lane = 0);
+    bool EnqueuePayload(SharedPayload tx_bytes, TxCompletionCallback completion_callback = nullptr, size_t lane = 0);
+    /*
+        \brief The following functions enqueue the payload on the connection that the key maps to, whether or not that connection is up
+    */
+    bool EnqueueKeyedPayload(uint64_t key, const std::span<char>& tx_bytes, TxCompletionCallback completion_callback = nullptr, size_t lane = 0);
+    bool EnqueueKeyedPayload(uint64_t key, std::vector<char>&& tx_bytes, TxCompletionCallback completion_callback = nullptr, size_t lane = 0);
+    bool EnqueueKeyedPayload(uint64_t key, std::unique_ptr<char[]> tx_bytes, size_t size, TxCompletionCallback completion_callback = nullptr, size_t lane = 0);
+    bool EnqueueKeyedPayload(uint64_t key, SharedPayload tx_bytes, TxCompletionCallback completion_callback = nullptr, size_t lane = 0);
+
+private:
+
+    struct Connection
+    {
+        std::unique_ptr<ApplicationClient> client;
+        // Kept by the connection's callbacks, so that distributing a payload does not have to take the client's state lock
+        std::atomic<bool> is_connected { false };
+    };
+
+    const PoolDistribution m_distribution;
+    std::vector<std::unique_ptr<Connection>> m_connections;
+    std::atomic<size_t> m_next_connection_index { 0 };
+    std::atomic<size_t> m_connected_count { 0 };
+
+    PoolConnectionCallback m_connected_callback = [](size_t){};
+    PoolConnectionCallback m_disconnected_callback = [](size_t){};
+    PoolRxCallback m_rx_callback = [](size_t, const std::span<char>&){};
+    PoolErrorCallback m_error_callback = [](size_t, const Error&, const std::optional<std::span<char>>&){};
+
+    void AddConnection(std::unique_ptr<ApplicationClient> client);
+    ApplicationClient& SelectClient();
+    ApplicationClient& SelectKeyedClient(uint64_t key);
+};
+
+} // namespace InterProcessCommunication
@@ -0,0 +1,543 @@
+#include "client_reactor.h"
+#include "io_uring_queue.h"
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#include <semaphore>
+#include <string>
+#include <cerrno>
+#include <cstdio>
+#include <iostream>
+
+namespace InterProcessCommunication
+{
+ClientReactor::~ClientReactor()
+{
+    Stop();
+
+    for(const std::unique_ptr<EventLoop>& event_loop : m_event_loops)
+    {
+        close(event_loop->wakeup_file_descriptor);
+        close(event_loop->timer_file_descriptor);
+        close(event_loop->epoll_file_descriptor);
+    }
+}
+
+ClientReactor::ClientReactor(size_t event_loop_count, ReactorBackend backend)
+{
+    if(event_loop_count == 0)
+    {
+        event_loop_count = 1;
+    }
+
+    for(size_t index = 0; index < event_loop_count; ++index)
+    {
+        std::unique_ptr<EventLoop> event_loop = std::make_unique<EventLoop>();
+
+        event_loop->epoll_file_descriptor = epoll_create1(EPOLL_CLOEXEC);
+        event_loop->wakeup_file_descriptor = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        event_loop->timer_file_descriptor = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+
+        if(event_loop->epoll_file_descriptor < 0 || event_loop->wakeup_file_descriptor < 0 || event_loop->timer_file_descriptor < 0)
+        {
+            const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to create event loop! Error code: {" + std::to_string(errno) +"}";
+            perror(error_message.c_str());
+        }
+        else
+        {
+            // The wakeup descriptor is registered without a handler so the event loop can tell it apart from client sockets
+            epoll_event wakeup_event {};
+            wakeup_event.events = EPOLLIN;
+            wakeup_event.data.ptr = nullptr;
+            epoll_ctl(event_loop->epoll_file_descriptor, EPOLL_CTL_ADD, event_loop->wakeup_file_descriptor, &wakeup_event);
+
+            epoll_event timer_event {};
+            timer_event.events = EPOLLIN;
+            timer_event.data.u64 = TIMER_EVENT_DATA;
+            epoll_ctl(event_loop->epoll_file_descriptor, EPOLL_CTL_ADD, event_loop->timer_file_descriptor, &timer_event);
+        }
+
+        m_event_loops.emplace_back(std::move(event_loop));
+    }
+
+#ifdef APPLICATION_CLIENT_IO_URING
+    if(backend == ReactorBackend::IO_URING && CreateIoUrings())
+    {
+        m_backend = ReactorBackend::IO_URING;
+    }
+#endif
+
+    if(backend != m_backend)
+    {
+        std::cerr << std::string(CLASS_NAME) + "::" + __func__ + "() -> io_uring is not available, falling back to epoll\n";
+    }
+}
+
+#ifdef APPLICATION_CLIENT_IO_URING
+bool ClientReactor::CreateIoUrings()
+{
+    for(const std::unique_ptr<EventLoop>& event_loop : m_event_loops)
+    {
+        event_loop->io_uring = IoUringQueue::Create(IO_URING_ENTRY_COUNT);
+
+        if(event_loop->io_uring == nullptr)
+        {
+            for(const std::unique_ptr<EventLoop>& created_event_loop : m_event_loops)
+            {
+                created_event_loop->io_uring.reset();
+            }
+
+            return false;
+        }
+    }
+
+    return true;
+}
+#endif
+
+bool ClientReactor::Start()
+{
+    if(m_running)
+    {
+        return false;
+    }
+
+    for(const std::unique_ptr<EventLoop>& event_loop : m_event_loops)
+    {
+        if(event_loop->epoll_file_descriptor < 0 || event_loop->wakeup_file_descriptor < 0 || event_loop->timer_file_descriptor < 0)
+        {
+            return false;
+        }
+    }
+
+    m_running = true;
+
+    for(const std::unique_ptr<EventLoop>& event_loop : m_event_loops)
+    {
+#ifdef APPLICATION_CLIENT_IO_URING
+        if(m_backend == ReactorBackend::IO_URING)
+        {
+            event_loop->thread = std::thread(&ClientReactor::RunIoUringEventLoop, this, std::ref(*event_loop));
+            continue;
+        }
+#endif
+        event_loop->thread = std::thread(&ClientReactor::RunEventLoop, this, std::ref(*event_loop));
+    }
+
+    return true;
+}
+
+void ClientReactor::Stop()
+{
+    m_running = false;
+
+    for(const std::unique_ptr<EventLoop>& event_loop : m_event_loops)
+    {
+        WakeEventLoop(*event_loop);
+    }
+
+    for(const std::unique_ptr<EventLoop>& event_loop : m_event_loops)
+    {
+        if(event_loop->thread.joinable())
+        {
+            event_loop->thread.join();
+        }
+    }
+}
+
+bool ClientReactor::IsRunning() const
+{
+    return m_running;
+}
+
+size_t ClientReactor::GetEventLoopCount() const
+{
+    return m_event_loops.size();
+}
+
+ReactorBackend ClientReactor::GetBackend() const
+{
+    return m_backend;
+}
+
+size_t ClientReactor::AssignEventLoop()
+{
+    return m_next_event_loop.fetch_add(1, std::memory_order_relaxed) % m_event_loops.size();
+}
+
+bool ClientReactor::IsEventLoopThread(size_t event_loop) const
+{
+    return m_event_loops[event_loop]->thread_id.load() == std::this_thread::get_id();
+}
+
+bool ClientReactor::Watch(size_t event_loop, int file_descriptor, uint32_t events, ReactorEventHandler* handler)
+{
+    epoll_event event {};
+    event.events = events;
+    event.data.ptr = handler;
+
+    if(epoll_ctl(m_event_loops[event_loop]->epoll_file_descriptor, EPOLL_CTL_ADD, file_descriptor, &event) < 0)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to watch file descriptor! Error code: {" + std::to_string(errno) +"}";
+        perror(error_message.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+bool ClientReactor::Modify(size_t event_loop, int file_descriptor, uint32_t events, ReactorEventHandler* handler)
+{
+    epoll_event event {};
+    event.events = events;
+    event.data.ptr = handler;
+
+    if(epoll_ctl(m_event_loops[event_loop]->epoll_file_descriptor, EPOLL_CTL_MOD, file_descriptor, &event) < 0)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to modify watched file descriptor! Error code: {" + std::to_string(errno) +"}";
+        perror(error_message.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+void ClientReactor::Unwatch(size_t event_loop, int file_descriptor)
+{
+    epoll_ctl(m_event_loops[event_loop]->epoll_file_descriptor, EPOLL_CTL_DEL, file_descriptor, nullptr);
+}
+
+bool ClientReactor::SubmitReceive(size_t event_loop, int file_descriptor, std::span<char> buffer, ReactorEventHandler* handler, uint16_t tag)
+{
+#ifdef APPLICATION_CLIENT_IO_URING
+    if(m_backend == ReactorBackend::IO_URING)
+    {
+        io_uring_sqe* submission_entry = m_event_loops[event_loop]->io_uring->GetSubmissionEntry();
+        submission_entry->opcode = IORING_OP_RECV;
+        submission_entry->fd = file_descriptor;
+        submission_entry->addr = reinterpret_cast<uint64_t>(buffer.data());
+        submission_entry->len = static_cast<uint32_t>(buffer.size());
+        submission_entry->user_data = reinterpret_cast<uint64_t>(handler) | (static_cast<uint64_t>(ReactorOperation::RECEIVE) << COMPLETION_OPERATION_SHIFT) | (static_cast<uint64_t>(tag) << COMPLETION_TAG_SHIFT);
+        return true;
+    }
+#endif
+    (void)event_loop;
+    (void)file_descriptor;
+    (void)buffer;
+    (void)handler;
+    (void)tag;
+    return false;
+}
+
+bool ClientReactor::SubmitSend(size_t event_loop, int file_descriptor, const msghdr* message, int flags, ReactorEventHandler* handler, uint16_t tag)
+{
+#ifdef APPLICATION_CLIENT_IO_URING
+    if(m_backend == ReactorBackend::IO_URING)
+    {
+        io_uring_sqe* submission_entry = m_event_loops[event_loop]->io_uring->GetSubmissionEntry();
+        submission_entry->opcode = IORING_OP_SENDMSG;
+        submission_entry->fd = file_descriptor;
+        submission_entry->addr = reinterpret_cast<uint64_t>(message);
+        submission_entry->len = 1;
+        submission_entry->msg_flags = static_cast<uint32_t>(flags);
+        submission_entry->user_data = reinterpret_cast<uint64_t>(handler) | (static_cast<uint64_t>(ReactorOperation::SEND) << COMPLETION_OPERATION_SHIFT) | (static_cast<uint64_t>(tag) << COMPLETION_TAG_SHIFT);
+        return true;
+    }
+#endif
+    (void)event_loop;
+    (void)file_descriptor;
+    (void)message;
+    (void)flags;
+    (void)handler;
+    (void)tag;
+    return false;
+}
+
+void ClientReactor::Post(size_t event_loop, ReactorTask task)
+{
+    EventLoop& target_event_loop = *m_event_loops[event_loop];
+
+    bool was_idle = false;
+
+    {
+        std::lock_guard<std::mutex> lock(target_event_loop.task_mutex);
+        was_idle = target_event_loop.tasks.empty();
+        target_event_loop.tasks.emplace_back(std::move(task));
+    }
+
+    // Only the first task of a batch needs to interrupt epoll_wait(), the rest are picked up in the same pass
+    if(was_idle)
+    {
+        WakeEventLoop(target_event_loop);
+    }
+}
+
+void ClientReactor::Execute(size_t event_loop, ReactorTask task)
+{
+    if(not IsRunning() || IsEventLoopThread(event_loop))
+    {
+        task();
+        return;
+    }
+
+    std::binary_semaphore task_done_semaphore {0};
+
+    Post(event_loop, [&]()
+    {
+        task();
+        task_done_semaphore.release();
+    });
+
+    task_done_semaphore.acquire();
+}
+
+ReactorTimerId ClientReactor::PostAfter(size_t event_loop, std::chrono::milliseconds delay, ReactorTask task)
+{
+    EventLoop& target_event_loop = *m_event_loops[event_loop];
+
+    const ReactorTimerId timer_id = m_next_timer_id.fetch_add(1, std::memory_order_relaxed);
+    const std::chrono::steady_clock::time_point due_time = std::chrono::steady_clock::now() + delay;
+
+    std::lock_guard<std::mutex> lock(target_event_loop.task_mutex);
+
+    const auto timer = target_event_loop.timers.emplace(std::make_pair(due_time, timer_id), std::move(task)).first;
+
+    // Only a new earliest timer moves the deadline of the timer descriptor
+    if(timer == target_event_loop.timers.begin())
+    {
+        ArmTimer(target_event_loop);
+    }
+
+    return timer_id;
+}
+
+void ClientReactor::CancelTimer(size_t event_loop, ReactorTimerId timer_id)
+{
+    EventLoop& target_event_loop = *m_event_loops[event_loop];
+
+    std::lock_guard<std::mutex> lock(target_event_loop.task_mutex);
+
+    // Cancelling is rare and an event loop only holds a few timers, so a scan is cheaper than a second index
+    for(auto timer = target_event_loop.timers.begin(); timer != target_event_loop.timers.end(); ++timer)
+    {
+        if(timer->first.second == timer_id)
+        {
+            const bool is_earliest_timer = timer == target_event_loop.timers.begin();
+
+            target_event_loop.timers.erase(timer);
+
+            // Otherwise the descriptor would fire for the cancelled deadline, find nothing due and never be re-armed for the next one
+            if(is_earliest_timer)
+            {
+                ArmTimer(target_event_loop);
+            }
+
+            return;
+        }
+    }
+}
+
+void ClientReactor::RunEventLoop(EventLoop& event_loop)
+{
+    event_loop.thread_id = std::this_thread::get_id();
+
+    while(m_running)
+    {
+        if(not DispatchEpollEvents(event_loop, -1))
+        {
+            break;
+        }
+
+        RunPendingTasks(event_loop);
+    }
+
+    // Complete whatever was posted before shutdown so that no caller of Execute() is left waiting
+    RunPendingTasks(event_loop);
+
+    event_loop.thread_id = std::thread::id();
+}
+
+bool ClientReactor::DispatchEpollEvents(EventLoop& event_loop, int timeout)
+{
+    epoll_event events[MAX_EVENTS_PER_WAIT];
+
+    const int event_count = epoll_wait(event_loop.epoll_file_descriptor, events, MAX_EVENTS_PER_WAIT, timeout);
+
+    if(event_count < 0)
+    {
+        if(errno == EINTR)
+        {
+            return true;
+        }
+
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to wait for events! Error code: {" + std::to_string(errno) +"}";
+        perror(error_message.c_str());
+        return false;
+    }
+
+    for(int index = 0; index < event_count; ++index)
+    {
+        // The due timers run along with the posted tasks, after the events have been dispatched
+        if(events[index].data.u64 == TIMER_EVENT_DATA)
+        {
+            uint64_t expiration_count = 0;
+            (void)read(event_loop.timer_file_descriptor, &expiration_count, sizeof(expiration_count));
+            continue;
+        }
+
+        ReactorEventHandler* handler = static_cast<ReactorEventHandler*>(events[index].data.ptr);
+
+        if(handler == nullptr)
+        {
+            uint64_t wakeup_count = 0;
+            (void)read(event_loop.wakeup_file_descriptor, &wakeup_count, sizeof(wakeup_count));
+            continue;
+        }
+
+        handler->OnReactorEvents(events[index].events);
+    }
+
+    return true;
+}
+
+#ifdef APPLICATION_CLIENT_IO_URING
+void ClientReactor::RunIoUringEventLoop(EventLoop& event_loop)
+{
+    event_loop.thread_id = std::this_thread::get_id();
+
+    WatchEpollSet(event_loop);
+
+    while(m_running)
+    {
+        // One call submits everything that was queued during the previous iteration and waits for the next completion
+        const int result = event_loop.io_uring->SubmitAndWait();
+
+        if(result < 0 && result != -EINTR && result != -EBUSY)
+        {
+            const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to enter io_uring! Error code: {" + std::to_string(-result) +"}";
+            perror(error_message.c_str());
+            break;
+        }
+
+        bool is_epoll_set_ready = false;
+
+        event_loop.io_uring->DrainCompletions([&](const io_uring_cqe& completion)
+        {
+            if(completion.user_data == EPOLL_READY_USER_DATA)
+            {
+                is_epoll_set_ready = true;
+                return;
+            }
+
+            DispatchCompletion(completion.user_data, completion.res);
+        });
+
+        if(is_epoll_set_ready)
+        {
+            DispatchEpollEvents(event_loop, 0);
+
+            // The poll is one-shot, and re-arming it reports readiness right away if events are still pending
+            WatchEpollSet(event_loop);
+        }
+
+        RunPendingTasks(event_loop);
+    }
+
+    // Complete whatever was posted before shutdown so that no caller of Execute() is left waiting
+    RunPendingTasks(event_loop);
+
+    event_loop.thread_id = std::thread::id();
+}
+
+void ClientReactor::WatchEpollSet(EventLoop& event_loop)
+{
+    io_uring_sqe* submission_entry = event_loop.io_uring->GetSubmissionEntry();
+    submission_entry->opcode = IORING_OP_POLL_ADD;
+    submission_entry->fd = event_loop.epoll_file_descriptor;
+    submission_entry->poll32_events = POLLIN;
+    submission_entry->user_data = EPOLL_READY_USER_DATA;
+}
+
+void ClientReactor::DispatchCompletion(uint64_t user_data, int32_t result)
+{
+    ReactorEventHandler* handler = reinterpret_cast<ReactorEventHandler*>(user_data & COMPLETION_HANDLER_MASK);
+    const ReactorOperation operation = static_cast<ReactorOperation>((user_data >> COMPLETION_OPERATION_SHIFT) & 0xF);
+    const uint16_t tag = static_cast<uint16_t>(user_data >> COMPLETION_TAG_SHIFT);
+
+    handler->OnReactorCompletion(operation, tag, result);
+}
+#endif
+
+void ClientReactor::RunPendingTasks(EventLoop& event_loop)
+{
+    std::vector<ReactorTask> tasks;
+
+    {
+        std::lock_guard<std::mutex> lock(event_loop.task_mutex);
+        tasks.swap(event_loop.tasks);
+    }
+
+    for(ReactorTask& task : tasks)
+    {
+        task();
+    }
+
+    RunDueTimers(event_loop);
+}
+
+void ClientReactor::RunDueTimers(EventLoop& event_loop)
+{
+    std::vector<ReactorTask> due_tasks;
+
+    {
+        std::lock_guard<std::mutex> lock(event_loop.task_mutex);
+
+        if(event_loop.timers.empty())
+        {
+            return;
+        }
+
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+        while(not event_loop.timers.empty() && event_loop.timers.begin()->first.first <= now)
+        {
+            due_tasks.emplace_back(std::move(event_loop.timers.begin()->second));
+            event_loop.timers.erase(event_loop.timers.begin());
+        }
+
+        if(not due_tasks.empty())
+        {
+            ArmTimer(event_loop);
+        }
+    }
+
+    for(ReactorTask& task : due_tasks)
+    {
+        task();
+    }
+}
+
+void ClientReactor::ArmTimer(EventLoop& event_loop)
+{
+    // An all-zero deadline disarms the descriptor. A steady clock deadline is never zero, and one that has passed already fires right away.
+    itimerspec deadline {};
+
+    if(not event_loop.timers.empty())
+    {
+        const std::chrono::nanoseconds due_time = event_loop.timers.begin()->first.first.time_since_epoch();
+        deadline.it_value.tv_sec = std::chrono::duration_cast<std::chrono::seconds>(due_time).count();
+        deadline.it_value.tv_nsec = (due_time % std::chrono::seconds(1)).count();
+    }
+
+    timerfd_settime(event_loop.timer_file_descriptor, TFD_TIMER_ABSTIME, &deadline, nullptr);
+}
+
+void ClientReactor::WakeEventLoop(EventLoop& event_loop)
+{
+    const uint64_t wakeup_count = 1;
+    (void)write(event_loop.wakeup_file_descriptor, &wakeup_count, sizeof(wakeup_count));
+}
+
+} // namespace InterProcessCommunication
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <sys/socket.h>
+
+namespace InterProcessCommunication
+{
+
+#ifdef APPLICATION_CLIENT_IO_URING
+class IoUringQueue;
+#endif
+
+enum class ReactorBackend
+{
+    EPOLL,
+    IO_URING
+};
+
+/*
+    \brief The socket operations that an io_uring event loop performs on behalf of a handler
+*/
+enum class ReactorOperation : uint8_t
+{
+    RECEIVE = 1,
+    SEND = 2
+};
+
+/*
+    \brief Receives the readiness events of a file descriptor that is watched by a ClientReactor event loop,
+        and the results of operations that were submitted to an io_uring event loop
+*/
+class ReactorEventHandler
+{
+public:
+    virtual ~ReactorEventHandler() = default;
+    virtual void OnReactorEvents(uint32_t events) = 0;
+    /*
+        \brief Invoked with the tag passed on submission and the operation's result: the number of bytes transferred, or a negative errno
+    */
+    virtual void OnReactorCompletion(ReactorOperation operation, uint16_t tag, int32_t result)
+    {
+        (void)operation;
+        (void)tag;
+        (void)result;
+    }
+};
+
+using ReactorTask = std::function<void()>;
+/*
+    \brief Identifies a task that was queued with ClientReactor::PostAfter(). Zero never identifies a task.
+*/
+using ReactorTimerId = uint64_t;
+
+/*
+    \brief A pool of event loops that drives the sockets of many ApplicationClient instances.
+        Each registered client is pinned to one event loop, so all of its socket work and callbacks run on that loop's thread.
+        The reactor must outlive every client that is started with it.
+
+        With the IO_URING backend, each event loop also owns an io_uring. Clients then submit their receives and sends to it instead of
+        reacting to readiness, and one io_uring_enter() call per loop iteration submits every queued operation and reaps every completion.
+        The epoll set is still used for connection attempts and wakeups, since the io_uring waits on it.
+        If io_uring was not available at build time, or the kernel refuses to set it up, the reactor falls back to the EPOLL backend.
+*/
+class ClientReactor
+{
+public:
+
+    ClientReactor(const ClientReactor&) = delete;
+    ClientReactor& operator=(const ClientReactor&) = delete;
+    ClientReactor(ClientReactor&&) = delete;
+    ClientReactor& operator=(ClientReactor&&) = delete;
+    ~ClientReactor();
+    explicit ClientReactor(size_t event_loop_count = 1, ReactorBackend backend = ReactorBackend::EPOLL);
+
+    /*
+        \brief This function starts one thread per event loop
+    */
+    bool Start();
+    void Stop();
+    bool IsRunning() const;
+    size_t GetEventLoopCount() const;
+    /*
+        \brief This function reports the backend that is in use, which differs from the requested one after a fallback
+    */
+    ReactorBackend GetBackend() const;
+
+    /*
+        \brief This function selects the event loop that will drive the next registered client (round-robin)
+    */
+    size_t AssignEventLoop();
+    bool IsEventLoopThread(size_t event_loop) const;
+
+    /*
+        \brief The following functions register interest in a file descriptor. They must be called from the event loop thread.
+    */
+    bool Watch(size_t event_loop, int file_descriptor, uint32_t events, ReactorEventHandler* handler);
+    bool Modify(size_t event_loop, int file_descriptor, uint32_t events, ReactorEventHandler* handler);
+    void Unwatch(size_t event_loop, int file_descriptor);
+
+    /*
+        \brief The following functions queue an operation on the event loop's io_uring, to be submitted at the end of the current loop iteration.
+            They must be called from the event loop thread and return false unless the IO_URING backend is in use.
+            The buffer (or message) must stay valid until the handler's OnReactorCompletion() has been called for the operation.
+            Only the lower 12 bits of the tag are passed back.
+    */
+    bool SubmitReceive(size_t event_loop, int file_descriptor, std::span<char> buffer, ReactorEventHandler* handler, uint16_t tag);
+    bool SubmitSend(size_t event_loop, int file_descriptor, const msghdr* message, int flags, ReactorEventHandler* handler, uint16_t tag);
+
+    /*
+        \brief This function queues a task to run on the event loop thread. It is safe to call from any thread.
+    */
+    void Post(size_t event_loop, ReactorTask task);
+    /*
+        \brief This function runs a task on the event loop thread and waits for it to complete. When called from the event loop thread, or while the reactor is stopped, the task runs inline.
+    */
+    void Execute(size_t event_loop, ReactorTask task);
+    /*
+        \brief This function queues a task to run on the event loop thread once the delay has passed. It is safe to call from any thread.
+    */
+    ReactorTimerId PostAfter(size_t event_loop, std::chrono::milliseconds delay, ReactorTask task);
+    /*
+        \brief This function discards a task queued by PostAfter() that has not run yet. Once it returns on the event loop thread, the task is guaranteed not to run.
+    */
+    void CancelTimer(size_t event_loop, ReactorTimerId timer_id);
+
+private:
+
+    const std::string_view CLASS_NAME = "ClientReactor";
+
+    static constexpr int MAX_EVENTS_PER_WAIT { 64 };
+    static constexpr int DEFAULT_FILE_DESCRIPTOR { -1 };
+    static constexpr unsigned IO_URING_ENTRY_COUNT { 1024 };
+    // A completion's user data packs the handler pointer into the lower 48 bits, the operation into the next 4 and the tag into the top 12
+    static constexpr uint64_t COMPLETION_HANDLER_MASK { (uint64_t { 1 } << 48) - 1 };
+    static constexpr unsigned COMPLETION_OPERATION_SHIFT { 48 };
+    static constexpr unsigned COMPLETION_TAG_SHIFT { 52 };
+    // The user data of the poll on the epoll set, which no handler pointer can produce
+    static constexpr uint64_t EPOLL_READY_USER_DATA { 0 };
+    // The epoll data of the timer descriptor, which no handler pointer can produce either
+    static constexpr uint64_t TIMER_EVENT_DATA { 1 };
+
+    struct EventLoop
+    {
+        int epoll_file_descriptor { DEFAULT_FILE_DESCRIPTOR };
+        int wakeup_file_descriptor { DEFAULT_FILE_DESCRIPTOR };
+        // Armed for the earliest timer, and registered with TIMER_EVENT_DATA instead of a handler
+        int timer_file_descriptor { DEFAULT_FILE_DESCRIPTOR };
+#ifdef APPLICATION_CLIENT_IO_URING
+        std::unique_ptr<IoUringQueue> io_uring;
+#endif
+        std::thread thread;
+        std::atomic<std::thread::id> thread_id;
+        std::mutex task_mutex;
+        std::vector<ReactorTask> tasks;
+        // Ordered by due time, then by identifier, and guarded by the task mutex
+        std::map<std::pair<std::chrono::steady_clock::time_point, ReactorTimerId>, ReactorTask> timers;
+    };
+
+    std::vector<std::unique_ptr<EventLoop>> m_event_loops;
+    std::atomic<size_t> m_next_event_loop { 0 };
+    std::atomic<ReactorTimerId> m_next_timer_id { 1 };
+    std::atomic<bool> m_running { false };
+    ReactorBackend m_backend { ReactorBackend::EPOLL };
+
+    void RunEventLoop(EventLoop& event_loop);
+    bool DispatchEpollEvents(EventLoop& event_loop, int timeout);
+#ifdef APPLICATION_CLIENT_IO_URING
+    bool CreateIoUrings();
+    void RunIoUringEventLoop(EventLoop& event_loop);
+    void WatchEpollSet(EventLoop& event_loop);
+    void DispatchCompletion(uint64_t user_data, int32_t result);
+#endif
+    void RunPendingTasks(EventLoop& event_loop);
+    void RunDueTimers(EventLoop& event_loop);
+    void ArmTimer(EventLoop& event_loop);
+    void WakeEventLoop(EventLoop& event_loop);
+};
+
+} // namespace InterProcessCommunication
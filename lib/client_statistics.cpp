@@ -0,0 +1,197 @@
+#include "client_statistics.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace InterProcessCommunication
+{
+uint64_t LatencyHistogramSnapshot::GetPercentile(double percentile) const
+{
+    if(count == 0 || bucket_counts.empty())
+    {
+        return 0;
+    }
+
+    // The rank of the value that the percentile falls on, counting from 1
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(std::clamp(percentile, 0.0, 100.0) / 100.0 * count)));
+    uint64_t cumulative_count = 0;
+
+    for(size_t bucket_index = 0; bucket_index < bucket_counts.size(); ++bucket_index)
+    {
+        cumulative_count += bucket_counts[bucket_index];
+
+        if(cumulative_count >= rank)
+        {
+            return std::min(LatencyHistogram::GetBucketUpperBound(bucket_index), max_nanoseconds);
+        }
+    }
+
+    return max_nanoseconds;
+}
+
+double LatencyHistogramSnapshot::GetMeanNanoseconds() const
+{
+    return count > 0 ? static_cast<double>(sum_nanoseconds) / count : 0.0;
+}
+
+void LatencyHistogramSnapshot::Merge(const LatencyHistogramSnapshot& other)
+{
+    if(bucket_counts.size() < other.bucket_counts.size())
+    {
+        bucket_counts.resize(other.bucket_counts.size());
+    }
+
+    for(size_t bucket_index = 0; bucket_index < other.bucket_counts.size(); ++bucket_index)
+    {
+        bucket_counts[bucket_index] += other.bucket_counts[bucket_index];
+    }
+
+    count += other.count;
+    sum_nanoseconds += other.sum_nanoseconds;
+    max_nanoseconds = std::max(max_nanoseconds, other.max_nanoseconds);
+}
+
+void LatencyHistogram::Record(uint64_t nanoseconds)
+{
+    // There is a single writer, so a relaxed load and store is enough and avoids locked read-modify-write instructions
+    std::atomic<uint64_t>& bucket_count = m_bucket_counts[GetBucketIndex(nanoseconds)];
+    bucket_count.store(bucket_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    m_count.store(m_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    m_sum_nanoseconds.store(m_sum_nanoseconds.load(std::memory_order_relaxed) + nanoseconds, std::memory_order_relaxed);
+
+    if(nanoseconds > m_max_nanoseconds.load(std::memory_order_relaxed))
+    {
+        m_max_nanoseconds.store(nanoseconds, std::memory_order_relaxed);
+    }
+}
+
+LatencyHistogramSnapshot LatencyHistogram::GetSnapshot() const
+{
+    LatencyHistogramSnapshot snapshot;
+    snapshot.bucket_counts.resize(BUCKET_COUNT);
+
+    // The buckets are read one by one while the writer carries on, so the count is derived from them rather than read separately
+    for(size_t bucket_index = 0; bucket_index < BUCKET_COUNT; ++bucket_index)
+    {
+        snapshot.bucket_counts[bucket_index] = m_bucket_counts[bucket_index].load(std::memory_order_relaxed);
+        snapshot.count += snapshot.bucket_counts[bucket_index];
+    }
+
+    snapshot.sum_nanoseconds = m_sum_nanoseconds.load(std::memory_order_relaxed);
+    snapshot.max_nanoseconds = m_max_nanoseconds.load(std::memory_order_relaxed);
+
+    return snapshot;
+}
+
+size_t LatencyHistogram::GetBucketIndex(uint64_t nanoseconds)
+{
+    // Values below SUB_BUCKET_COUNT get a bucket each
+    if(nanoseconds < SUB_BUCKET_COUNT)
+    {
+        return nanoseconds;
+    }
+
+    const unsigned exponent = std::bit_width(nanoseconds) - 1;
+
+    if(exponent >= MAX_EXPONENT)
+    {
+        return BUCKET_COUNT - 1;
+    }
+
+    // The bits right below the leading one select the linear sub-bucket
+    const size_t sub_bucket = (nanoseconds >> (exponent - SUB_BUCKET_BITS)) - SUB_BUCKET_COUNT;
+
+    return SUB_BUCKET_COUNT + (exponent - SUB_BUCKET_BITS) * SUB_BUCKET_COUNT + sub_bucket;
+}
+
+uint64_t LatencyHistogram::GetBucketUpperBound(size_t bucket_index)
+{
+    if(bucket_index < SUB_BUCKET_COUNT)
+    {
+        return bucket_index;
+    }
+
+    if(bucket_index >= BUCKET_COUNT - 1)
+    {
+        return UINT64_MAX;
+    }
+
+    const unsigned shift = (bucket_index - SUB_BUCKET_COUNT) / SUB_BUCKET_COUNT;
+    const uint64_t sub_bucket = (bucket_index - SUB_BUCKET_COUNT) % SUB_BUCKET_COUNT;
+
+    return ((SUB_BUCKET_COUNT + sub_bucket + 1) << shift) - 1;
+}
+
+ClientStatisticsRecorder::ClientStatisticsRecorder(bool latency_histograms)
+{
+#ifdef APPLICATION_CLIENT_STATISTICS
+    if(latency_histograms)
+    {
+        m_enqueue_to_send_latency = std::make_unique<LatencyHistogram>();
+        m_recv_to_callback_latency = std::make_unique<LatencyHistogram>();
+    }
+#else
+    (void)latency_histograms;
+#endif
+}
+
+uint64_t ClientStatisticsRecorder::GetTxQueueDepth() const
+{
+#ifdef APPLICATION_CLIENT_STATISTICS
+    // Read the consumer's count first, so that the depth can not underflow when a payload is enqueued and dequeued in between
+    const uint64_t dequeued = m_tx_counters.dequeued.load(std::memory_order_relaxed);
+
+    return m_producer_counters.enqueued.load(std::memory_order_relaxed) - dequeued;
+#else
+    return 0;
+#endif
+}
+
+uint64_t ClientStatisticsRecorder::GetRxDispatchQueueDepth() const
+{
+#ifdef APPLICATION_CLIENT_STATISTICS
+    const uint64_t delivered = m_dispatch_counters.delivered.load(std::memory_order_relaxed);
+
+    return m_rx_counters.dispatched.load(std::memory_order_relaxed) - delivered;
+#else
+    return 0;
+#endif
+}
+
+ClientStatistics ClientStatisticsRecorder::GetSnapshot() const
+{
+    ClientStatistics statistics;
+
+#ifdef APPLICATION_CLIENT_STATISTICS
+    statistics.tx_queue_depth = GetTxQueueDepth();
+    statistics.tx_queue_high_water_mark = std::max(m_tx_counters.high_water_mark.load(std::memory_order_relaxed), statistics.tx_queue_depth);
+    statistics.rx_dispatch_queue_depth = GetRxDispatchQueueDepth();
+    statistics.rx_dispatch_queue_high_water_mark = std::max(m_rx_counters.dispatch_high_water_mark.load(std::memory_order_relaxed), statistics.rx_dispatch_queue_depth);
+    statistics.tx_messages = m_tx_counters.tx_messages.load(std::memory_order_relaxed);
+    statistics.tx_bytes = m_tx_counters.tx_bytes.load(std::memory_order_relaxed);
+    statistics.send_calls = m_tx_counters.send_calls.load(std::memory_order_relaxed);
+    statistics.partial_writes = m_tx_counters.partial_writes.load(std::memory_order_relaxed);
+    statistics.rx_messages = m_rx_counters.rx_messages.load(std::memory_order_relaxed);
+    statistics.rx_bytes = m_rx_counters.rx_bytes.load(std::memory_order_relaxed);
+    statistics.recv_calls = m_rx_counters.recv_calls.load(std::memory_order_relaxed);
+    statistics.reconnect_attempts = m_connection_counters.reconnect_attempts.load(std::memory_order_relaxed);
+    statistics.last_time_to_reconnect_nanoseconds = m_connection_counters.last_time_to_reconnect.load(std::memory_order_relaxed);
+    statistics.max_time_to_reconnect_nanoseconds = m_connection_counters.max_time_to_reconnect.load(std::memory_order_relaxed);
+
+    for(size_t error_index = 0; error_index < ERROR_COUNT; ++error_index)
+    {
+        statistics.error_counts[error_index] = m_error_counts[error_index].load(std::memory_order_relaxed);
+    }
+
+    if(m_enqueue_to_send_latency != nullptr)
+    {
+        statistics.enqueue_to_send_latency = m_enqueue_to_send_latency->GetSnapshot();
+        statistics.recv_to_callback_latency = m_recv_to_callback_latency->GetSnapshot();
+    }
+#endif
+
+    return statistics;
+}
+
+} // namespace InterProcessCommunication
@@ -0,0 +1,353 @@
+#pragma once
+
+#include "client_error.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <sys/types.h>
+
+namespace InterProcessCommunication
+{
+
+/*
+    \brief A point-in-time copy of a LatencyHistogram. The bucket counts are empty when the histogram was not recorded.
+*/
+struct LatencyHistogramSnapshot
+{
+    std::vector<uint64_t> bucket_counts;
+    uint64_t count = 0;
+    uint64_t sum_nanoseconds = 0;
+    uint64_t max_nanoseconds = 0;
+
+    /*
+        \brief This function returns the value (in nanoseconds) below which the given percentage (0 to 100) of the recorded values fall, rounded up to its bucket's upper bound
+    */
+    uint64_t GetPercentile(double percentile) const;
+    double GetMeanNanoseconds() const;
+    /*
+        \brief This function adds the values recorded by another histogram, for example to combine the histograms of several clients
+    */
+    void Merge(const LatencyHistogramSnapshot& other);
+};
+
+/*
+    \brief A log-linear latency histogram in the style of HdrHistogram. Every power of two range of nanoseconds is split into SUB_BUCKET_COUNT linear buckets,
+        so a recorded value is kept with a relative precision of about 6%. Values of 2^MAX_EXPONENT nanoseconds (about 34 seconds) or more share the last bucket.
+        Recording is lock-free but must only be done by a single thread, while snapshots may be taken from any thread.
+*/
+class LatencyHistogram
+{
+public:
+
+    static constexpr unsigned SUB_BUCKET_BITS { 4 };
+    static constexpr size_t SUB_BUCKET_COUNT { size_t { 1 } << SUB_BUCKET_BITS };
+    static constexpr unsigned MAX_EXPONENT { 35 };
+    static constexpr size_t BUCKET_COUNT { SUB_BUCKET_COUNT + (MAX_EXPONENT - SUB_BUCKET_BITS) * SUB_BUCKET_COUNT };
+
+    void Record(uint64_t nanoseconds);
+    LatencyHistogramSnapshot GetSnapshot() const;
+
+    static size_t GetBucketIndex(uint64_t nanoseconds);
+    /*
+        \brief This function returns the largest value that falls into the bucket
+    */
+    static uint64_t GetBucketUpperBound(size_t bucket_index);
+
+private:
+
+    std::array<std::atomic<uint64_t>, BUCKET_COUNT> m_bucket_counts {};
+    std::atomic<uint64_t> m_count { 0 };
+    std::atomic<uint64_t> m_sum_nanoseconds { 0 };
+    std::atomic<uint64_t> m_max_nanoseconds { 0 };
+};
+
+/*
+    \brief A snapshot of an ApplicationClient's runtime statistics. Every field stays zero when statistics are compiled out (APPLICATION_CLIENT_ENABLE_STATISTICS=OFF).
+        The latency histograms are only recorded when ClientOptions::statistics.latency_histograms is set.
+*/
+struct ClientStatistics
+{
+    // Payloads (and their bytes, including frame headers) that the kernel has accepted completely
+    uint64_t tx_messages = 0;
+    uint64_t tx_bytes = 0;
+    // Messages delivered to the RX callbacks (each message of a batch counts), and the bytes read from the socket
+    uint64_t rx_messages = 0;
+    uint64_t rx_bytes = 0;
+    // Payloads enqueued but not yet picked up by the TX consumer. The high-water mark is sampled whenever the TX consumer drains the queue.
+    uint64_t tx_queue_depth = 0;
+    uint64_t tx_queue_high_water_mark = 0;
+    // Received messages handed over to the executor but not yet delivered (see RxDispatchOptions). The high-water mark is sampled whenever a message is handed over.
+    uint64_t rx_dispatch_queue_depth = 0;
+    uint64_t rx_dispatch_queue_high_water_mark = 0;
+    uint64_t send_calls = 0;
+    // Sends that the kernel accepted only part of
+    uint64_t partial_writes = 0;
+    uint64_t recv_calls = 0;
+    // Connections established after the first one
+    uint64_t reconnects = 0;
+    // Connection attempts made by automatic reconnecting (see ReconnectOptions), and the time from losing a connection until it was re-established
+    uint64_t reconnect_attempts = 0;
+    uint64_t last_time_to_reconnect_nanoseconds = 0;
+    uint64_t max_time_to_reconnect_nanoseconds = 0;
+    std::array<uint64_t, ERROR_COUNT> error_counts {};
+    // From EnqueuePayload() until the kernel has accepted the payload's last byte
+    LatencyHistogramSnapshot enqueue_to_send_latency;
+    // From the read that completed a message until its RX callback returned
+    LatencyHistogramSnapshot recv_to_callback_latency;
+
+    uint64_t GetErrorCount(Error error) const
+    {
+        return error_counts[static_cast<size_t>(error)];
+    }
+};
+
+/*
+    \brief The counters behind ClientStatistics. Each group of counters is written by one thread only (producers aside), so recording is a relaxed load and store
+        on a cache line that no other writer touches. When statistics are compiled out, the recorder is empty and every function is a no-op.
+*/
+class ClientStatisticsRecorder
+{
+public:
+
+#ifdef APPLICATION_CLIENT_STATISTICS
+    static constexpr bool IS_COMPILED_IN { true };
+#else
+    static constexpr bool IS_COMPILED_IN { false };
+#endif
+
+    explicit ClientStatisticsRecorder(bool latency_histograms);
+
+    /*
+        \brief This function returns a steady clock timestamp in nanoseconds for the latency histograms, or zero when they are not recorded
+    */
+    uint64_t GetLatencyTimestamp() const
+    {
+#ifdef APPLICATION_CLIENT_STATISTICS
+        if(m_enqueue_to_send_latency != nullptr)
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+#endif
+        return 0;
+    }
+
+    /* PRODUCERS */
+    void RecordEnqueue()
+    {
+#ifdef APPLICATION_CLIENT_STATISTICS
+        m_producer_counters.enqueued.fetch_add(1, std::memory_order_relaxed);
+#endif
+    }
+
+    /* TX CONSUMER */
+    void RecordTxQueueDrain()
+    {
+#ifdef APPLICATION_CLIENT_STATISTICS
+        const uint64_t depth = m_producer_counters.enqueued.load(std::memory_order_relaxed) - m_tx_counters.dequeued.load(std::memory_order_relaxed);
+
+        if(depth > m_tx_counters.high_water_mark.load(std::memory_order_relaxed))
+        {
+            m_tx_counters.high_water_mark.store(depth, std::memory_order_relaxed);
+        }
+#endif
+    }
+
+    void RecordDequeue()
+    {
+#ifdef APPLICATION_CLIENT_STATISTICS
+        Increment(m_tx_counters.dequeued, 1);
+#endif
+    }
+
+    void RecordSend(size_t gathered_bytes, ssize_t sent_bytes)
+    {
+#ifdef APPLICATION_CLIENT_STATISTICS
+        Increment(m_tx_counters.send_calls, 1);
+
+        if(sent_bytes >= 0 && static_cast<size_t>(sent_bytes) < gathered_bytes)
+        {
+            Increment(m_tx_counters.partial_writes, 1);
+        }
+#else
+        (void)gathered_bytes;
+        (void)sent_bytes;
+#endif
+    }
+
+    void RecordSentBytes(size_t sent_bytes)
+    {
+#ifdef APPLICATION_CLIENT_STATISTICS
+        Increment(m_tx_counters.tx_bytes, sent_bytes);
+#else
+        (void)sent_bytes;
+#endif
+    }
+
+    void RecordSentMessage(uint64_t enqueue_timestamp)
+    {
+#ifdef APPLICATION_CLIENT_STATISTICS
+        Increment(m_tx_counters.tx_messages, 1);
+
+        if(m_enqueue_to_send_latency != nullptr)
+        {
+            m_enqueue_to_send_latency->Record(GetLatencyTimestamp() - enqueue_timestamp);
+        }
+#else
+        (void)enqueue_timestamp;
+#endif
+    }
+
+    /* RX CONSUMER */
+    void RecordRecv(ssize_t read_bytes)
+    {
+#ifdef APPLICATION_CLIENT_STATISTICS
+        Increment(m_rx_counters.recv_calls, 1);
+
+        if(read_bytes > 0)
+        {
+            Increment(m_rx_counters.rx_bytes, read_bytes);
+        }
+#else
+        (void)read_bytes;
+#endif
+    }
+
+    void RecordReceivedMessage(uint64_t read_timestamp)
+    {
+#ifdef APPLICATION_CLIENT_STATISTICS
+        Increment(m_rx_counters.rx_messages, 1);
+
+        if(m_recv_to_callback_latency != nullptr)
+        {
+            m_recv_to_callback_latency->Record(GetLatencyTimestamp() - read_timestamp);
+        }
+#else
+        (void)read_timestamp;
+#endif
+    }
+
+    void RecordRxDispatch()
+    {
+#ifdef APPLICATION_CLIENT_STATISTICS
+        Increment(m_rx_counters.dispatched, 1);
+
+        const uint64_t depth = GetRxDispatchQueueDepth();
+
+        if(depth > m_rx_counters.dispatch_high_water_mark.load(std::memory_order_relaxed))
+        {
+            m_rx_counters.dispatch_high_water_mark.store(depth, std::memory_order_relaxed);
+        }
+#endif
+    }
+
+    /* RX DISPATCH (one executor task at a time) */
+    void RecordRxDispatchDelivery()
+    {
+#ifdef APPLICATION_CLIENT_STATISTICS
+        Increment(m_dispatch_counters.delivered, 1);
+#endif
+    }
+
+    /* RECONNECTING THREAD */
+    void RecordReconnectAttempt()
+    {
+#ifdef APPLICATION_CLIENT_STATISTICS
+        Increment(m_connection_counters.reconnect_attempts, 1);
+#endif
+    }
+
+    void RecordReconnected(uint64_t time_to_reconnect_nanoseconds)
+    {
+#ifdef APPLICATION_CLIENT_STATISTICS
+        m_connection_counters.last_time_to_reconnect.store(time_to_reconnect_nanoseconds, std::memory_order_relaxed);
+
+        if(time_to_reconnect_nanoseconds > m_connection_counters.max_time_to_reconnect.load(std::memory_order_relaxed))
+        {
+            m_connection_counters.max_time_to_reconnect.store(time_to_reconnect_nanoseconds, std::memory_order_relaxed);
+        }
+#else
+        (void)time_to_reconnect_nanoseconds;
+#endif
+    }
+
+    /* ANY THREAD */
+    void RecordError(Error error)
+    {
+#ifdef APPLICATION_CLIENT_STATISTICS
+        m_error_counts[static_cast<size_t>(error)].fetch_add(1, std::memory_order_relaxed);
+#else
+        (void)error;
+#endif
+    }
+
+    /*
+        \brief This function returns the number of payloads that were enqueued but not yet picked up by the TX consumer, or zero when statistics are compiled out
+    */
+    uint64_t GetTxQueueDepth() const;
+    /*
+        \brief This function returns the number of received messages that were handed over to the executor but not yet delivered, or zero when statistics are compiled out
+    */
+    uint64_t GetRxDispatchQueueDepth() const;
+    ClientStatistics GetSnapshot() const;
+
+private:
+
+#ifdef APPLICATION_CLIENT_STATISTICS
+    static void Increment(std::atomic<uint64_t>& counter, uint64_t amount)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    struct alignas(64) ProducerCounters
+    {
+        std::atomic<uint64_t> enqueued { 0 };
+    };
+
+    struct alignas(64) TxCounters
+    {
+        std::atomic<uint64_t> dequeued { 0 };
+        std::atomic<uint64_t> high_water_mark { 0 };
+        std::atomic<uint64_t> tx_messages { 0 };
+        std::atomic<uint64_t> tx_bytes { 0 };
+        std::atomic<uint64_t> send_calls { 0 };
+        std::atomic<uint64_t> partial_writes { 0 };
+    };
+
+    struct alignas(64) RxCounters
+    {
+        std::atomic<uint64_t> rx_messages { 0 };
+        std::atomic<uint64_t> rx_bytes { 0 };
+        std::atomic<uint64_t> recv_calls { 0 };
+        std::atomic<uint64_t> dispatched { 0 };
+        std::atomic<uint64_t> dispatch_high_water_mark { 0 };
+    };
+
+    struct alignas(64) DispatchCounters
+    {
+        std::atomic<uint64_t> delivered { 0 };
+    };
+
+    struct alignas(64) ConnectionCounters
+    {
+        std::atomic<uint64_t> reconnect_attempts { 0 };
+        std::atomic<uint64_t> last_time_to_reconnect { 0 };
+        std::atomic<uint64_t> max_time_to_reconnect { 0 };
+    };
+
+    ProducerCounters m_producer_counters;
+    TxCounters m_tx_counters;
+    RxCounters m_rx_counters;
+    DispatchCounters m_dispatch_counters;
+    ConnectionCounters m_connection_counters;
+    std::array<std::atomic<uint64_t>, ERROR_COUNT> m_error_counts {};
+    // Only allocated when the histograms are recorded, since they take a few kilobytes each
+    std::unique_ptr<LatencyHistogram> m_enqueue_to_send_latency;
+    std::unique_ptr<LatencyHistogram> m_recv_to_callback_latency;
+#endif
+};
+
+} // namespace InterProcessCommunication
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <utility>
+
+namespace InterProcessCommunication
+{
+
+/*
+    \brief The return type of a coroutine that awaits an ApplicationClient (see ApplicationClient::Connect(), Send() and Receive()).
+        The coroutine runs as soon as it is called, and after its first suspension it carries on on whichever client thread resumes it, so no thread is spawned for it.
+        Wait() blocks until the coroutine has returned and rethrows what it threw. The destructor waits as well, since the client may still resume the coroutine.
+*/
+class ClientTask
+{
+public:
+
+    struct promise_type
+    {
+        // Shared with the final awaiter, which notifies the waiters after the frame may already have been destroyed by one of them
+        std::shared_ptr<std::atomic<bool>> is_done = std::make_shared<std::atomic<bool>>(false);
+        std::exception_ptr exception;
+
+        ClientTask get_return_object()
+        {
+            return ClientTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_never initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        auto final_suspend() const noexcept
+        {
+            struct FinalAwaiter
+            {
+                bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                void await_suspend(std::coroutine_handle<promise_type> handle) const noexcept
+                {
+                    const std::shared_ptr<std::atomic<bool>> is_done = handle.promise().is_done;
+
+                    is_done->store(true);
+                    is_done->notify_all();
+                }
+
+                void await_resume() const noexcept
+                {
+                }
+            };
+
+            return FinalAwaiter {};
+        }
+
+        void return_void() const noexcept
+        {
+        }
+
+        void unhandled_exception() noexcept
+        {
+            exception = std::current_exception();
+        }
+    };
+
+    ClientTask(const ClientTask&) = delete;
+    ClientTask& operator=(const ClientTask&) = delete;
+    ClientTask& operator=(ClientTask&&) = delete;
+
+    ClientTask(ClientTask&& other) noexcept
+    : m_handle(std::exchange(other.m_handle, nullptr))
+    {
+    }
+
+    ~ClientTask()
+    {
+        if(m_handle)
+        {
+            m_handle.promise().is_done->wait(false);
+            m_handle.destroy();
+        }
+    }
+
+    bool IsDone() const
+    {
+        return m_handle.promise().is_done->load();
+    }
+
+    void Wait() const
+    {
+        m_handle.promise().is_done->wait(false);
+
+        if(m_handle.promise().exception != nullptr)
+        {
+            std::rethrow_exception(m_handle.promise().exception);
+        }
+    }
+
+private:
+
+    explicit ClientTask(std::coroutine_handle<promise_type> handle)
+    : m_handle(handle)
+    {
+    }
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+} // namespace InterProcessCommunication
@@ -0,0 +1,76 @@
+#include "client_transport.h"
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+namespace InterProcessCommunication
+{
+int TcpTransport::Open()
+{
+    const int socket_file_descriptor = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+    if(socket_file_descriptor < 0)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to open socket! Error code: {" + std::to_string(errno) +"}";
+        perror(error_message.c_str());
+    }
+
+    return socket_file_descriptor;
+}
+
+bool TcpTransport::Connect(int socket_file_descriptor, const Endpoint& endpoint)
+{
+    sockaddr_in server_address {};
+    server_address.sin_family = AF_INET;
+    server_address.sin_port = htons(endpoint.port);
+
+    if(inet_pton(AF_INET, endpoint.ipv4_address.c_str(), &server_address.sin_addr) <= 0)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Invalid address: {" + endpoint.ipv4_address + "}";
+        perror(error_message.c_str());
+        return false;
+    }
+
+    if(connect(socket_file_descriptor, (sockaddr*)&server_address, sizeof(server_address)) < 0)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to connect to address: {" + endpoint.ipv4_address + ":" + std::to_string(endpoint.port) + "}";
+        perror(error_message.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+int UnixTransport::Open()
+{
+    const int socket_file_descriptor = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+    if(socket_file_descriptor < 0)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to open socket! Error code: {" + std::to_string(errno) +"}";
+        perror(error_message.c_str());
+    }
+
+    return socket_file_descriptor;
+}
+
+bool UnixTransport::Connect(int socket_file_descriptor, const Endpoint& endpoint)
+{
+    sockaddr_un server_address {};
+    server_address.sun_family = AF_UNIX;
+    strncpy(server_address.sun_path, endpoint.unix_socket_path.c_str(), sizeof(server_address.sun_path) - 1);
+
+    if(connect(socket_file_descriptor, (sockaddr*)&server_address, sizeof(server_address)) < 0)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to connect to address: {" + endpoint.unix_socket_path + "}";
+        perror(error_message.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace InterProcessCommunication
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace InterProcessCommunication
+{
+
+/*
+    \brief Transport policies of BasicApplicationClient. A policy names the endpoint of its socket family, and opens and connects a blocking stream socket to one.
+        Both functions report their failure to stderr, and the client reports it to its handler.
+*/
+struct TcpTransport
+{
+    struct Endpoint
+    {
+        std::string ipv4_address;
+        uint16_t port = 0;
+    };
+
+    /*
+        \brief This function returns a new socket, or -1 if it can not be opened
+    */
+    static int Open();
+    static bool Connect(int socket_file_descriptor, const Endpoint& endpoint);
+
+private:
+
+    static constexpr std::string_view CLASS_NAME = "TcpTransport";
+};
+
+struct UnixTransport
+{
+    struct Endpoint
+    {
+        std::string unix_socket_path;
+    };
+
+    /*
+        \brief This function returns a new socket, or -1 if it can not be opened
+    */
+    static int Open();
+    static bool Connect(int socket_file_descriptor, const Endpoint& endpoint);
+
+private:
+
+    static constexpr std::string_view CLASS_NAME = "UnixTransport";
+};
+
+} // namespace InterProcessCommunication
@@ -0,0 +1,171 @@
+#include "io_uring_queue.h"
+
+#ifdef APPLICATION_CLIENT_IO_URING
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace InterProcessCommunication
+{
+IoUringQueue::~IoUringQueue()
+{
+    if(m_submission_entries != nullptr)
+    {
+        munmap(m_submission_entries, m_submission_entries_size);
+    }
+
+    if(m_completion_ring != nullptr && m_completion_ring != m_submission_ring)
+    {
+        munmap(m_completion_ring, m_completion_ring_size);
+    }
+
+    if(m_submission_ring != nullptr)
+    {
+        munmap(m_submission_ring, m_submission_ring_size);
+    }
+
+    if(m_ring_file_descriptor >= 0)
+    {
+        close(m_ring_file_descriptor);
+    }
+}
+
+std::unique_ptr<IoUringQueue> IoUringQueue::Create(unsigned entry_count)
+{
+    std::unique_ptr<IoUringQueue> queue(new IoUringQueue());
+
+    io_uring_params params {};
+    queue->m_ring_file_descriptor = static_cast<int>(syscall(__NR_io_uring_setup, entry_count, &params));
+
+    if(queue->m_ring_file_descriptor < 0)
+    {
+        const std::string error_message = std::string(queue->CLASS_NAME) + "::" + __func__ + "() -> Failed to set up io_uring! Error code: {" + std::to_string(errno) +"}";
+        perror(error_message.c_str());
+        return nullptr;
+    }
+
+    if(not queue->Map(params))
+    {
+        return nullptr;
+    }
+
+    return queue;
+}
+
+bool IoUringQueue::Map(const io_uring_params& params)
+{
+    m_submission_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    m_completion_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+    // Since Linux 5.4 both rings share a single mapping
+    const bool is_single_mapping = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+
+    if(is_single_mapping)
+    {
+        m_submission_ring_size = std::max(m_submission_ring_size, m_completion_ring_size);
+        m_completion_ring_size = m_submission_ring_size;
+    }
+
+    m_submission_ring = mmap(nullptr, m_submission_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring_file_descriptor, IORING_OFF_SQ_RING);
+
+    if(m_submission_ring == MAP_FAILED)
+    {
+        m_submission_ring = nullptr;
+        return false;
+    }
+
+    if(is_single_mapping)
+    {
+        m_completion_ring = m_submission_ring;
+    }
+    else
+    {
+        m_completion_ring = mmap(nullptr, m_completion_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring_file_descriptor, IORING_OFF_CQ_RING);
+
+        if(m_completion_ring == MAP_FAILED)
+        {
+            m_completion_ring = nullptr;
+            return false;
+        }
+    }
+
+    m_submission_entries_size = params.sq_entries * sizeof(io_uring_sqe);
+    void* submission_entries = mmap(nullptr, m_submission_entries_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring_file_descriptor, IORING_OFF_SQES);
+
+    if(submission_entries == MAP_FAILED)
+    {
+        return false;
+    }
+
+    m_submission_entries = static_cast<io_uring_sqe*>(submission_entries);
+
+    char* submission_ring = static_cast<char*>(m_submission_ring);
+    m_submission_head = reinterpret_cast<unsigned*>(submission_ring + params.sq_off.head);
+    m_submission_tail = reinterpret_cast<unsigned*>(submission_ring + params.sq_off.tail);
+    m_submission_array = reinterpret_cast<unsigned*>(submission_ring + params.sq_off.array);
+    m_submission_mask = *reinterpret_cast<unsigned*>(submission_ring + params.sq_off.ring_mask);
+    m_submission_entry_count = params.sq_entries;
+    m_prepared_tail = *m_submission_tail;
+    m_published_tail = m_prepared_tail;
+
+    char* completion_ring = static_cast<char*>(m_completion_ring);
+    m_completion_head = reinterpret_cast<unsigned*>(completion_ring + params.cq_off.head);
+    m_completion_tail = reinterpret_cast<unsigned*>(completion_ring + params.cq_off.tail);
+    m_completions = reinterpret_cast<io_uring_cqe*>(completion_ring + params.cq_off.cqes);
+    m_completion_mask = *reinterpret_cast<unsigned*>(completion_ring + params.cq_off.ring_mask);
+
+    return true;
+}
+
+io_uring_sqe* IoUringQueue::GetSubmissionEntry()
+{
+    const unsigned head = std::atomic_ref<unsigned>(*m_submission_head).load(std::memory_order_acquire);
+
+    if(m_prepared_tail - head == m_submission_entry_count)
+    {
+        // Hand the prepared entries to the kernel to make room, without waiting for completions
+        Enter(m_prepared_tail - m_published_tail, 0, 0);
+    }
+
+    const unsigned index = m_prepared_tail & m_submission_mask;
+    io_uring_sqe* submission_entry = &m_submission_entries[index];
+
+    std::memset(submission_entry, 0, sizeof(io_uring_sqe));
+    m_submission_array[index] = index;
+    ++m_prepared_tail;
+
+    return submission_entry;
+}
+
+int IoUringQueue::SubmitAndWait()
+{
+    const unsigned wait_count = HasCompletions() ? 0 : 1;
+
+    return Enter(m_prepared_tail - m_published_tail, wait_count, wait_count > 0 ? IORING_ENTER_GETEVENTS : 0);
+}
+
+bool IoUringQueue::HasCompletions() const
+{
+    return *m_completion_head != std::atomic_ref<unsigned>(*m_completion_tail).load(std::memory_order_acquire);
+}
+
+int IoUringQueue::Enter(unsigned submit_count, unsigned wait_count, unsigned flags)
+{
+    // Publishing the tail makes the prepared entries (and their array slots) visible to the kernel
+    std::atomic_ref<unsigned>(*m_submission_tail).store(m_prepared_tail, std::memory_order_release);
+    m_published_tail = m_prepared_tail;
+
+    const int result = static_cast<int>(syscall(__NR_io_uring_enter, m_ring_file_descriptor, submit_count, wait_count, flags, nullptr, 0));
+
+    return result < 0 ? -errno : result;
+}
+
+} // namespace InterProcessCommunication
+
+#endif // APPLICATION_CLIENT_IO_URING
@@ -0,0 +1,98 @@
+#pragma once
+
+#ifdef APPLICATION_CLIENT_IO_URING
+
+#include <linux/io_uring.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace InterProcessCommunication
+{
+
+/*
+    \brief A thin wrapper around an io_uring submission and completion queue pair, driven through the raw system calls.
+        It is not thread-safe: entries must be prepared, submitted and reaped by one thread (a ClientReactor event loop).
+*/
+class IoUringQueue
+{
+public:
+
+    IoUringQueue(const IoUringQueue&) = delete;
+    IoUringQueue& operator=(const IoUringQueue&) = delete;
+    IoUringQueue(IoUringQueue&&) = delete;
+    IoUringQueue& operator=(IoUringQueue&&) = delete;
+    ~IoUringQueue();
+
+    /*
+        \brief This function sets up a ring with room for entry_count submissions. It returns nullptr if the kernel does not support io_uring or refuses the setup.
+    */
+    static std::unique_ptr<IoUringQueue> Create(unsigned entry_count);
+
+    /*
+        \brief This function returns a zeroed submission entry, submitting the prepared entries first if the submission queue is full
+    */
+    io_uring_sqe* GetSubmissionEntry();
+    /*
+        \brief This function submits every prepared entry and, if no completion is ready yet, waits for at least one. It returns a negative errno on failure.
+    */
+    int SubmitAndWait();
+
+    /*
+        \brief This function passes every ready completion to the callback and then releases them to the kernel. The callback may prepare new submissions.
+    */
+    template <typename Callback>
+    size_t DrainCompletions(Callback&& callback)
+    {
+        const unsigned head = *m_completion_head;
+        const unsigned tail = std::atomic_ref<unsigned>(*m_completion_tail).load(std::memory_order_acquire);
+
+        for(unsigned index = head; index != tail; ++index)
+        {
+            callback(m_completions[index & m_completion_mask]);
+        }
+
+        std::atomic_ref<unsigned>(*m_completion_head).store(tail, std::memory_order_release);
+
+        return tail - head;
+    }
+
+private:
+
+    const std::string_view CLASS_NAME = "IoUringQueue";
+
+    IoUringQueue() = default;
+
+    bool Map(const io_uring_params& params);
+    bool HasCompletions() const;
+    int Enter(unsigned submit_count, unsigned wait_count, unsigned flags);
+
+    int m_ring_file_descriptor { -1 };
+
+    void* m_submission_ring { nullptr };
+    size_t m_submission_ring_size { 0 };
+    void* m_completion_ring { nullptr };
+    size_t m_completion_ring_size { 0 };
+    io_uring_sqe* m_submission_entries { nullptr };
+    size_t m_submission_entries_size { 0 };
+
+    unsigned* m_submission_head { nullptr };
+    unsigned* m_submission_tail { nullptr };
+    unsigned* m_submission_array { nullptr };
+    unsigned m_submission_mask { 0 };
+    unsigned m_submission_entry_count { 0 };
+    // Entries are prepared locally and only become visible to the kernel when the tail is published on submit
+    unsigned m_prepared_tail { 0 };
+    unsigned m_published_tail { 0 };
+
+    unsigned* m_completion_head { nullptr };
+    unsigned* m_completion_tail { nullptr };
+    io_uring_cqe* m_completions { nullptr };
+    unsigned m_completion_mask { 0 };
+};
+
+} // namespace InterProcessCommunication
+
+#endif // APPLICATION_CLIENT_IO_URING
@@ -0,0 +1,227 @@
+#include "memfd_payload.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <utility>
+
+namespace InterProcessCommunication
+{
+namespace
+{
+
+// The seals that make a memfd safe to map: its bytes can not change and it can not shrink below a peer's mapping, which would fault on the missing pages
+constexpr int REQUIRED_MEMFD_SEALS = F_SEAL_WRITE | F_SEAL_SHRINK;
+
+} // namespace
+
+MemfdPayload::MemfdPayload(MemfdPayload&& other) noexcept
+: m_file_descriptor(std::exchange(other.m_file_descriptor, -1))
+, m_size(std::exchange(other.m_size, 0))
+, m_mapping(std::exchange(other.m_mapping, nullptr))
+, m_is_sealed(std::exchange(other.m_is_sealed, false))
+{
+}
+
+MemfdPayload& MemfdPayload::operator=(MemfdPayload&& other) noexcept
+{
+    if(this != &other)
+    {
+        Reset();
+        m_file_descriptor = std::exchange(other.m_file_descriptor, -1);
+        m_size = std::exchange(other.m_size, 0);
+        m_mapping = std::exchange(other.m_mapping, nullptr);
+        m_is_sealed = std::exchange(other.m_is_sealed, false);
+    }
+
+    return *this;
+}
+
+MemfdPayload::~MemfdPayload()
+{
+    Reset();
+}
+
+MemfdPayload::MemfdPayload(int file_descriptor, size_t size)
+: m_file_descriptor(file_descriptor)
+, m_size(size)
+{
+}
+
+std::optional<MemfdPayload> MemfdPayload::Create(size_t size)
+{
+    const int file_descriptor = memfd_create("application_client_payload", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+
+    if(file_descriptor < 0)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to create memfd!";
+        perror(error_message.c_str());
+        return std::nullopt;
+    }
+
+    // Owned from here on, so that every failure below closes the descriptor
+    MemfdPayload payload(file_descriptor, size);
+
+    if(ftruncate(file_descriptor, static_cast<off_t>(size)) != 0)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to size memfd!";
+        perror(error_message.c_str());
+        return std::nullopt;
+    }
+
+    if(size > 0)
+    {
+        // The pages are allocated up front in one go, rather than one fault at a time as the caller writes the payload
+        void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, file_descriptor, 0);
+
+        if(mapping == MAP_FAILED)
+        {
+            const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to map memfd!";
+            perror(error_message.c_str());
+            return std::nullopt;
+        }
+
+        payload.m_mapping = static_cast<char*>(mapping);
+    }
+
+    return payload;
+}
+
+std::optional<MemfdPayload> MemfdPayload::CreateSealed(std::span<const char> bytes)
+{
+    const int file_descriptor = memfd_create("application_client_payload", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+
+    if(file_descriptor < 0)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to create memfd!";
+        perror(error_message.c_str());
+        return std::nullopt;
+    }
+
+    MemfdPayload payload(file_descriptor, bytes.size());
+
+    // A write lets the kernel copy straight into the memfd's pages, without faulting them in through a mapping first
+    while(not bytes.empty())
+    {
+        const ssize_t written_bytes = write(file_descriptor, bytes.data(), bytes.size());
+
+        if(written_bytes < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+
+            const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to write memfd!";
+            perror(error_message.c_str());
+            return std::nullopt;
+        }
+
+        bytes = bytes.subspan(written_bytes);
+    }
+
+    if(not payload.Seal())
+    {
+        return std::nullopt;
+    }
+
+    return payload;
+}
+
+std::span<char> MemfdPayload::GetBytes() const
+{
+    return m_mapping != nullptr ? std::span<char>(m_mapping, m_size) : std::span<char>();
+}
+
+size_t MemfdPayload::GetSize() const
+{
+    return m_size;
+}
+
+int MemfdPayload::GetFileDescriptor() const
+{
+    return m_file_descriptor;
+}
+
+bool MemfdPayload::IsSealed() const
+{
+    return m_is_sealed;
+}
+
+bool MemfdPayload::Seal()
+{
+    if(m_is_sealed)
+    {
+        return true;
+    }
+
+    // The kernel refuses F_SEAL_WRITE while a writable shared mapping exists
+    if(m_mapping != nullptr)
+    {
+        munmap(m_mapping, m_size);
+        m_mapping = nullptr;
+    }
+
+    if(fcntl(m_file_descriptor, F_ADD_SEALS, REQUIRED_MEMFD_SEALS | F_SEAL_GROW | F_SEAL_SEAL) != 0)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to seal memfd!";
+        perror(error_message.c_str());
+        return false;
+    }
+
+    m_is_sealed = true;
+
+    return true;
+}
+
+void MemfdPayload::Reset()
+{
+    if(m_mapping != nullptr)
+    {
+        munmap(m_mapping, m_size);
+        m_mapping = nullptr;
+    }
+
+    if(m_file_descriptor >= 0)
+    {
+        close(m_file_descriptor);
+        m_file_descriptor = -1;
+    }
+}
+
+RxBufferRef MapSealedMemfd(int file_descriptor, RxBufferPool& rx_buffer_pool)
+{
+    const int seals = fcntl(file_descriptor, F_GET_SEALS);
+
+    if(seals < 0 || (seals & REQUIRED_MEMFD_SEALS) != REQUIRED_MEMFD_SEALS)
+    {
+        std::cerr << std::string(__func__) + "() -> Received a memfd that is not sealed!\n";
+        return RxBufferRef();
+    }
+
+    struct stat memfd_status {};
+
+    if(fstat(file_descriptor, &memfd_status) != 0 || memfd_status.st_size <= 0)
+    {
+        std::cerr << std::string(__func__) + "() -> Received an empty memfd!\n";
+        return RxBufferRef();
+    }
+
+    const size_t size = static_cast<size_t>(memfd_status.st_size);
+    void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file_descriptor, 0);
+
+    if(mapping == MAP_FAILED)
+    {
+        const std::string error_message = std::string(__func__) + "() -> Failed to map memfd!";
+        perror(error_message.c_str());
+        return RxBufferRef();
+    }
+
+    return rx_buffer_pool.AdoptMapping(static_cast<char*>(mapping), size);
+}
+
+} // namespace InterProcessCommunication
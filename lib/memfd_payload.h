@@ -0,0 +1,71 @@
+#pragma once
+
+#include "rx_buffer_pool.h"
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace InterProcessCommunication
+{
+
+/*
+    \brief A payload held in a memfd, which a client passes over a unix domain socket as a descriptor instead of copying its bytes through the socket (see MemfdTransferOptions).
+        Create() maps a fresh memfd for the caller to write the payload into, so that enqueueing it sends the payload without the client copying it at all.
+        Enqueueing seals the memfd, after which neither side can change its bytes or its size.
+*/
+class MemfdPayload
+{
+public:
+
+    MemfdPayload(const MemfdPayload&) = delete;
+    MemfdPayload& operator=(const MemfdPayload&) = delete;
+    MemfdPayload(MemfdPayload&& other) noexcept;
+    MemfdPayload& operator=(MemfdPayload&& other) noexcept;
+    ~MemfdPayload();
+
+    /*
+        \brief This function creates a memfd of size bytes and maps it for the caller to write into. It returns std::nullopt if the memfd can not be created or mapped.
+    */
+    static std::optional<MemfdPayload> Create(size_t size);
+    /*
+        \brief This function creates a sealed memfd holding a copy of bytes. The copy is written without mapping the memfd.
+    */
+    static std::optional<MemfdPayload> CreateSealed(std::span<const char> bytes);
+
+    /*
+        \brief This function returns the writable mapping of the payload, which is empty once the payload is sealed
+    */
+    std::span<char> GetBytes() const;
+    size_t GetSize() const;
+    int GetFileDescriptor() const;
+    bool IsSealed() const;
+    /*
+        \brief This function unmaps the payload and seals the memfd against writing, growing and shrinking, so that the peer can map it without the bytes changing underneath.
+            It fails if the caller still holds a writable mapping of the memfd of its own.
+    */
+    bool Seal();
+
+private:
+
+    static constexpr std::string_view CLASS_NAME = "MemfdPayload";
+
+    MemfdPayload(int file_descriptor, size_t size);
+
+    void Reset();
+
+    int m_file_descriptor { -1 };
+    size_t m_size { 0 };
+    char* m_mapping { nullptr };
+    bool m_is_sealed { false };
+};
+
+/*
+    \brief This function maps a sealed memfd received from a peer into a buffer handed out by the pool, which unmaps it once the last reference is released.
+        The mapping is private, so a callback that writes to the bytes only changes its own copy of the pages it writes to.
+        It returns an empty reference if the memfd is not sealed against writing and shrinking, since the peer could otherwise change or truncate the mapped bytes.
+        The caller keeps the descriptor, which may be closed as soon as this function returns.
+*/
+RxBufferRef MapSealedMemfd(int file_descriptor, RxBufferPool& rx_buffer_pool);
+
+} // namespace InterProcessCommunication
@@ -0,0 +1,226 @@
+#include "message_framing.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace InterProcessCommunication
+{
+uint64_t GetMaxFramePayloadSize(const FramingOptions& options)
+{
+    const size_t header_size = static_cast<size_t>(options.header_size);
+    const uint64_t max_header_value = header_size == sizeof(uint64_t) ? std::numeric_limits<uint64_t>::max() : (uint64_t { 1 } << (header_size * 8)) - 1;
+
+    return std::min<uint64_t>(options.max_frame_size, max_header_value);
+}
+
+size_t EncodeFrameHeader(const FramingOptions& options, uint64_t payload_size, FrameHeader& header)
+{
+    const size_t header_size = static_cast<size_t>(options.header_size);
+
+    for(size_t index = 0; index < header_size; ++index)
+    {
+        const size_t byte_index = options.byte_order == std::endian::big ? header_size - 1 - index : index;
+        header[byte_index] = static_cast<char>((payload_size >> (index * 8)) & 0xFF);
+    }
+
+    return header_size;
+}
+
+uint64_t DecodeFrameHeader(const FramingOptions& options, const FrameHeader& header)
+{
+    const size_t header_size = static_cast<size_t>(options.header_size);
+    uint64_t payload_size = 0;
+
+    for(size_t index = 0; index < header_size; ++index)
+    {
+        const size_t byte_index = options.byte_order == std::endian::big ? header_size - 1 - index : index;
+        payload_size |= static_cast<uint64_t>(static_cast<unsigned char>(header[byte_index])) << (index * 8);
+    }
+
+    return payload_size;
+}
+
+uint64_t GetMemfdFrameFlag(const FramingOptions& options)
+{
+    return uint64_t { 1 } << (static_cast<size_t>(options.header_size) * 8 - 1);
+}
+
+size_t EncodeChunkHeader(size_t lane, bool is_message_end, uint32_t chunk_size, FrameHeader& header)
+{
+    header[0] = static_cast<char>(lane);
+    header[1] = static_cast<char>(is_message_end ? CHUNK_FLAG_MESSAGE_END : 0);
+
+    for(size_t index = 0; index < sizeof(uint32_t); ++index)
+    {
+        header[CHUNK_HEADER_SIZE - 1 - index] = static_cast<char>((chunk_size >> (index * 8)) & 0xFF);
+    }
+
+    return CHUNK_HEADER_SIZE;
+}
+
+FrameDecoder::FrameDecoder(const FramingOptions& options, std::shared_ptr<RxBufferPool> rx_buffer_pool, FrameCallback frame_callback, MemfdFrameCallback memfd_frame_callback)
+: m_options(options)
+, m_header_size(static_cast<size_t>(options.header_size))
+, m_max_frame_size(GetMaxFramePayloadSize(options))
+, m_rx_buffer_pool(std::move(rx_buffer_pool))
+, m_frame_callback(std::move(frame_callback))
+, m_memfd_frame_callback(std::move(memfd_frame_callback))
+, m_memfd_frame_flag(GetMemfdFrameFlag(options))
+{
+}
+
+bool FrameDecoder::Decode(const RxBufferRef& rx_buffer, std::span<char> rx_bytes)
+{
+    while(not rx_bytes.empty())
+    {
+        if(m_received_header_bytes < m_header_size)
+        {
+            const size_t header_bytes = std::min(m_header_size - m_received_header_bytes, rx_bytes.size());
+            std::memcpy(m_header.data() + m_received_header_bytes, rx_bytes.data(), header_bytes);
+            m_received_header_bytes += header_bytes;
+            rx_bytes = rx_bytes.subspan(header_bytes);
+
+            if(m_received_header_bytes < m_header_size)
+            {
+                return true;
+            }
+
+            m_frame_size = DecodeFrameHeader(m_options, m_header);
+
+            if(m_memfd_frame_callback && (m_frame_size & m_memfd_frame_flag) != 0)
+            {
+                m_received_header_bytes = 0;
+
+                // The descriptor travelled alongside the stream, so a memfd frame with a length of its own is not one this side understands
+                if(m_frame_size != m_memfd_frame_flag || not m_memfd_frame_callback())
+                {
+                    return false;
+                }
+
+                continue;
+            }
+
+            if(m_frame_size > m_max_frame_size)
+            {
+                return false;
+            }
+
+            // The whole frame is in this read, so it is handed out without being copied
+            if(rx_bytes.size() >= m_frame_size)
+            {
+                m_received_header_bytes = 0;
+                m_frame_callback(rx_buffer, rx_bytes.first(m_frame_size));
+                rx_bytes = rx_bytes.subspan(m_frame_size);
+                continue;
+            }
+
+            m_frame_buffer = m_rx_buffer_pool->Acquire(m_frame_size);
+            m_received_frame_bytes = 0;
+        }
+
+        const size_t frame_bytes = std::min<uint64_t>(m_frame_size - m_received_frame_bytes, rx_bytes.size());
+        std::memcpy(m_frame_buffer.GetData() + m_received_frame_bytes, rx_bytes.data(), frame_bytes);
+        m_received_frame_bytes += frame_bytes;
+        rx_bytes = rx_bytes.subspan(frame_bytes);
+
+        if(m_received_frame_bytes == m_frame_size)
+        {
+            // Moving the buffer out releases the decoder's reference once the callback returns, unless the callback retained it
+            const RxBufferRef frame_buffer = std::move(m_frame_buffer);
+            m_received_header_bytes = 0;
+            m_frame_callback(frame_buffer, std::span<char>(frame_buffer.GetData(), m_frame_size));
+        }
+    }
+
+    return true;
+}
+
+void FrameDecoder::Reset()
+{
+    m_received_header_bytes = 0;
+    m_frame_size = 0;
+    m_frame_buffer = RxBufferRef();
+    m_received_frame_bytes = 0;
+}
+
+ChunkDecoder::ChunkDecoder(MessageCallback message_callback)
+: m_message_callback(std::move(message_callback))
+{
+}
+
+void ChunkDecoder::Decode(std::span<char> rx_bytes)
+{
+    while(not rx_bytes.empty())
+    {
+        if(m_received_header_bytes < CHUNK_HEADER_SIZE)
+        {
+            const size_t header_bytes = std::min(CHUNK_HEADER_SIZE - m_received_header_bytes, rx_bytes.size());
+            std::memcpy(m_header.data() + m_received_header_bytes, rx_bytes.data(), header_bytes);
+            m_received_header_bytes += header_bytes;
+            rx_bytes = rx_bytes.subspan(header_bytes);
+
+            if(m_received_header_bytes < CHUNK_HEADER_SIZE)
+            {
+                return;
+            }
+
+            m_chunk_lane = static_cast<unsigned char>(m_header[0]);
+            m_is_message_end = (static_cast<unsigned char>(m_header[1]) & CHUNK_FLAG_MESSAGE_END) != 0;
+            m_remaining_chunk_bytes = 0;
+
+            for(size_t index = 2; index < CHUNK_HEADER_SIZE; ++index)
+            {
+                m_remaining_chunk_bytes = (m_remaining_chunk_bytes << 8) | static_cast<unsigned char>(m_header[index]);
+            }
+
+            // A whole message in a single chunk within this read is handed out without being copied
+            if(m_is_message_end && m_lane_messages[m_chunk_lane].empty() && rx_bytes.size() >= m_remaining_chunk_bytes)
+            {
+                const std::span<char> message = rx_bytes.first(m_remaining_chunk_bytes);
+                rx_bytes = rx_bytes.subspan(m_remaining_chunk_bytes);
+                m_received_header_bytes = 0;
+                m_message_callback(m_chunk_lane, message);
+                continue;
+            }
+        }
+
+        const size_t chunk_bytes = std::min<size_t>(m_remaining_chunk_bytes, rx_bytes.size());
+        std::vector<char>& lane_message = m_lane_messages[m_chunk_lane];
+        lane_message.insert(lane_message.end(), rx_bytes.begin(), rx_bytes.begin() + chunk_bytes);
+        m_remaining_chunk_bytes -= chunk_bytes;
+        rx_bytes = rx_bytes.subspan(chunk_bytes);
+
+        if(m_remaining_chunk_bytes == 0)
+        {
+            CompleteChunk();
+        }
+    }
+}
+
+void ChunkDecoder::CompleteChunk()
+{
+    m_received_header_bytes = 0;
+
+    if(not m_is_message_end)
+    {
+        return;
+    }
+
+    // Moved out first, so that the lane can collect its next message even if the callback decodes more bytes
+    std::vector<char> message = std::move(m_lane_messages[m_chunk_lane]);
+    m_lane_messages[m_chunk_lane].clear();
+    m_message_callback(m_chunk_lane, message);
+}
+
+void ChunkDecoder::Reset()
+{
+    m_received_header_bytes = 0;
+    m_remaining_chunk_bytes = 0;
+
+    for(std::vector<char>& lane_message : m_lane_messages)
+    {
+        lane_message.clear();
+    }
+}
+
+} // namespace InterProcessCommunication
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "client_options.h"
+#include "rx_buffer_pool.h"
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace InterProcessCommunication
+{
+
+static constexpr size_t MAX_FRAME_HEADER_SIZE { 8 };
+
+using FrameHeader = std::array<char, MAX_FRAME_HEADER_SIZE>;
+
+/*
+    \brief This function returns the largest payload that a frame can carry, which is bounded by both max_frame_size and the width of the header
+*/
+uint64_t GetMaxFramePayloadSize(const FramingOptions& options);
+/*
+    \brief This function writes the length header for a payload of payload_size bytes and returns the number of header bytes written
+*/
+size_t EncodeFrameHeader(const FramingOptions& options, uint64_t payload_size, FrameHeader& header);
+uint64_t DecodeFrameHeader(const FramingOptions& options, const FrameHeader& header);
+/*
+    \brief This function returns the top bit of the header's length field, which marks a frame that carries a memfd instead of bytes (see MemfdTransferOptions)
+*/
+uint64_t GetMemfdFrameFlag(const FramingOptions& options);
+
+// A chunk header holds the lane (1 byte), flags (1 byte) and the chunk's length (4 bytes, big endian)
+static constexpr size_t CHUNK_HEADER_SIZE { 6 };
+static constexpr uint8_t CHUNK_FLAG_MESSAGE_END { 0x01 };
+static constexpr size_t MAX_TX_LANES { 256 };
+static constexpr size_t MAX_CHUNK_SIZE { UINT32_MAX };
+
+/*
+    \brief This function writes the header of a chunk of chunk_size bytes on the given lane (see TxLaneOptions) and returns the number of header bytes written
+*/
+size_t EncodeChunkHeader(size_t lane, bool is_message_end, uint32_t chunk_size, FrameHeader& header);
+
+/*
+    \brief Splits a received byte stream into length-prefixed frames.
+        A frame that lies entirely within one read is handed out as a view into that read's buffer. Only a frame that straddles reads is copied,
+        into a buffer of its own from the RX buffer pool.
+*/
+class FrameDecoder
+{
+public:
+
+    using FrameCallback = std::function<void(const RxBufferRef& frame_buffer, const std::span<char>& frame)>;
+    // Invoked for every memfd frame, which has no bytes of its own. It returns false if the memfd can not be delivered.
+    using MemfdFrameCallback = std::function<bool()>;
+
+    /*
+        \brief Without a memfd frame callback, the top bit of the length field is not treated specially and a frame that sets it is merely oversized
+    */
+    FrameDecoder(const FramingOptions& options, std::shared_ptr<RxBufferPool> rx_buffer_pool, FrameCallback frame_callback, MemfdFrameCallback memfd_frame_callback = nullptr);
+
+    /*
+        \brief This function delivers every frame that is completed by rx_bytes, which must lie within rx_buffer.
+            It returns false if a frame exceeds the maximum frame size or a memfd frame fails, after which the stream cannot be decoded any further.
+    */
+    bool Decode(const RxBufferRef& rx_buffer, std::span<char> rx_bytes);
+    /*
+        \brief This function discards a partially received frame, for example when the connection is replaced
+    */
+    void Reset();
+
+private:
+
+    const FramingOptions m_options;
+    const size_t m_header_size;
+    const uint64_t m_max_frame_size;
+    const std::shared_ptr<RxBufferPool> m_rx_buffer_pool;
+    const FrameCallback m_frame_callback;
+    const MemfdFrameCallback m_memfd_frame_callback;
+    const uint64_t m_memfd_frame_flag;
+
+    FrameHeader m_header {};
+    size_t m_received_header_bytes { 0 };
+    uint64_t m_frame_size { 0 };
+    // Only holds a buffer while a frame that straddles reads is being reassembled
+    RxBufferRef m_frame_buffer;
+    size_t m_received_frame_bytes { 0 };
+};
+
+/*
+    \brief Reassembles the payloads sent on TX lanes (see TxLaneOptions) from a received byte stream, for the peer of a client that uses lanes.
+        The chunks of different lanes may interleave, and every lane collects its chunks until the one that ends its message.
+        A message that arrives as a single chunk within one read is handed out as a view into that read, anything else is copied into its lane's buffer.
+*/
+class ChunkDecoder
+{
+public:
+
+    using MessageCallback = std::function<void(size_t lane, const std::span<char>& message)>;
+
+    explicit ChunkDecoder(MessageCallback message_callback);
+
+    void Decode(std::span<char> rx_bytes);
+    /*
+        \brief This function discards every partially received message, for example when the connection is replaced
+    */
+    void Reset();
+
+private:
+
+    const MessageCallback m_message_callback;
+
+    FrameHeader m_header {};
+    size_t m_received_header_bytes { 0 };
+    size_t m_chunk_lane { 0 };
+    bool m_is_message_end { false };
+    uint32_t m_remaining_chunk_bytes { 0 };
+    std::vector<std::vector<char>> m_lane_messages = std::vector<std::vector<char>>(MAX_TX_LANES);
+
+    void CompleteChunk();
+};
+
+} // namespace InterProcessCommunication
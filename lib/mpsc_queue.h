@@ -0,0 +1,88 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+namespace InterProcessCommunication
+{
+
+/*
+    \brief An unbounded, lock-free multi-producer single-consumer FIFO queue (Vyukov's linked list queue with a stub node).
+        Push() is wait-free and may be called from any thread. Pop() and IsEmpty() must only be called from the single consumer thread.
+        A Pop() that races with an unfinished Push() may report the queue as empty, so producers must signal the consumer after pushing.
+*/
+template <typename T>
+class MpscQueue
+{
+public:
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+    MpscQueue(MpscQueue&&) = delete;
+    MpscQueue& operator=(MpscQueue&&) = delete;
+
+    MpscQueue()
+    : m_head(new Node())
+    , m_tail(m_head.load(std::memory_order_relaxed))
+    {
+    }
+
+    ~MpscQueue()
+    {
+        while(m_tail != nullptr)
+        {
+            Node* next = m_tail->next.load(std::memory_order_relaxed);
+            delete m_tail;
+            m_tail = next;
+        }
+    }
+
+    void Push(T&& value)
+    {
+        Node* node = new Node();
+        node->value.emplace(std::move(value));
+
+        // Publishing the node is a single exchange, after which the previous head is linked to it
+        Node* previous_head = m_head.exchange(node, std::memory_order_acq_rel);
+        previous_head->next.store(node, std::memory_order_release);
+    }
+
+    std::optional<T> Pop()
+    {
+        Node* next = m_tail->next.load(std::memory_order_acquire);
+
+        if(next == nullptr)
+        {
+            return std::nullopt;
+        }
+
+        // The popped node becomes the new stub, so only its value is moved out
+        std::optional<T> value = std::move(next->value);
+        next->value.reset();
+
+        delete m_tail;
+        m_tail = next;
+
+        return value;
+    }
+
+    bool IsEmpty() const
+    {
+        return m_tail->next.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+
+    struct Node
+    {
+        std::atomic<Node*> next { nullptr };
+        std::optional<T> value;
+    };
+
+    // Producers and the consumer touch opposite ends, so keep them on separate cache lines
+    alignas(64) std::atomic<Node*> m_head;
+    alignas(64) Node* m_tail;
+};
+
+} // namespace InterProcessCommunication
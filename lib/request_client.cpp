@@ -0,0 +1,392 @@
+#include "request_client.h"
+#include "message_framing.h"
+#include <bit>
+#include <cstring>
+#include <iostream>
+
+namespace InterProcessCommunication
+{
+RequestClient::~RequestClient()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_pending_requests_mutex);
+        m_running = false;
+    }
+
+    m_deadline_condition.notify_all();
+    m_timeout_thread.join();
+
+    // The client reports its queued requests as not sent on the way out, and whatever is left afterwards never gets a reply
+    m_client.reset();
+    CancelPendingRequests();
+}
+
+RequestClient::RequestClient(const std::string& ipv4_address, uint16_t port, const ClientOptions& client_options, const RequestClientOptions& options)
+: RequestClient(std::make_unique<ApplicationClient>(ipv4_address, port, EnableFraming(client_options)), client_options, options)
+{
+}
+
+RequestClient::RequestClient(const std::string& unix_socket_path, const ClientOptions& client_options, const RequestClientOptions& options)
+: RequestClient(std::make_unique<ApplicationClient>(unix_socket_path, EnableFraming(client_options)), client_options, options)
+{
+}
+
+RequestClient::RequestClient(std::unique_ptr<ApplicationClient> client, const ClientOptions& client_options, const RequestClientOptions& options)
+: m_options(options)
+, m_correlation_id_options{.enabled = true, .header_size = FrameHeaderSize::EIGHT_BYTES, .byte_order = client_options.framing.byte_order}
+, m_pending_requests(std::bit_ceil(std::max<size_t>(2, options.max_pending_requests * 2)))
+, m_slot_mask(m_pending_requests.size() - 1)
+, m_client(std::move(client))
+{
+    m_request_deadlines.reserve(m_options.max_pending_requests);
+    m_expired_requests.reserve(m_options.max_pending_requests);
+
+    m_client->SetRxBufferCallback([this](const RxBufferRef& rx_buffer, const std::span<char>& frame)
+    {
+        OnReply(rx_buffer, frame);
+    });
+
+    // A reconnecting client replays the requests that were still queued, and their replies may yet arrive. Without reconnecting, none of them will.
+    if(not client_options.reconnect.enabled)
+    {
+        m_client->SetDisconnectedCallback([this]()
+        {
+            CancelPendingRequests();
+        });
+    }
+
+    m_timeout_thread = std::thread(&RequestClient::ExpireRequests, this);
+}
+
+ApplicationClient& RequestClient::GetClient()
+{
+    return *m_client;
+}
+
+std::future<RequestReply> RequestClient::SendRequest(std::span<const char> body, std::optional<std::chrono::milliseconds> timeout)
+{
+    // The callback has to be copyable, so the promise is shared with it
+    const std::shared_ptr<std::promise<RequestReply>> reply_promise = std::make_shared<std::promise<RequestReply>>();
+    std::future<RequestReply> reply_future = reply_promise->get_future();
+
+    const bool is_sent = SendRequest(body, [reply_promise](RequestReply&& reply)
+    {
+        reply_promise->set_value(std::move(reply));
+    }, timeout);
+
+    if(not is_sent)
+    {
+        reply_promise->set_value(RequestReply {.status = RequestStatus::NOT_SENT});
+    }
+
+    return reply_future;
+}
+
+bool RequestClient::SendRequest(std::span<const char> body, ReplyCallback callback, std::optional<std::chrono::milliseconds> timeout)
+{
+    // Registered ahead of sending, since the reply may arrive before EnqueuePayload() returns
+    const std::optional<uint64_t> correlation_id = RegisterRequest(std::move(callback), timeout.value_or(m_options.default_timeout));
+
+    if(not correlation_id.has_value())
+    {
+        return false;
+    }
+
+    std::vector<char> tx_bytes(CORRELATION_ID_SIZE + body.size());
+    FrameHeader encoded_correlation_id {};
+
+    EncodeFrameHeader(m_correlation_id_options, correlation_id.value(), encoded_correlation_id);
+    std::memcpy(tx_bytes.data(), encoded_correlation_id.data(), CORRELATION_ID_SIZE);
+    std::memcpy(tx_bytes.data() + CORRELATION_ID_SIZE, body.data(), body.size());
+
+    const bool is_enqueued = m_client->EnqueuePayload(std::move(tx_bytes), [this, correlation_id = correlation_id.value()](bool is_sent)
+    {
+        if(not is_sent)
+        {
+            CompleteRequest(correlation_id, RequestReply {.status = RequestStatus::NOT_SENT});
+        }
+    });
+
+    if(not is_enqueued)
+    {
+        // The request is only handed back to the caller if no reply or timeout got to it first, so the callback is either called or rejected, never both
+        return not TakeRequest(correlation_id.value()).has_value();
+    }
+
+    return true;
+}
+
+void RequestClient::CancelPendingRequests()
+{
+    std::vector<PendingRequest> cancelled_requests;
+
+    {
+        std::lock_guard<std::mutex> lock(m_pending_requests_mutex);
+
+        for(PendingRequest& pending_request : m_pending_requests)
+        {
+            if(pending_request.correlation_id != 0)
+            {
+                cancelled_requests.emplace_back(std::move(pending_request));
+                pending_request = PendingRequest {};
+            }
+        }
+
+        m_pending_request_count = 0;
+        m_request_deadlines.clear();
+    }
+
+    for(PendingRequest& cancelled_request : cancelled_requests)
+    {
+        cancelled_request.callback(RequestReply {.status = RequestStatus::CANCELLED});
+    }
+}
+
+size_t RequestClient::GetPendingRequestCount() const
+{
+    std::lock_guard<std::mutex> lock(m_pending_requests_mutex);
+    return m_pending_request_count;
+}
+
+ClientOptions RequestClient::EnableFraming(ClientOptions client_options)
+{
+    client_options.framing.enabled = true;
+    return client_options;
+}
+
+std::optional<uint64_t> RequestClient::RegisterRequest(ReplyCallback&& callback, std::chrono::milliseconds timeout)
+{
+    const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + timeout;
+
+    std::unique_lock<std::mutex> lock(m_pending_requests_mutex);
+
+    if(m_pending_request_count >= m_options.max_pending_requests)
+    {
+        return std::nullopt;
+    }
+
+    const uint64_t correlation_id = m_next_correlation_id++;
+    size_t slot_index = correlation_id & m_slot_mask;
+
+    // Linear probing always finds a free slot, since at most half of the slots are taken
+    while(m_pending_requests[slot_index].correlation_id != 0)
+    {
+        slot_index = (slot_index + 1) & m_slot_mask;
+    }
+
+    m_pending_requests[slot_index] = PendingRequest {.correlation_id = correlation_id, .deadline_index = 0, .callback = std::move(callback)};
+    ++m_pending_request_count;
+
+    // The timeout thread only needs waking when it sleeps past the new deadline, which with equal timeouts is never the case while requests are pending
+    const bool is_earliest_deadline = PushDeadline(slot_index, deadline);
+    lock.unlock();
+
+    if(is_earliest_deadline)
+    {
+        m_deadline_condition.notify_one();
+    }
+
+    return correlation_id;
+}
+
+std::optional<ReplyCallback> RequestClient::TakeRequest(uint64_t correlation_id)
+{
+    std::lock_guard<std::mutex> lock(m_pending_requests_mutex);
+
+    const size_t slot_index = FindSlot(correlation_id);
+
+    if(slot_index == m_pending_requests.size())
+    {
+        return std::nullopt;
+    }
+
+    ReplyCallback callback = std::move(m_pending_requests[slot_index].callback);
+    EraseSlot(slot_index);
+
+    return callback;
+}
+
+size_t RequestClient::FindSlot(uint64_t correlation_id) const
+{
+    // The probe sequence of an ID ends at the first free slot, since erasing never leaves a gap within a probe sequence
+    for(size_t slot_index = correlation_id & m_slot_mask; m_pending_requests[slot_index].correlation_id != 0; slot_index = (slot_index + 1) & m_slot_mask)
+    {
+        if(m_pending_requests[slot_index].correlation_id == correlation_id)
+        {
+            return slot_index;
+        }
+    }
+
+    return m_pending_requests.size();
+}
+
+void RequestClient::EraseSlot(size_t slot_index)
+{
+    RemoveDeadline(m_pending_requests[slot_index].deadline_index);
+
+    // Backward-shift deletion: every request further along the probe sequence that may live in the freed slot moves into it, instead of leaving a tombstone
+    size_t free_slot_index = slot_index;
+
+    for(size_t next_slot_index = (slot_index + 1) & m_slot_mask; m_pending_requests[next_slot_index].correlation_id != 0; next_slot_index = (next_slot_index + 1) & m_slot_mask)
+    {
+        const size_t home_slot_index = m_pending_requests[next_slot_index].correlation_id & m_slot_mask;
+
+        // The request may move unless its home slot lies cyclically after the free slot
+        if(((next_slot_index - home_slot_index) & m_slot_mask) >= ((next_slot_index - free_slot_index) & m_slot_mask))
+        {
+            m_pending_requests[free_slot_index] = std::move(m_pending_requests[next_slot_index]);
+            m_request_deadlines[m_pending_requests[free_slot_index].deadline_index].slot_index = free_slot_index;
+            free_slot_index = next_slot_index;
+        }
+    }
+
+    m_pending_requests[free_slot_index] = PendingRequest {};
+    --m_pending_request_count;
+}
+
+bool RequestClient::PushDeadline(size_t slot_index, std::chrono::steady_clock::time_point deadline)
+{
+    m_request_deadlines.emplace_back();
+    PlaceDeadline(m_request_deadlines.size() - 1, RequestDeadline {.deadline = deadline, .slot_index = slot_index});
+    SiftDeadlineUp(m_request_deadlines.size() - 1);
+
+    return m_pending_requests[slot_index].deadline_index == 0;
+}
+
+void RequestClient::RemoveDeadline(size_t deadline_index)
+{
+    const RequestDeadline last_deadline = m_request_deadlines.back();
+    m_request_deadlines.pop_back();
+
+    if(deadline_index == m_request_deadlines.size())
+    {
+        return;
+    }
+
+    // The last entry fills the gap, and moves whichever way its deadline requires
+    PlaceDeadline(deadline_index, last_deadline);
+    SiftDeadlineUp(deadline_index);
+    SiftDeadlineDown(m_pending_requests[last_deadline.slot_index].deadline_index);
+}
+
+void RequestClient::PlaceDeadline(size_t deadline_index, const RequestDeadline& request_deadline)
+{
+    m_request_deadlines[deadline_index] = request_deadline;
+    m_pending_requests[request_deadline.slot_index].deadline_index = deadline_index;
+}
+
+void RequestClient::SiftDeadlineUp(size_t deadline_index)
+{
+    const RequestDeadline request_deadline = m_request_deadlines[deadline_index];
+
+    while(deadline_index > 0)
+    {
+        const size_t parent_index = (deadline_index - 1) / 2;
+
+        if(m_request_deadlines[parent_index].deadline <= request_deadline.deadline)
+        {
+            break;
+        }
+
+        PlaceDeadline(deadline_index, m_request_deadlines[parent_index]);
+        deadline_index = parent_index;
+    }
+
+    PlaceDeadline(deadline_index, request_deadline);
+}
+
+void RequestClient::SiftDeadlineDown(size_t deadline_index)
+{
+    const RequestDeadline request_deadline = m_request_deadlines[deadline_index];
+
+    while(true)
+    {
+        size_t child_index = deadline_index * 2 + 1;
+
+        if(child_index >= m_request_deadlines.size())
+        {
+            break;
+        }
+
+        if(child_index + 1 < m_request_deadlines.size() && m_request_deadlines[child_index + 1].deadline < m_request_deadlines[child_index].deadline)
+        {
+            ++child_index;
+        }
+
+        if(request_deadline.deadline <= m_request_deadlines[child_index].deadline)
+        {
+            break;
+        }
+
+        PlaceDeadline(deadline_index, m_request_deadlines[child_index]);
+        deadline_index = child_index;
+    }
+
+    PlaceDeadline(deadline_index, request_deadline);
+}
+
+void RequestClient::CompleteRequest(uint64_t correlation_id, RequestReply&& reply)
+{
+    std::optional<ReplyCallback> callback = TakeRequest(correlation_id);
+
+    if(callback.has_value())
+    {
+        callback.value()(std::move(reply));
+    }
+}
+
+void RequestClient::OnReply(const RxBufferRef& rx_buffer, const std::span<char>& frame)
+{
+    if(frame.size() < CORRELATION_ID_SIZE)
+    {
+        std::cerr << std::string(CLASS_NAME) + "::" + __func__ + "() -> Received a reply that is too short to hold a correlation ID!\n";
+        return;
+    }
+
+    FrameHeader encoded_correlation_id {};
+    std::memcpy(encoded_correlation_id.data(), frame.data(), CORRELATION_ID_SIZE);
+
+    const uint64_t correlation_id = DecodeFrameHeader(m_correlation_id_options, encoded_correlation_id);
+
+    CompleteRequest(correlation_id, RequestReply {.status = RequestStatus::REPLIED, .buffer = rx_buffer, .body = frame.subspan(CORRELATION_ID_SIZE)});
+}
+
+void RequestClient::ExpireRequests()
+{
+    std::unique_lock<std::mutex> lock(m_pending_requests_mutex);
+
+    while(m_running)
+    {
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+        // Without a pending request there is nothing to time out until one is registered
+        if(m_request_deadlines.empty() || m_request_deadlines.front().deadline > now)
+        {
+            const std::chrono::steady_clock::time_point wake_time = m_request_deadlines.empty() ? std::chrono::steady_clock::time_point::max()
+                : m_request_deadlines.front().deadline;
+
+            m_deadline_condition.wait_until(lock, wake_time);
+            continue;
+        }
+
+        while(not m_request_deadlines.empty() && m_request_deadlines.front().deadline <= now)
+        {
+            const size_t slot_index = m_request_deadlines.front().slot_index;
+
+            m_expired_requests.emplace_back(std::move(m_pending_requests[slot_index]));
+            EraseSlot(slot_index);
+        }
+
+        lock.unlock();
+
+        for(PendingRequest& expired_request : m_expired_requests)
+        {
+            expired_request.callback(RequestReply {.status = RequestStatus::TIMED_OUT});
+        }
+
+        m_expired_requests.clear();
+        lock.lock();
+    }
+}
+
+} // namespace InterProcessCommunication
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "application_client.h"
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace InterProcessCommunication
+{
+
+enum class RequestStatus
+{
+    REPLIED,
+    TIMED_OUT,
+    // The request was rejected before it was sent (the pending-request table or the TX queue was full), or the client failed to send it
+    NOT_SENT,
+    // CancelPendingRequests() was called, by the caller or because the connection was lost without reconnecting
+    CANCELLED
+};
+
+/*
+    \brief The outcome of a request. A reply shares the pooled RX buffer that its body lies in, so the body stays valid for as long as the reply is kept.
+*/
+struct RequestReply
+{
+    RequestStatus status = RequestStatus::CANCELLED;
+    RxBufferRef buffer {};
+    std::span<char> body {};
+};
+
+using ReplyCallback = std::function<void(RequestReply&& reply)>;
+
+struct RequestClientOptions
+{
+    // The number of requests that may await a reply at the same time. The pending-request table is allocated for twice as many up front.
+    size_t max_pending_requests = 1024;
+    std::chrono::milliseconds default_timeout { 1000 };
+};
+
+/*
+    \brief Pipelines requests over one ApplicationClient connection and matches the replies to them, so that many requests can be in flight at once.
+        Every request and reply is a frame that starts with an 8-byte correlation ID (encoded like an eight-byte frame header, in the framing's byte order)
+        followed by the body, and the server echoes the ID of a request in its reply. Replies may arrive in any order, and a reply whose request is no longer
+        pending (because it timed out, for example) is dropped.
+
+        The requests awaiting a reply are kept in an open-addressed table that is allocated up front, so registering and resolving a request does not allocate.
+        Their deadlines are kept in a min-heap of the same capacity, and the timeout thread sleeps until the earliest one (or until a request is registered, while none is pending).
+        Reply callbacks run on the thread that resolves the request: the client's RX consumer for replies, its TX consumer for requests that failed to send,
+        the RequestClient's timeout thread for timeouts, and the caller of CancelPendingRequests().
+
+        The RequestClient owns its ApplicationClient, whose framing is always enabled. The client is started and opened through GetClient(),
+        and its RX buffer and disconnected callbacks belong to the RequestClient.
+*/
+class RequestClient
+{
+public:
+
+    static constexpr size_t CORRELATION_ID_SIZE { 8 };
+
+    RequestClient(const RequestClient&) = delete;
+    RequestClient& operator=(const RequestClient&) = delete;
+    RequestClient(RequestClient&&) = delete;
+    RequestClient& operator=(RequestClient&&) = delete;
+    ~RequestClient();
+    RequestClient(const std::string& ipv4_address, uint16_t port, const ClientOptions& client_options = {}, const RequestClientOptions& options = {});
+    RequestClient(const std::string& unix_socket_path, const ClientOptions& client_options = {}, const RequestClientOptions& options = {});
+
+    ApplicationClient& GetClient();
+
+    /*
+        \brief This function sends the request and returns a future for its reply. A request that can not be registered resolves the future with NOT_SENT right away.
+            The timeout defaults to RequestClientOptions::default_timeout.
+    */
+    std::future<RequestReply> SendRequest(std::span<const char> body, std::optional<std::chrono::milliseconds> timeout = std::nullopt);
+    /*
+        \brief This function sends the request and passes its reply (or its failure) to the callback exactly once, unless it returns false,
+            in which case the request was rejected and the callback is never called
+    */
+    bool SendRequest(std::span<const char> body, ReplyCallback callback, std::optional<std::chrono::milliseconds> timeout = std::nullopt);
+    /*
+        \brief This function resolves every pending request with CANCELLED
+    */
+    void CancelPendingRequests();
+    size_t GetPendingRequestCount() const;
+
+private:
+
+    const std::string_view CLASS_NAME = "RequestClient";
+
+    struct PendingRequest
+    {
+        // Zero marks a free slot, since correlation IDs start at one
+        uint64_t correlation_id = 0;
+        // The position of the request's deadline in the deadline heap
+        size_t deadline_index = 0;
+        ReplyCallback callback;
+    };
+
+    struct RequestDeadline
+    {
+        std::chrono::steady_clock::time_point deadline;
+        size_t slot_index = 0;
+    };
+
+    const RequestClientOptions m_options;
+    const FramingOptions m_correlation_id_options;
+
+    // The table holds a power of two of slots, and a request's home slot is its correlation ID modulo the table size.
+    // Consecutive IDs therefore land in consecutive slots, and the table is never more than half full.
+    mutable std::mutex m_pending_requests_mutex;
+    std::vector<PendingRequest> m_pending_requests;
+    const size_t m_slot_mask;
+    size_t m_pending_request_count { 0 };
+    uint64_t m_next_correlation_id { 1 };
+    // A binary min-heap of the pending requests' deadlines, guarded by the same mutex. Every entry names its request's slot and every request knows its entry,
+    // so a request that is resolved takes its deadline out right away, and a request that moves to another slot updates its entry.
+    std::vector<RequestDeadline> m_request_deadlines;
+    // Only touched by the timeout thread. Reserved up front, so that collecting the expired requests does not allocate.
+    std::vector<PendingRequest> m_expired_requests;
+
+    // Waited on by the timeout thread together with the pending-request mutex. Notified when a request gets the earliest deadline, and on stopping.
+    std::condition_variable m_deadline_condition;
+    bool m_running { true };
+    std::thread m_timeout_thread;
+
+    // Created last and destroyed first, so that none of its threads can call back into a RequestClient that is being destroyed
+    std::unique_ptr<ApplicationClient> m_client;
+
+    RequestClient(std::unique_ptr<ApplicationClient> client, const ClientOptions& client_options, const RequestClientOptions& options);
+
+    static ClientOptions EnableFraming(ClientOptions client_options);
+
+    std::optional<uint64_t> RegisterRequest(ReplyCallback&& callback, std::chrono::milliseconds timeout);
+    std::optional<ReplyCallback> TakeRequest(uint64_t correlation_id);
+    size_t FindSlot(uint64_t correlation_id) const;
+    void EraseSlot(size_t slot_index);
+    bool PushDeadline(size_t slot_index, std::chrono::steady_clock::time_point deadline);
+    void RemoveDeadline(size_t deadline_index);
+    void PlaceDeadline(size_t deadline_index, const RequestDeadline& request_deadline);
+    void SiftDeadlineUp(size_t deadline_index);
+    void SiftDeadlineDown(size_t deadline_index);
+    void CompleteRequest(uint64_t correlation_id, RequestReply&& reply);
+    void OnReply(const RxBufferRef& rx_buffer, const std::span<char>& frame);
+    void ExpireRequests();
+};
+
+} // namespace InterProcessCommunication
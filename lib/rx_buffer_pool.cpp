@@ -0,0 +1,244 @@
+#include "rx_buffer_pool.h"
+#include <sys/mman.h>
+#include <algorithm>
+
+namespace InterProcessCommunication
+{
+RxBuffer::~RxBuffer()
+{
+    if(m_mapping != nullptr)
+    {
+        munmap(m_mapping, m_size);
+    }
+}
+
+RxBuffer::RxBuffer(size_t size)
+: m_bytes(std::make_unique_for_overwrite<char[]>(size))
+, m_size(size)
+{
+}
+
+RxBuffer::RxBuffer(char* mapping, size_t size)
+: m_mapping(mapping)
+, m_size(size)
+{
+}
+
+char* RxBuffer::GetData()
+{
+    return m_mapping != nullptr ? m_mapping : m_bytes.get();
+}
+
+size_t RxBuffer::GetSize() const
+{
+    return m_size;
+}
+
+RxBufferRef::RxBufferRef(RxBuffer* buffer)
+: m_buffer(buffer)
+{
+    m_buffer->m_reference_count.store(1, std::memory_order_relaxed);
+}
+
+RxBufferRef::RxBufferRef(const RxBufferRef& other)
+: m_buffer(other.m_buffer)
+{
+    if(m_buffer != nullptr)
+    {
+        m_buffer->m_reference_count.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+RxBufferRef& RxBufferRef::operator=(const RxBufferRef& other)
+{
+    if(m_buffer != other.m_buffer)
+    {
+        // Retain first so that assigning a handle to another handle of a buffer it keeps alive is safe
+        if(other.m_buffer != nullptr)
+        {
+            other.m_buffer->m_reference_count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        Release();
+        m_buffer = other.m_buffer;
+    }
+
+    return *this;
+}
+
+RxBufferRef::RxBufferRef(RxBufferRef&& other) noexcept
+: m_buffer(std::exchange(other.m_buffer, nullptr))
+{
+}
+
+RxBufferRef& RxBufferRef::operator=(RxBufferRef&& other) noexcept
+{
+    if(this != &other)
+    {
+        Release();
+        m_buffer = std::exchange(other.m_buffer, nullptr);
+    }
+
+    return *this;
+}
+
+RxBufferRef::~RxBufferRef()
+{
+    Release();
+}
+
+char* RxBufferRef::GetData() const
+{
+    return m_buffer->GetData();
+}
+
+size_t RxBufferRef::GetSize() const
+{
+    return m_buffer->GetSize();
+}
+
+std::span<char> RxBufferRef::GetBytes() const
+{
+    return std::span<char>(m_buffer->GetData(), m_buffer->GetSize());
+}
+
+bool RxBufferRef::IsShared() const
+{
+    // Acquire pairs with the release in Release(), so the other holder has finished reading the bytes once the count drops back to 1
+    return m_buffer != nullptr && m_buffer->m_reference_count.load(std::memory_order_acquire) > 1;
+}
+
+RxBufferRef::operator bool() const
+{
+    return m_buffer != nullptr;
+}
+
+void RxBufferRef::Release()
+{
+    if(m_buffer == nullptr)
+    {
+        return;
+    }
+
+    RxBuffer* buffer = std::exchange(m_buffer, nullptr);
+
+    if(buffer->m_reference_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        // The buffer's reference to the pool keeps it alive until the buffer has been handed back
+        const std::shared_ptr<RxBufferPool> pool = std::move(buffer->m_pool);
+        pool->Recycle(buffer);
+    }
+}
+
+RxBufferPool::RxBufferPool(size_t buffer_size, size_t max_buffer_size, size_t max_pooled_buffers)
+: m_buffer_size(std::max<size_t>(buffer_size, 1))
+, m_max_buffer_size(std::max(max_buffer_size, m_buffer_size.load()))
+, m_max_pooled_buffers(max_pooled_buffers)
+{
+}
+
+std::shared_ptr<RxBufferPool> RxBufferPool::Create(size_t buffer_size, size_t max_buffer_size, size_t max_pooled_buffers)
+{
+    return std::shared_ptr<RxBufferPool>(new RxBufferPool(buffer_size, max_buffer_size, max_pooled_buffers));
+}
+
+RxBufferRef RxBufferPool::Acquire()
+{
+    const size_t buffer_size = m_buffer_size.load(std::memory_order_relaxed);
+    std::unique_ptr<RxBuffer> buffer;
+
+    {
+        std::lock_guard<std::mutex> lock(m_free_buffers_mutex);
+
+        // Buffers from before the last growth step are too small to be reused
+        while(not m_free_buffers.empty() && buffer == nullptr)
+        {
+            if(m_free_buffers.back()->GetSize() == buffer_size)
+            {
+                buffer = std::move(m_free_buffers.back());
+            }
+
+            m_free_buffers.pop_back();
+        }
+    }
+
+    if(buffer == nullptr)
+    {
+        buffer = std::make_unique<RxBuffer>(buffer_size);
+        m_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    buffer->m_pool = shared_from_this();
+    return RxBufferRef(buffer.release());
+}
+
+RxBufferRef RxBufferPool::Acquire(size_t minimum_size)
+{
+    if(minimum_size <= m_buffer_size.load(std::memory_order_relaxed))
+    {
+        return Acquire();
+    }
+
+    RxBuffer* buffer = new RxBuffer(minimum_size);
+    m_allocation_count.fetch_add(1, std::memory_order_relaxed);
+
+    buffer->m_pool = shared_from_this();
+    return RxBufferRef(buffer);
+}
+
+RxBufferRef RxBufferPool::AdoptMapping(char* mapping, size_t size)
+{
+    RxBuffer* buffer = new RxBuffer(mapping, size);
+
+    buffer->m_pool = shared_from_this();
+    return RxBufferRef(buffer);
+}
+
+void RxBufferPool::RecordRead(size_t read_bytes, size_t buffer_size)
+{
+    if(read_bytes < buffer_size)
+    {
+        m_consecutive_full_reads = 0;
+        return;
+    }
+
+    const size_t current_buffer_size = m_buffer_size.load(std::memory_order_relaxed);
+
+    if(++m_consecutive_full_reads < FULL_READS_BEFORE_GROWTH || current_buffer_size >= m_max_buffer_size)
+    {
+        return;
+    }
+
+    m_consecutive_full_reads = 0;
+    m_buffer_size.store(std::min(current_buffer_size * 2, m_max_buffer_size), std::memory_order_relaxed);
+}
+
+size_t RxBufferPool::GetBufferSize() const
+{
+    return m_buffer_size.load(std::memory_order_relaxed);
+}
+
+uint64_t RxBufferPool::GetAllocationCount() const
+{
+    return m_allocation_count.load(std::memory_order_relaxed);
+}
+
+void RxBufferPool::Recycle(RxBuffer* buffer)
+{
+    std::unique_ptr<RxBuffer> owned_buffer(buffer);
+
+    // Only heap buffers of the current target size are worth keeping
+    if(owned_buffer->m_mapping != nullptr || owned_buffer->GetSize() != m_buffer_size.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_free_buffers_mutex);
+
+    if(m_free_buffers.size() < m_max_pooled_buffers)
+    {
+        m_free_buffers.push_back(std::move(owned_buffer));
+    }
+}
+
+} // namespace InterProcessCommunication
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace InterProcessCommunication
+{
+
+class RxBufferPool;
+
+/*
+    \brief A receive buffer owned by an RxBufferPool. It returns to its pool when the last RxBufferRef to it is released.
+        A buffer that views a memory mapping instead (see RxBufferPool::AdoptMapping()) is unmapped then, and never pooled.
+*/
+class RxBuffer
+{
+public:
+
+    RxBuffer(const RxBuffer&) = delete;
+    RxBuffer& operator=(const RxBuffer&) = delete;
+    RxBuffer(RxBuffer&&) = delete;
+    RxBuffer& operator=(RxBuffer&&) = delete;
+    ~RxBuffer();
+    explicit RxBuffer(size_t size);
+    RxBuffer(char* mapping, size_t size);
+
+    char* GetData();
+    size_t GetSize() const;
+
+private:
+
+    friend class RxBufferPool;
+    friend class RxBufferRef;
+
+    // The bytes are left uninitialised since every read overwrites them
+    std::unique_ptr<char[]> m_bytes;
+    char* m_mapping { nullptr };
+    size_t m_size { 0 };
+    std::atomic<uint32_t> m_reference_count { 0 };
+    // Only set while the buffer is handed out, so that the pool outlives every buffer that is still referenced
+    std::shared_ptr<RxBufferPool> m_pool;
+};
+
+/*
+    \brief A reference counted handle to a pooled receive buffer. Copying the handle retains the buffer without copying its bytes.
+*/
+class RxBufferRef
+{
+public:
+
+    RxBufferRef() = default;
+    RxBufferRef(const RxBufferRef& other);
+    RxBufferRef& operator=(const RxBufferRef& other);
+    RxBufferRef(RxBufferRef&& other) noexcept;
+    RxBufferRef& operator=(RxBufferRef&& other) noexcept;
+    ~RxBufferRef();
+
+    char* GetData() const;
+    size_t GetSize() const;
+    std::span<char> GetBytes() const;
+    /*
+        \brief This function reports whether any other handle refers to the same buffer
+    */
+    bool IsShared() const;
+    explicit operator bool() const;
+
+private:
+
+    friend class RxBufferPool;
+
+    explicit RxBufferRef(RxBuffer* buffer);
+
+    void Release();
+
+    RxBuffer* m_buffer { nullptr };
+};
+
+/*
+    \brief Hands out reusable receive buffers of the current target size, and optionally grows that size when reads keep filling whole buffers.
+        A pool must be created with Create(), since retained buffers keep it alive after its owner is gone.
+*/
+class RxBufferPool : public std::enable_shared_from_this<RxBufferPool>
+{
+public:
+
+    RxBufferPool(const RxBufferPool&) = delete;
+    RxBufferPool& operator=(const RxBufferPool&) = delete;
+    RxBufferPool(RxBufferPool&&) = delete;
+    RxBufferPool& operator=(RxBufferPool&&) = delete;
+
+    static std::shared_ptr<RxBufferPool> Create(size_t buffer_size, size_t max_buffer_size, size_t max_pooled_buffers);
+
+    /*
+        \brief This function returns a free buffer of the current target size, allocating one only when no pooled buffer fits
+    */
+    RxBufferRef Acquire();
+    /*
+        \brief This function returns a buffer of at least minimum_size bytes. Buffers larger than the target size are allocated for the caller and never pooled.
+    */
+    RxBufferRef Acquire(size_t minimum_size);
+    /*
+        \brief This function hands out a buffer that views the given memory mapping, which is unmapped with munmap() once the last reference is released
+    */
+    RxBufferRef AdoptMapping(char* mapping, size_t size);
+    /*
+        \brief This function feeds the size of a completed read into the adaptive sizing. It must only be called by the single reader of the pool.
+    */
+    void RecordRead(size_t read_bytes, size_t buffer_size);
+
+    size_t GetBufferSize() const;
+    uint64_t GetAllocationCount() const;
+
+private:
+
+    friend class RxBufferRef;
+
+    RxBufferPool(size_t buffer_size, size_t max_buffer_size, size_t max_pooled_buffers);
+
+    void Recycle(RxBuffer* buffer);
+
+    // Reads that fill the whole buffer this many times in a row double the target buffer size
+    static constexpr uint32_t FULL_READS_BEFORE_GROWTH { 2 };
+
+    std::atomic<size_t> m_buffer_size;
+    const size_t m_max_buffer_size;
+    const size_t m_max_pooled_buffers;
+    uint32_t m_consecutive_full_reads { 0 };
+    std::atomic<uint64_t> m_allocation_count { 0 };
+
+    std::mutex m_free_buffers_mutex;
+    std::vector<std::unique_ptr<RxBuffer>> m_free_buffers;
+};
+
+} // namespace InterProcessCommunication
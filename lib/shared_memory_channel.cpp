@@ -0,0 +1,378 @@
+#include "shared_memory_channel.h"
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <new>
+
+namespace InterProcessCommunication
+{
+namespace
+{
+
+// The futexes live in memory shared with another process, so they must not be the process-private kind that std::atomic::wait() uses
+long WaitOnFutex(std::atomic<uint32_t>& futex_word, uint32_t expected_value, const timespec* timeout)
+{
+    return syscall(SYS_futex, reinterpret_cast<uint32_t*>(&futex_word), FUTEX_WAIT, expected_value, timeout, nullptr, 0);
+}
+
+void WakeFutex(std::atomic<uint32_t>& futex_word, int waiter_count)
+{
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&futex_word), FUTEX_WAKE, waiter_count, nullptr, nullptr, 0);
+}
+
+void PauseCpu()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+} // namespace
+
+SharedMemoryChannel::~SharedMemoryChannel()
+{
+    munmap(m_mapping, m_mapping_size);
+}
+
+SharedMemoryChannel::SharedMemoryChannel(void* mapping, size_t mapping_size, Side side, uint32_t busy_wait_microseconds)
+: m_mapping(mapping)
+, m_mapping_size(mapping_size)
+, m_header(static_cast<SegmentHeader*>(mapping))
+, m_busy_wait_microseconds(busy_wait_microseconds)
+, m_ring_size(m_header->ring_size)
+, m_ring_mask(m_ring_size - 1)
+, m_tx_ring(m_header->rings[side == Side::CLIENT ? 0 : 1])
+, m_rx_ring(m_header->rings[side == Side::CLIENT ? 1 : 0])
+, m_tx_data(static_cast<char*>(mapping) + RING_DATA_OFFSET + (side == Side::CLIENT ? 0 : m_ring_size))
+, m_rx_data(static_cast<char*>(mapping) + RING_DATA_OFFSET + (side == Side::CLIENT ? m_ring_size : 0))
+{
+}
+
+std::shared_ptr<SharedMemoryChannel> SharedMemoryChannel::Create(int file_descriptor, size_t ring_size, uint32_t busy_wait_microseconds)
+{
+    // A power of two lets the positions run on freely and be masked into the ring
+    const size_t rounded_ring_size = std::bit_ceil(std::max<size_t>(ring_size, RING_DATA_OFFSET));
+    const size_t mapping_size = RING_DATA_OFFSET + 2 * rounded_ring_size;
+
+    if(ftruncate(file_descriptor, static_cast<off_t>(mapping_size)) != 0)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to size shared memory segment!";
+        perror(error_message.c_str());
+        return nullptr;
+    }
+
+    void* mapping = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, file_descriptor, 0);
+
+    if(mapping == MAP_FAILED)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to map shared memory segment!";
+        perror(error_message.c_str());
+        return nullptr;
+    }
+
+    SegmentHeader* header = new (mapping) SegmentHeader {};
+    header->version = SEGMENT_VERSION;
+    header->ring_size = rounded_ring_size;
+    header->session_state.store(SESSION_IDLE, std::memory_order_relaxed);
+
+    // A client that opens the segment while it is being laid out finds no magic yet and refuses it
+    std::atomic_ref<uint64_t>(header->magic).store(SEGMENT_MAGIC, std::memory_order_release);
+
+    return std::shared_ptr<SharedMemoryChannel>(new SharedMemoryChannel(mapping, mapping_size, Side::PEER, busy_wait_microseconds));
+}
+
+std::shared_ptr<SharedMemoryChannel> SharedMemoryChannel::Open(int file_descriptor, Side side, uint32_t busy_wait_microseconds)
+{
+    struct stat segment_status {};
+
+    if(fstat(file_descriptor, &segment_status) != 0 || static_cast<size_t>(segment_status.st_size) < RING_DATA_OFFSET)
+    {
+        std::cerr << std::string(CLASS_NAME) + "::" + __func__ + "() -> The shared memory object is not a channel segment!\n";
+        return nullptr;
+    }
+
+    const size_t mapping_size = static_cast<size_t>(segment_status.st_size);
+    void* mapping = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, file_descriptor, 0);
+
+    if(mapping == MAP_FAILED)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to map shared memory segment!";
+        perror(error_message.c_str());
+        return nullptr;
+    }
+
+    SegmentHeader* header = static_cast<SegmentHeader*>(mapping);
+    const uint64_t magic = std::atomic_ref<uint64_t>(header->magic).load(std::memory_order_acquire);
+    const uint64_t ring_size = header->ring_size;
+
+    if(magic != SEGMENT_MAGIC || header->version != SEGMENT_VERSION || not std::has_single_bit(ring_size) || RING_DATA_OFFSET + 2 * ring_size != mapping_size)
+    {
+        std::cerr << std::string(CLASS_NAME) + "::" + __func__ + "() -> The shared memory object is not a channel segment of this version!\n";
+        munmap(mapping, mapping_size);
+        return nullptr;
+    }
+
+    return std::shared_ptr<SharedMemoryChannel>(new SharedMemoryChannel(mapping, mapping_size, side, busy_wait_microseconds));
+}
+
+bool SharedMemoryChannel::Attach()
+{
+    uint32_t expected_state = SESSION_IDLE;
+
+    if(not m_header->session_state.compare_exchange_strong(expected_state, SESSION_ATTACHED))
+    {
+        return false;
+    }
+
+    WakeFutex(m_header->session_state, INT_MAX);
+
+    return true;
+}
+
+bool SharedMemoryChannel::WaitForAttach(std::chrono::milliseconds timeout)
+{
+    const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + timeout;
+
+    while(m_header->session_state.load() == SESSION_IDLE)
+    {
+        timespec remaining_time {};
+        const timespec* futex_timeout = nullptr;
+
+        if(timeout.count() > 0)
+        {
+            const std::chrono::nanoseconds remaining = deadline - std::chrono::steady_clock::now();
+
+            if(remaining.count() <= 0)
+            {
+                break;
+            }
+
+            remaining_time.tv_sec = static_cast<time_t>(remaining.count() / 1000000000);
+            remaining_time.tv_nsec = static_cast<long>(remaining.count() % 1000000000);
+            futex_timeout = &remaining_time;
+        }
+
+        (void)WaitOnFutex(m_header->session_state, SESSION_IDLE, futex_timeout);
+    }
+
+    return m_header->session_state.load() == SESSION_ATTACHED;
+}
+
+ssize_t SharedMemoryChannel::Send(const iovec* iovecs, size_t iovec_count, bool may_wait)
+{
+    const uint64_t write_position = m_tx_ring.write_position.load(std::memory_order_relaxed);
+    uint64_t read_position = m_tx_ring.read_position.load(std::memory_order_acquire);
+
+    const auto is_writable = [&]()
+    {
+        read_position = m_tx_ring.read_position.load();
+        return write_position - read_position < m_ring_size || IsClosed();
+    };
+
+    if(write_position - read_position == m_ring_size && not IsClosed())
+    {
+        if(not may_wait)
+        {
+            errno = EAGAIN;
+            return -1;
+        }
+
+        if(not BusyWait(is_writable))
+        {
+            WaitForSequence(m_tx_ring.space_sequence, m_tx_ring.is_writer_waiting, is_writable);
+        }
+    }
+
+    // Like a socket whose peer has gone, and unlike the receiving side, a closed session takes no more bytes even if there is room for them
+    if(IsClosed())
+    {
+        errno = EPIPE;
+        return -1;
+    }
+
+    size_t free_bytes = m_ring_size - (write_position - read_position);
+    uint64_t position = write_position;
+
+    for(size_t index = 0; index < iovec_count && free_bytes > 0; ++index)
+    {
+        const char* bytes = static_cast<const char*>(iovecs[index].iov_base);
+        size_t remaining_bytes = std::min(iovecs[index].iov_len, free_bytes);
+
+        free_bytes -= remaining_bytes;
+
+        // A copy that runs past the end of the ring continues at its start
+        while(remaining_bytes > 0)
+        {
+            const size_t offset = position & m_ring_mask;
+            const size_t copied_bytes = std::min<size_t>(remaining_bytes, m_ring_size - offset);
+
+            std::memcpy(m_tx_data + offset, bytes, copied_bytes);
+            bytes += copied_bytes;
+            position += copied_bytes;
+            remaining_bytes -= copied_bytes;
+        }
+    }
+
+    // Publishing the position and then checking the reader's flag pairs with the reader raising the flag and then checking the position (see WaitForSequence()),
+    // so that either the reader sees the bytes or this side sees that it has to wake the reader
+    m_tx_ring.write_position.store(position);
+
+    if(m_tx_ring.is_reader_waiting.load())
+    {
+        WakeSequence(m_tx_ring.data_sequence, 1);
+    }
+
+    return static_cast<ssize_t>(position - write_position);
+}
+
+ssize_t SharedMemoryChannel::Receive(std::span<char> rx_bytes, bool may_wait)
+{
+    const uint64_t read_position = m_rx_ring.read_position.load(std::memory_order_relaxed);
+    uint64_t write_position = m_rx_ring.write_position.load(std::memory_order_acquire);
+
+    const auto is_readable = [&]()
+    {
+        write_position = m_rx_ring.write_position.load();
+        return write_position != read_position || IsClosed();
+    };
+
+    if(write_position == read_position && not IsClosed())
+    {
+        if(not may_wait)
+        {
+            errno = EAGAIN;
+            return -1;
+        }
+
+        if(not BusyWait(is_readable))
+        {
+            WaitForSequence(m_rx_ring.data_sequence, m_rx_ring.is_reader_waiting, is_readable);
+        }
+    }
+
+    // The bytes that were sent before the session was closed are still delivered, and only then does the stream end
+    const size_t read_bytes = std::min<uint64_t>(write_position - read_position, rx_bytes.size());
+    size_t copied_bytes = 0;
+
+    while(copied_bytes < read_bytes)
+    {
+        const size_t offset = (read_position + copied_bytes) & m_ring_mask;
+        const size_t chunk_bytes = std::min<size_t>(read_bytes - copied_bytes, m_ring_size - offset);
+
+        std::memcpy(rx_bytes.data() + copied_bytes, m_rx_data + offset, chunk_bytes);
+        copied_bytes += chunk_bytes;
+    }
+
+    if(read_bytes == 0)
+    {
+        return 0;
+    }
+
+    m_rx_ring.read_position.store(read_position + read_bytes);
+
+    if(m_rx_ring.is_writer_waiting.load())
+    {
+        WakeSequence(m_rx_ring.space_sequence, 1);
+    }
+
+    return static_cast<ssize_t>(read_bytes);
+}
+
+void SharedMemoryChannel::Close()
+{
+    if(m_header->session_state.exchange(SESSION_CLOSED) == SESSION_CLOSED)
+    {
+        return;
+    }
+
+    WakeFutex(m_header->session_state, INT_MAX);
+
+    // Every side that sleeps re-checks the session state once its sequence has moved
+    for(RingControl& ring : m_header->rings)
+    {
+        WakeSequence(ring.data_sequence, INT_MAX);
+        WakeSequence(ring.space_sequence, INT_MAX);
+    }
+}
+
+bool SharedMemoryChannel::IsClosed() const
+{
+    return m_header->session_state.load() == SESSION_CLOSED;
+}
+
+size_t SharedMemoryChannel::GetRingSize() const
+{
+    return m_ring_size;
+}
+
+template <typename Predicate>
+bool SharedMemoryChannel::BusyWait(Predicate&& predicate) const
+{
+    if(m_busy_wait_microseconds == 0)
+    {
+        return predicate();
+    }
+
+    // Reading the clock costs more than a pause, so it is only checked every so often
+    static constexpr uint32_t PAUSES_PER_CLOCK_CHECK { 64 };
+    const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(m_busy_wait_microseconds);
+
+    while(true)
+    {
+        for(uint32_t pause_count = 0; pause_count < PAUSES_PER_CLOCK_CHECK; ++pause_count)
+        {
+            if(predicate())
+            {
+                return true;
+            }
+
+            PauseCpu();
+        }
+
+        if(std::chrono::steady_clock::now() >= deadline)
+        {
+            return predicate();
+        }
+    }
+}
+
+template <typename Predicate>
+void SharedMemoryChannel::WaitForSequence(std::atomic<uint32_t>& sequence, std::atomic<uint32_t>& is_waiting, Predicate&& predicate)
+{
+    // The flag is raised before the condition is checked, and the sequence is read before it, so a wake-up that the other side sends after the check
+    // has moved the sequence by the time this side goes to sleep on it, and the sleep returns right away
+    is_waiting.store(1);
+
+    while(true)
+    {
+        const uint32_t observed_sequence = sequence.load();
+
+        if(predicate())
+        {
+            break;
+        }
+
+        (void)WaitOnFutex(sequence, observed_sequence, nullptr);
+    }
+
+    is_waiting.store(0, std::memory_order_relaxed);
+}
+
+void SharedMemoryChannel::WakeSequence(std::atomic<uint32_t>& sequence, int waiter_count)
+{
+    sequence.fetch_add(1);
+    WakeFutex(sequence, waiter_count);
+}
+
+} // namespace InterProcessCommunication
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace InterProcessCommunication
+{
+
+/*
+    \brief The shared memory segment of a session between an ApplicationClient in SHARED_MEMORY mode and its peer (see SharedMemoryPeer).
+        The segment holds one single-producer single-consumer byte ring per direction, so each side has exactly one writer and one reader of its own.
+        A reader that finds its ring empty (or a writer that finds it full) first busy-waits for a while and then sleeps on a futex in the segment.
+        The other side only makes the wake-up system call when it sees that flag, so neither side enters the kernel while both keep up with each other.
+        A segment carries a single session: once either side closes it, both sides see the end of the stream, and a new session needs a new segment.
+*/
+class SharedMemoryChannel
+{
+public:
+
+    enum class Side
+    {
+        CLIENT,
+        PEER
+    };
+
+    SharedMemoryChannel(const SharedMemoryChannel&) = delete;
+    SharedMemoryChannel& operator=(const SharedMemoryChannel&) = delete;
+    SharedMemoryChannel(SharedMemoryChannel&&) = delete;
+    SharedMemoryChannel& operator=(SharedMemoryChannel&&) = delete;
+    ~SharedMemoryChannel();
+
+    /*
+        \brief This function sizes the shared memory object behind file_descriptor for two rings of at least ring_size bytes each (rounded up to a power of two),
+            and lays out an idle session in it. It returns nullptr if the object can not be sized or mapped.
+    */
+    static std::shared_ptr<SharedMemoryChannel> Create(int file_descriptor, size_t ring_size, uint32_t busy_wait_microseconds);
+    /*
+        \brief This function maps a segment that Create() has laid out. It returns nullptr if the object is not such a segment.
+            The caller keeps the descriptor, which may be closed as soon as this function returns.
+    */
+    static std::shared_ptr<SharedMemoryChannel> Open(int file_descriptor, Side side, uint32_t busy_wait_microseconds);
+
+    /*
+        \brief This function claims the idle session for the client. It fails if another client has claimed it already, or the session has been closed.
+    */
+    bool Attach();
+    /*
+        \brief This function waits until a client has attached, or the timeout (if any) has passed. It returns false if no client is attached.
+    */
+    bool WaitForAttach(std::chrono::milliseconds timeout);
+    /*
+        \brief This function copies as much of the gathered bytes into the outgoing ring as fits and returns the number of bytes copied.
+            With may_wait, it waits until there is room for at least one byte. It returns -1 with errno set to EPIPE once the session is closed,
+            and with EAGAIN if the ring is full and it may not wait.
+    */
+    ssize_t Send(const iovec* iovecs, size_t iovec_count, bool may_wait);
+    /*
+        \brief This function copies up to rx_bytes.size() bytes from the incoming ring and returns the number of bytes copied.
+            With may_wait, it waits until there is at least one byte. It returns 0 once the session is closed and the ring has been drained,
+            and -1 with errno set to EAGAIN if the ring is empty and it may not wait.
+    */
+    ssize_t Receive(std::span<char> rx_bytes, bool may_wait);
+    /*
+        \brief This function ends the session for both sides and wakes every side that waits on it
+    */
+    void Close();
+    bool IsClosed() const;
+    size_t GetRingSize() const;
+
+private:
+
+    static constexpr std::string_view CLASS_NAME = "SharedMemoryChannel";
+    static constexpr size_t CACHE_LINE_SIZE { 64 };
+
+    // The futex words have to be plain 32-bit integers in the segment, shared with the other process
+    static_assert(std::atomic<uint32_t>::is_always_lock_free && sizeof(std::atomic<uint32_t>) == sizeof(uint32_t));
+    static_assert(std::atomic<uint64_t>::is_always_lock_free);
+
+    // The state of one ring. The writer and the reader each own a cache line, so that neither line bounces between the sides while the other is busy.
+    struct RingControl
+    {
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> write_position;
+        // Bumped by the writer to wake a reader that sleeps on it, and by Close()
+        std::atomic<uint32_t> data_sequence;
+        std::atomic<uint32_t> is_writer_waiting;
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> read_position;
+        // Bumped by the reader to wake a writer that sleeps on it, and by Close()
+        std::atomic<uint32_t> space_sequence;
+        std::atomic<uint32_t> is_reader_waiting;
+    };
+
+    struct SegmentHeader
+    {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t reserved;
+        uint64_t ring_size;
+        // One of the SESSION_ values. It doubles as the futex word that the peer waits on for a client to attach.
+        alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> session_state;
+        // Ring 0 carries the client's bytes to the peer, ring 1 the peer's bytes to the client
+        RingControl rings[2];
+    };
+
+    static constexpr uint64_t SEGMENT_MAGIC { 0x4150504950435348 };
+    static constexpr uint32_t SEGMENT_VERSION { 1 };
+    static constexpr uint32_t SESSION_IDLE { 0 };
+    static constexpr uint32_t SESSION_ATTACHED { 1 };
+    static constexpr uint32_t SESSION_CLOSED { 2 };
+    // The ring data starts on a page boundary after the header
+    static constexpr size_t RING_DATA_OFFSET { 4096 };
+    static_assert(sizeof(SegmentHeader) <= RING_DATA_OFFSET);
+
+    SharedMemoryChannel(void* mapping, size_t mapping_size, Side side, uint32_t busy_wait_microseconds);
+
+    template <typename Predicate>
+    bool BusyWait(Predicate&& predicate) const;
+    template <typename Predicate>
+    void WaitForSequence(std::atomic<uint32_t>& sequence, std::atomic<uint32_t>& is_waiting, Predicate&& predicate);
+    static void WakeSequence(std::atomic<uint32_t>& sequence, int waiter_count);
+
+    void* const m_mapping;
+    const size_t m_mapping_size;
+    SegmentHeader* const m_header;
+    const uint32_t m_busy_wait_microseconds;
+    const uint64_t m_ring_size;
+    const uint64_t m_ring_mask;
+    RingControl& m_tx_ring;
+    RingControl& m_rx_ring;
+    char* const m_tx_data;
+    char* const m_rx_data;
+};
+
+} // namespace InterProcessCommunication
@@ -0,0 +1,88 @@
+#include "shared_memory_peer.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cstdio>
+
+namespace InterProcessCommunication
+{
+SharedMemoryPeer::~SharedMemoryPeer()
+{
+    m_channel->Close();
+    shm_unlink(m_name.c_str());
+}
+
+SharedMemoryPeer::SharedMemoryPeer(const std::string& name, std::shared_ptr<SharedMemoryChannel> channel)
+: m_name(name)
+, m_channel(std::move(channel))
+{
+}
+
+std::unique_ptr<SharedMemoryPeer> SharedMemoryPeer::Create(const std::string& name, size_t ring_size, uint32_t busy_wait_microseconds)
+{
+    // Only the creator lays out the segment, so an existing one is never taken over
+    const int file_descriptor = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, S_IRUSR | S_IWUSR);
+
+    if(file_descriptor < 0)
+    {
+        const std::string error_message = std::string(CLASS_NAME) + "::" + __func__ + "() -> Failed to create shared memory segment: {" + name + "}";
+        perror(error_message.c_str());
+        return nullptr;
+    }
+
+    std::shared_ptr<SharedMemoryChannel> channel = SharedMemoryChannel::Create(file_descriptor, ring_size, busy_wait_microseconds);
+    close(file_descriptor);
+
+    if(channel == nullptr)
+    {
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+
+    return std::unique_ptr<SharedMemoryPeer>(new SharedMemoryPeer(name, std::move(channel)));
+}
+
+bool SharedMemoryPeer::WaitForClient(std::chrono::milliseconds timeout)
+{
+    return m_channel->WaitForAttach(timeout);
+}
+
+bool SharedMemoryPeer::SendAll(std::span<const char> tx_bytes)
+{
+    while(not tx_bytes.empty())
+    {
+        const iovec tx_iovec {.iov_base = const_cast<char*>(tx_bytes.data()), .iov_len = tx_bytes.size()};
+        const ssize_t sent_bytes = m_channel->Send(&tx_iovec, 1, true);
+
+        if(sent_bytes < 0)
+        {
+            return false;
+        }
+
+        tx_bytes = tx_bytes.subspan(sent_bytes);
+    }
+
+    return true;
+}
+
+ssize_t SharedMemoryPeer::Receive(std::span<char> rx_bytes)
+{
+    return m_channel->Receive(rx_bytes, true);
+}
+
+void SharedMemoryPeer::Close()
+{
+    m_channel->Close();
+}
+
+bool SharedMemoryPeer::IsClosed() const
+{
+    return m_channel->IsClosed();
+}
+
+const std::string& SharedMemoryPeer::GetName() const
+{
+    return m_name;
+}
+
+} // namespace InterProcessCommunication
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "shared_memory_channel.h"
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace InterProcessCommunication
+{
+
+/*
+    \brief The other end of an ApplicationClient in SHARED_MEMORY mode, the counterpart of a listening socket: it creates a named POSIX shared memory segment
+        and exchanges bytes with the one client that attaches to it. The bytes form a stream, so a client with framing enabled expects the peer to frame its
+        messages the same way (see EncodeFrameHeader()). It is a reference implementation for tests and benchmarks, and a starting point for peers of other processes.
+        The peer is not thread-safe, except that one thread may send while another receives. Destroying it closes the session and removes the segment's name.
+*/
+class SharedMemoryPeer
+{
+public:
+
+    SharedMemoryPeer(const SharedMemoryPeer&) = delete;
+    SharedMemoryPeer& operator=(const SharedMemoryPeer&) = delete;
+    SharedMemoryPeer(SharedMemoryPeer&&) = delete;
+    SharedMemoryPeer& operator=(SharedMemoryPeer&&) = delete;
+    ~SharedMemoryPeer();
+
+    static constexpr size_t DEFAULT_RING_SIZE { 1024 * 1024 };
+
+    /*
+        \brief This function creates the segment under name (which starts with a slash, see shm_open()) with two rings of ring_size bytes.
+            It returns nullptr if a segment of that name exists already or can not be created.
+    */
+    static std::unique_ptr<SharedMemoryPeer> Create(const std::string& name, size_t ring_size = DEFAULT_RING_SIZE, uint32_t busy_wait_microseconds = 0);
+
+    /*
+        \brief This function waits until a client has attached, or the timeout (if any) has passed
+    */
+    bool WaitForClient(std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+    /*
+        \brief This function blocks until all of the bytes are in the ring towards the client. It returns false if the session has been closed.
+    */
+    bool SendAll(std::span<const char> tx_bytes);
+    /*
+        \brief This function blocks until the client has sent any bytes and returns the number copied into rx_bytes, or 0 once the session has been closed
+    */
+    ssize_t Receive(std::span<char> rx_bytes);
+    /*
+        \brief This function ends the session, which the client sees as the peer having closed the connection
+    */
+    void Close();
+    bool IsClosed() const;
+    const std::string& GetName() const;
+
+private:
+
+    static constexpr std::string_view CLASS_NAME = "SharedMemoryPeer";
+
+    SharedMemoryPeer(const std::string& name, std::shared_ptr<SharedMemoryChannel> channel);
+
+    const std::string m_name;
+    const std::shared_ptr<SharedMemoryChannel> m_channel;
+};
+
+} // namespace InterProcessCommunication
@@ -0,0 +1,79 @@
+#include "statistics_exporter.h"
+#include <algorithm>
+
+namespace InterProcessCommunication
+{
+StatisticsExporter::~StatisticsExporter()
+{
+    Stop();
+}
+
+StatisticsExporter::StatisticsExporter(std::chrono::milliseconds interval, StatisticsExportCallback callback)
+: m_interval(interval)
+, m_callback(std::move(callback))
+{
+}
+
+bool StatisticsExporter::Start()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if(m_running)
+    {
+        return false;
+    }
+
+    m_running = true;
+    m_thread = std::thread(&StatisticsExporter::Run, this);
+
+    return true;
+}
+
+void StatisticsExporter::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_running = false;
+    }
+
+    m_stop_condition.notify_all();
+
+    if(m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+void StatisticsExporter::Register(const ApplicationClient& client)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_clients.push_back(&client);
+}
+
+void StatisticsExporter::Unregister(const ApplicationClient& client)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::erase(m_clients, &client);
+}
+
+void StatisticsExporter::Run()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while(m_running)
+    {
+        // Waking up early only happens to stop, so the interval is measured from the end of the previous export
+        if(m_stop_condition.wait_for(lock, m_interval, [this](){ return not m_running; }))
+        {
+            break;
+        }
+
+        // The lock is held while exporting, so that Unregister() can not return while a client is still being read
+        for(const ApplicationClient* client : m_clients)
+        {
+            m_callback(*client, client->GetStatistics());
+        }
+    }
+}
+
+} // namespace InterProcessCommunication
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "application_client.h"
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace InterProcessCommunication
+{
+
+using StatisticsExportCallback = std::function<void(const ApplicationClient& client, const ClientStatistics& statistics)>;
+
+/*
+    \brief Periodically passes a statistics snapshot of every registered client to a callback, from a thread of its own.
+        The clients themselves never wait for an export, since snapshots only read their counters.
+*/
+class StatisticsExporter
+{
+public:
+
+    StatisticsExporter(const StatisticsExporter&) = delete;
+    StatisticsExporter& operator=(const StatisticsExporter&) = delete;
+    StatisticsExporter(StatisticsExporter&&) = delete;
+    StatisticsExporter& operator=(StatisticsExporter&&) = delete;
+    ~StatisticsExporter();
+    StatisticsExporter(std::chrono::milliseconds interval, StatisticsExportCallback callback);
+
+    bool Start();
+    void Stop();
+
+    void Register(const ApplicationClient& client);
+    /*
+        \brief This function waits for an export that is in progress, so the client may be destroyed once it returns
+    */
+    void Unregister(const ApplicationClient& client);
+
+private:
+
+    const std::chrono::milliseconds m_interval;
+    const StatisticsExportCallback m_callback;
+
+    std::mutex m_mutex;
+    std::condition_variable m_stop_condition;
+    bool m_running { false };
+    std::vector<const ApplicationClient*> m_clients;
+    std::thread m_thread;
+
+    void Run();
+};
+
+} // namespace InterProcessCommunication
@@ -0,0 +1,388 @@
+#include "basic_application_client.h"
+#include <gtest/gtest.h>
+#include <arpa/inet.h>
+#include <sys/un.h>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <semaphore>
+#include <vector>
+
+namespace InterProcessCommunication::Test
+{
+
+/*
+    A handler that is known at compile time. It collects the received bytes and records the connection events and errors.
+*/
+struct RecordingHandler
+{
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::string rx_bytes;
+    size_t connected_count = 0;
+    size_t disconnected_count = 0;
+    std::vector<Error> errors;
+
+    void OnReceive(std::span<char> bytes)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        rx_bytes.append(bytes.data(), bytes.size());
+        condition.notify_all();
+    }
+
+    void OnConnected()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++connected_count;
+    }
+
+    void OnDisconnected()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++disconnected_count;
+        condition.notify_all();
+    }
+
+    void OnError(Error error)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        errors.push_back(error);
+    }
+
+    bool WaitForRxBytes(size_t byte_count)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        return condition.wait_for(lock, std::chrono::seconds(5), [&]{ return rx_bytes.size() >= byte_count; });
+    }
+
+    bool WaitForDisconnected()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        return condition.wait_for(lock, std::chrono::seconds(5), [&]{ return disconnected_count > 0; });
+    }
+};
+
+// A handler without any of the optional functions
+struct CountingHandler
+{
+    std::atomic<size_t> rx_byte_count { 0 };
+
+    void OnReceive(std::span<char> bytes)
+    {
+        rx_byte_count += bytes.size();
+    }
+};
+
+class BasicApplicationClientTest : public ::testing::Test
+{
+public:
+    static constexpr std::chrono::milliseconds CLIENT_STATE_POLL_INTERVAL { 10 };
+    const std::string UNIX_SOCKET_PATH { "/tmp/basic_application_client_test_" + std::to_string(getpid()) + ".sock" };
+    const std::string IPV4_ADDRESS { "127.0.0.1" };
+    const uint16_t PORT = 5004;
+
+    void TearDown() override
+    {
+        close(m_client_file_descriptor);
+        close(m_server_file_descriptor);
+        unlink(UNIX_SOCKET_PATH.c_str());
+    }
+
+    void OpenUnixServer()
+    {
+        unlink(UNIX_SOCKET_PATH.c_str());
+
+        m_server_file_descriptor = socket(AF_UNIX, SOCK_STREAM, 0);
+        EXPECT_NE(m_server_file_descriptor, -1);
+
+        sockaddr_un address {};
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, UNIX_SOCKET_PATH.c_str(), sizeof(address.sun_path) - 1);
+
+        EXPECT_NE(bind(m_server_file_descriptor, (sockaddr*)&address, sizeof(address)),-1);
+        EXPECT_NE(listen(m_server_file_descriptor, 1),-1);
+    }
+
+    void OpenTcpServer()
+    {
+        m_server_file_descriptor = socket(AF_INET, SOCK_STREAM, 0);
+        EXPECT_NE(m_server_file_descriptor, -1);
+        sockaddr_in address{};
+
+        // Force the port to be freed after use by the server
+        const int server_socket_option = 1;
+        setsockopt(m_server_file_descriptor, SOL_SOCKET, SO_REUSEADDR, &server_socket_option, sizeof(server_socket_option));
+
+        address.sin_family = AF_INET;
+        inet_pton(AF_INET, IPV4_ADDRESS.c_str(), &address.sin_addr);
+        address.sin_port = htons(PORT);
+
+        EXPECT_NE(bind(m_server_file_descriptor, (sockaddr*)&address, sizeof(address)),-1);
+        EXPECT_NE(listen(m_server_file_descriptor, 1),-1);
+    }
+
+    template <typename Client>
+    void ConnectClient(Client& client)
+    {
+        EXPECT_TRUE(client.Connect());
+        EXPECT_TRUE(client.IsConnected());
+
+        m_client_file_descriptor = accept(m_server_file_descriptor, nullptr, nullptr);
+        EXPECT_NE(m_client_file_descriptor, -1);
+    }
+
+    std::string ReadBytes(size_t byte_count)
+    {
+        std::string bytes(byte_count, '\0');
+        size_t read_bytes = 0;
+
+        while(read_bytes < byte_count)
+        {
+            const ssize_t result = recv(m_client_file_descriptor, bytes.data() + read_bytes, byte_count - read_bytes, 0);
+
+            if(result <= 0)
+            {
+                break;
+            }
+
+            read_bytes += result;
+        }
+
+        bytes.resize(read_bytes);
+        return bytes;
+    }
+
+protected:
+    int m_server_file_descriptor { -1 };
+    int m_client_file_descriptor { -1 };
+};
+
+TEST_F(BasicApplicationClientTest, ExchangeBytesThroughInlineHandler)
+{
+    OpenUnixServer();
+
+    BasicApplicationClient<UnixTransport, RecordingHandler> client(UnixTransport::Endpoint { UNIX_SOCKET_PATH });
+    ConnectClient(client);
+
+    const std::string request = "request";
+    EXPECT_TRUE(client.Send(std::span<const char>(request.data(), request.size())));
+    EXPECT_EQ(ReadBytes(request.size()), request);
+
+    const std::string reply = "reply";
+    EXPECT_EQ(send(m_client_file_descriptor, reply.data(), reply.size(), 0), (ssize_t)reply.size());
+
+    RecordingHandler& handler = client.GetHandler();
+    EXPECT_TRUE(handler.WaitForRxBytes(reply.size()));
+
+    std::lock_guard<std::mutex> lock(handler.mutex);
+    EXPECT_EQ(handler.rx_bytes, reply);
+    EXPECT_EQ(handler.connected_count, 1u);
+    EXPECT_TRUE(handler.errors.empty());
+}
+
+TEST_F(BasicApplicationClientTest, ExchangeBytesThroughFunctionHandler)
+{
+    OpenTcpServer();
+
+    std::atomic<size_t> rx_byte_count { 0 };
+    std::atomic<size_t> connected_count { 0 };
+
+    FunctionHandler handler;
+    handler.rx_callback = [&](std::span<char> bytes){ rx_byte_count += bytes.size(); };
+    handler.connected_callback = [&](){ ++connected_count; };
+
+    BasicApplicationClient<TcpTransport, FunctionHandler> client(TcpTransport::Endpoint { IPV4_ADDRESS, PORT }, std::move(handler));
+    ConnectClient(client);
+
+    const std::string request(100000, 'x');
+    EXPECT_TRUE(client.Send(std::span<const char>(request.data(), request.size())));
+    EXPECT_EQ(ReadBytes(request.size()), request);
+
+    EXPECT_EQ(send(m_client_file_descriptor, request.data(), 1000, 0), 1000);
+
+    while(rx_byte_count < 1000)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    EXPECT_EQ(connected_count, 1u);
+}
+
+TEST_F(BasicApplicationClientTest, CallOnlyDefinedHandlerFunctions)
+{
+    OpenUnixServer();
+
+    BasicApplicationClient<UnixTransport, CountingHandler> client(UnixTransport::Endpoint { UNIX_SOCKET_PATH });
+    ConnectClient(client);
+
+    EXPECT_EQ(send(m_client_file_descriptor, "abc", 3, 0), 3);
+
+    while(client.GetHandler().rx_byte_count < 3)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    client.Close();
+    EXPECT_FALSE(client.IsConnected());
+}
+
+TEST_F(BasicApplicationClientTest, DisconnectWhenPeerCloses)
+{
+    OpenUnixServer();
+
+    BasicApplicationClient<UnixTransport, RecordingHandler> client(UnixTransport::Endpoint { UNIX_SOCKET_PATH });
+    ConnectClient(client);
+
+    close(m_client_file_descriptor);
+    m_client_file_descriptor = -1;
+
+    EXPECT_TRUE(client.GetHandler().WaitForDisconnected());
+    EXPECT_FALSE(client.IsConnected());
+
+    const std::string payload = "late";
+    EXPECT_FALSE(client.Send(std::span<const char>(payload.data(), payload.size())));
+
+    // The client connects again once the previous connection has ended
+    ConnectClient(client);
+    EXPECT_TRUE(client.Send(std::span<const char>(payload.data(), payload.size())));
+    EXPECT_EQ(ReadBytes(payload.size()), payload);
+
+    std::lock_guard<std::mutex> lock(client.GetHandler().mutex);
+    EXPECT_EQ(client.GetHandler().connected_count, 2u);
+    EXPECT_TRUE(client.GetHandler().errors.empty());
+}
+
+TEST_F(BasicApplicationClientTest, DisconnectOnceWhenClosed)
+{
+    OpenUnixServer();
+
+    BasicApplicationClient<UnixTransport, RecordingHandler> client(UnixTransport::Endpoint { UNIX_SOCKET_PATH });
+    ConnectClient(client);
+
+    client.Close();
+    client.Close();
+
+    EXPECT_FALSE(client.IsConnected());
+    EXPECT_EQ(ReadBytes(1), "");
+
+    // Close() has waited for the RX thread, which has reported the end of the connection
+    std::lock_guard<std::mutex> lock(client.GetHandler().mutex);
+    EXPECT_EQ(client.GetHandler().disconnected_count, 1u);
+    EXPECT_TRUE(client.GetHandler().errors.empty());
+}
+
+TEST_F(BasicApplicationClientTest, CloseWhileSendIsBlocked)
+{
+    OpenUnixServer();
+
+    BasicApplicationClient<UnixTransport, RecordingHandler> client(UnixTransport::Endpoint { UNIX_SOCKET_PATH });
+    ConnectClient(client);
+
+    // The peer never reads, so the send blocks once the socket's buffers are full
+    const std::vector<char> payload(64 * 1024 * 1024, 'x');
+    std::atomic<bool> is_sent { true };
+
+    std::thread sending_thread([&]()
+    {
+        is_sent = client.Send(std::span<const char>(payload.data(), payload.size()));
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    client.Close();
+    sending_thread.join();
+
+    EXPECT_FALSE(is_sent);
+    EXPECT_FALSE(client.IsConnected());
+
+    // The interrupted send is not a connection error
+    std::lock_guard<std::mutex> lock(client.GetHandler().mutex);
+    EXPECT_EQ(client.GetHandler().disconnected_count, 1u);
+    EXPECT_TRUE(client.GetHandler().errors.empty());
+}
+
+TEST_F(BasicApplicationClientTest, CloseFromHandlerWhileDestroyed)
+{
+    OpenUnixServer();
+
+    using Client = BasicApplicationClient<UnixTransport, FunctionHandler>;
+
+    std::unique_ptr<Client> client;
+    // The unique_ptr is already empty while it destroys the client
+    Client* client_pointer = nullptr;
+    std::binary_semaphore rx_semaphore(0);
+
+    FunctionHandler handler;
+    handler.rx_callback = [&](std::span<char>)
+    {
+        rx_semaphore.release();
+
+        // Give the owner time to get into the destructor, which waits for this thread
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        client_pointer->Close();
+    };
+
+    client = std::make_unique<Client>(UnixTransport::Endpoint { UNIX_SOCKET_PATH }, std::move(handler));
+    client_pointer = client.get();
+    ConnectClient(*client);
+
+    EXPECT_EQ(send(m_client_file_descriptor, "abc", 3, 0), 3);
+    EXPECT_TRUE(rx_semaphore.try_acquire_for(std::chrono::seconds(5)));
+
+    client.reset();
+}
+
+TEST_F(BasicApplicationClientTest, CloseFromHandlerWhileConnecting)
+{
+    OpenUnixServer();
+
+    using Client = BasicApplicationClient<UnixTransport, FunctionHandler>;
+
+    std::unique_ptr<Client> client;
+    std::binary_semaphore disconnected_semaphore(0);
+    std::atomic<size_t> disconnected_count { 0 };
+
+    FunctionHandler handler;
+    handler.disconnected_callback = [&]()
+    {
+        if(++disconnected_count > 1)
+        {
+            return;
+        }
+
+        disconnected_semaphore.release();
+
+        // Give the owner time to get into Connect(), which waits for this thread
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        client->Close();
+    };
+
+    client = std::make_unique<Client>(UnixTransport::Endpoint { UNIX_SOCKET_PATH }, std::move(handler));
+    ConnectClient(*client);
+
+    close(m_client_file_descriptor);
+    m_client_file_descriptor = -1;
+
+    EXPECT_TRUE(disconnected_semaphore.try_acquire_for(std::chrono::seconds(5)));
+
+    ConnectClient(*client);
+    EXPECT_TRUE(client->IsConnected());
+}
+
+TEST_F(BasicApplicationClientTest, ReportConnectFailure)
+{
+    unlink(UNIX_SOCKET_PATH.c_str());
+
+    BasicApplicationClient<UnixTransport, RecordingHandler> client(UnixTransport::Endpoint { UNIX_SOCKET_PATH });
+
+    EXPECT_FALSE(client.Connect());
+    EXPECT_FALSE(client.IsConnected());
+
+    std::lock_guard<std::mutex> lock(client.GetHandler().mutex);
+    ASSERT_EQ(client.GetHandler().errors.size(), 1u);
+    EXPECT_EQ(client.GetHandler().errors.front(), Error::SOCKET_CONNECT_FAILURE);
+    EXPECT_EQ(client.GetHandler().connected_count, 0u);
+}
+
+} // namespace InterProcessCommunication::Test
@@ -0,0 +1,53 @@
+#include "callback_executor.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <semaphore>
+
+namespace InterProcessCommunication::Test
+{
+
+TEST(CallbackExecutorTest, RunEveryTaskBeforeStopping)
+{
+    constexpr size_t TASK_COUNT = 1000;
+
+    std::atomic<size_t> executed_tasks { 0 };
+
+    {
+        ThreadPoolExecutor executor(3);
+        EXPECT_EQ(executor.GetThreadCount(), 3);
+
+        for(size_t count = 0; count < TASK_COUNT; ++count)
+        {
+            executor.Execute([&](){ ++executed_tasks; });
+        }
+    }
+
+    EXPECT_EQ(executed_tasks, TASK_COUNT);
+}
+
+TEST(CallbackExecutorTest, StartAtLeastOneThread)
+{
+    ThreadPoolExecutor executor(0);
+    EXPECT_EQ(executor.GetThreadCount(), 1);
+
+    std::binary_semaphore task_semaphore(0);
+    executor.Execute([&](){ task_semaphore.release(); });
+
+    EXPECT_TRUE(task_semaphore.try_acquire_for(std::chrono::seconds(5)));
+}
+
+TEST(CallbackExecutorTest, QueueTasksFromRunningTask)
+{
+    std::binary_semaphore task_semaphore(0);
+    ThreadPoolExecutor executor;
+
+    executor.Execute([&]()
+    {
+        executor.Execute([&](){ task_semaphore.release(); });
+    });
+
+    EXPECT_TRUE(task_semaphore.try_acquire_for(std::chrono::seconds(5)));
+}
+
+} // namespace InterProcessCommunication::Test
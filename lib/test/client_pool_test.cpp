@@ -0,0 +1,242 @@
+#include "client_pool.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <semaphore>
+#include <vector>
+
+namespace InterProcessCommunication::Test
+{
+
+class ClientPoolTest : public ::testing::Test
+{
+public:
+    static constexpr std::chrono::milliseconds CLIENT_STATE_POLL_INTERVAL { 10 };
+    static constexpr int BUFFER_SIZE = 1024;
+    const std::string IPV4_ADDRESS { "127.0.0.1" };
+    const uint16_t PORT = 5003;
+
+    void TearDown() override
+    {
+        for(int client_file_descriptor : m_client_file_descriptors)
+        {
+            close(client_file_descriptor);
+        }
+
+        close(m_server_file_descriptor);
+    }
+
+    void OpenServer(int connection_limit)
+    {
+        m_server_file_descriptor = socket(AF_INET, SOCK_STREAM, 0);
+        EXPECT_NE(m_server_file_descriptor, -1);
+        sockaddr_in address{};
+
+        // Force the port to be freed after use by the server
+        const int server_socket_option = 1;
+        setsockopt(m_server_file_descriptor, SOL_SOCKET, SO_REUSEADDR, &server_socket_option, sizeof(server_socket_option));
+
+        address.sin_family = AF_INET;
+        inet_pton(AF_INET, IPV4_ADDRESS.c_str(), &address.sin_addr);
+        address.sin_port = htons(PORT);
+
+        EXPECT_NE(bind(m_server_file_descriptor, (sockaddr*)&address, sizeof(address)),-1);
+        EXPECT_NE(listen(m_server_file_descriptor, connection_limit),-1);
+    }
+
+    void StartAndConnect(ClientPool& pool)
+    {
+        EXPECT_TRUE(pool.Start());
+
+        while(not pool.IsRunning())
+        {
+            std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+        }
+
+        EXPECT_TRUE(pool.RequestOpen());
+
+        for(size_t count = 0; count < pool.GetConnectionCount(); ++count)
+        {
+            const int client_file_descriptor = accept(m_server_file_descriptor, nullptr, nullptr);
+            EXPECT_NE(client_file_descriptor, -1);
+            m_client_file_descriptors.push_back(client_file_descriptor);
+        }
+
+        while(pool.GetConnectedCount() != pool.GetConnectionCount())
+        {
+            std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+        }
+    }
+
+    // Reads whatever has arrived on the connection, once every payload has been reported as sent
+    std::string ReadAvailableBytes(int client_file_descriptor)
+    {
+        std::string received_bytes;
+        std::vector<char> buffer(BUFFER_SIZE);
+        ssize_t bytes = 0;
+
+        // The kernel has accepted every byte before the completions ran, but loopback delivery may still be under way
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+
+        while((bytes = recv(client_file_descriptor, buffer.data(), buffer.size(), MSG_DONTWAIT)) > 0)
+        {
+            received_bytes += std::string(buffer.data(), bytes);
+        }
+
+        return received_bytes;
+    }
+
+protected:
+    std::vector<int> m_client_file_descriptors;
+    int m_server_file_descriptor { -1 };
+};
+
+TEST_F(ClientPoolTest, DistributePayloadsRoundRobin)
+{
+    ClientPoolOptions options;
+    options.connection_count = 3;
+
+    ClientPool pool {IPV4_ADDRESS, PORT, options};
+
+    OpenServer(options.connection_count);
+    StartAndConnect(pool);
+
+    const size_t payload_count = 3 * options.connection_count;
+    std::counting_semaphore<> completion_semaphore(0);
+
+    for(size_t count = 0; count < payload_count; ++count)
+    {
+        std::string payload = "<" + std::to_string(count) + ">";
+
+        EXPECT_TRUE(pool.EnqueuePayload(std::span<char>(payload), [&](bool is_sent)
+        {
+            EXPECT_TRUE(is_sent);
+            completion_semaphore.release();
+        }));
+    }
+
+    for(size_t count = 0; count < payload_count; ++count)
+    {
+        completion_semaphore.acquire();
+    }
+
+    // Every connection takes every third payload, and the connections together took all of them
+    std::string all_received_bytes;
+
+    for(int client_file_descriptor : m_client_file_descriptors)
+    {
+        const std::string received_bytes = ReadAvailableBytes(client_file_descriptor);
+
+        EXPECT_EQ(std::count(received_bytes.begin(), received_bytes.end(), '<'), 3);
+        all_received_bytes += received_bytes;
+    }
+
+    for(size_t count = 0; count < payload_count; ++count)
+    {
+        EXPECT_NE(all_received_bytes.find("<" + std::to_string(count) + ">"), std::string::npos);
+    }
+
+    EXPECT_TRUE(pool.RequestClose());
+}
+
+TEST_F(ClientPoolTest, KeepKeyedPayloadsInOrderOnOneConnection)
+{
+    ClientPoolOptions options;
+    options.connection_count = 3;
+    options.distribution = PoolDistribution::LEAST_QUEUED;
+
+    ClientPool pool {IPV4_ADDRESS, PORT, options};
+
+    OpenServer(options.connection_count);
+    StartAndConnect(pool);
+
+    const size_t payload_count = 100;
+    const uint64_t key = 42;
+    std::counting_semaphore<> completion_semaphore(0);
+    std::string expected_bytes;
+
+    for(size_t count = 0; count < payload_count; ++count)
+    {
+        std::string payload = "<" + std::to_string(count) + ">";
+        expected_bytes += payload;
+
+        EXPECT_TRUE(pool.EnqueueKeyedPayload(key, std::span<char>(payload), [&](bool is_sent)
+        {
+            EXPECT_TRUE(is_sent);
+            completion_semaphore.release();
+        }));
+    }
+
+    for(size_t count = 0; count < payload_count; ++count)
+    {
+        completion_semaphore.acquire();
+    }
+
+    std::vector<std::string> received_bytes;
+
+    for(int client_file_descriptor : m_client_file_descriptors)
+    {
+        received_bytes.push_back(ReadAvailableBytes(client_file_descriptor));
+    }
+
+    // One connection took every payload of the key, in the order they were enqueued
+    EXPECT_EQ(std::count(received_bytes.begin(), received_bytes.end(), expected_bytes), 1);
+    EXPECT_EQ(std::count(received_bytes.begin(), received_bytes.end(), std::string()), options.connection_count - 1);
+
+    EXPECT_TRUE(pool.RequestClose());
+}
+
+TEST_F(ClientPoolTest, SkipConnectionsThatAreDown)
+{
+    ClientPoolOptions options;
+    options.connection_count = 2;
+
+    ClientPool pool {IPV4_ADDRESS, PORT, options};
+
+    std::vector<size_t> disconnected_indices;
+    std::binary_semaphore disconnected_semaphore(0);
+
+    pool.SetDisconnectedCallback([&](size_t connection_index)
+    {
+        disconnected_indices.push_back(connection_index);
+        disconnected_semaphore.release();
+    });
+
+    OpenServer(options.connection_count);
+    StartAndConnect(pool);
+
+    EXPECT_TRUE(pool.GetClient(1).RequestClose());
+    disconnected_semaphore.acquire();
+
+    EXPECT_EQ(disconnected_indices, std::vector<size_t>({1}));
+    EXPECT_EQ(pool.GetConnectedCount(), 1);
+
+    // A payload that went to the closed connection would not be sent
+    const size_t payload_count = 4;
+    std::counting_semaphore<> completion_semaphore(0);
+
+    for(size_t count = 0; count < payload_count; ++count)
+    {
+        std::string payload = "<" + std::to_string(count) + ">";
+
+        EXPECT_TRUE(pool.EnqueuePayload(std::span<char>(payload), [&](bool is_sent)
+        {
+            EXPECT_TRUE(is_sent);
+            completion_semaphore.release();
+        }));
+    }
+
+    for(size_t count = 0; count < payload_count; ++count)
+    {
+        completion_semaphore.acquire();
+    }
+
+    // The other connection is already closed
+    EXPECT_TRUE(pool.GetClient(0).RequestClose());
+
+    while(pool.GetConnectedCount() != 0)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+}
+
+} // namespace InterProcessCommunication::Test
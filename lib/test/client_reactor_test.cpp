@@ -0,0 +1,656 @@
+#include "application_client.h"
+#include "client_reactor.h"
+#include "client_task.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <memory>
+#include <semaphore>
+#include <vector>
+
+namespace InterProcessCommunication::Test
+{
+
+// Every test runs against both backends. Where io_uring is unavailable, the IO_URING instance exercises the fallback to epoll.
+class ClientReactorTest : public ::testing::TestWithParam<ReactorBackend>
+{
+public:
+    static constexpr std::chrono::milliseconds CLIENT_STATE_POLL_INTERVAL { 10 };
+    static constexpr int BUFFER_SIZE = 1024;
+    static constexpr size_t EVENT_LOOP_COUNT = 2;
+    const std::string IPV4_ADDRESS { "127.0.0.1" };
+    const uint16_t PORT = 5001;
+    ClientReactor m_reactor {EVENT_LOOP_COUNT, GetParam()};
+
+    void SetUp() override
+    {
+        EXPECT_TRUE(m_reactor.Start());
+    }
+
+    void TearDown() override
+    {
+        for(int client_file_descriptor : m_client_file_descriptors)
+        {
+            close(client_file_descriptor);
+        }
+
+        close(m_server_file_descriptor);
+    }
+
+    void OpenServer(int connection_limit)
+    {
+        m_server_file_descriptor = socket(AF_INET, SOCK_STREAM, 0);
+        EXPECT_NE(m_server_file_descriptor, -1);
+        sockaddr_in address{};
+
+        // Force the port to be freed after use by the server
+        const int server_socket_option = 1;
+        setsockopt(m_server_file_descriptor, SOL_SOCKET, SO_REUSEADDR, &server_socket_option, sizeof(server_socket_option));
+
+        address.sin_family = AF_INET;
+        inet_pton(AF_INET, IPV4_ADDRESS.c_str(), &address.sin_addr);
+        address.sin_port = htons(PORT);
+
+        EXPECT_NE(bind(m_server_file_descriptor, (sockaddr*)&address, sizeof(address)),-1);
+        EXPECT_NE(listen(m_server_file_descriptor, connection_limit),-1);
+    }
+
+    void AcceptConnections(int connection_limit)
+    {
+        for(int count = 0; count < connection_limit; ++count)
+        {
+            const int client_file_descriptor = accept(m_server_file_descriptor, nullptr, nullptr);
+            EXPECT_NE(client_file_descriptor, -1);
+            m_client_file_descriptors.push_back(client_file_descriptor);
+        }
+    }
+
+    std::string ReadPayload(int client_file_descriptor, size_t expected_size)
+    {
+        std::string received_payload;
+
+        while(received_payload.size() < expected_size)
+        {
+            std::vector<char> buffer(BUFFER_SIZE);
+
+            const ssize_t bytes = read(client_file_descriptor, buffer.data(), buffer.size());
+
+            EXPECT_GT(bytes, 0);
+
+            if(bytes <= 0)
+            {
+                break;
+            }
+
+            received_payload += std::string(buffer.data(), bytes);
+        }
+
+        return received_payload;
+    }
+
+    void WaitForClientState(const ApplicationClient& client, ClientState client_state)
+    {
+        while(client.GetClientState() != client_state)
+        {
+            std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+        }
+    }
+
+protected:
+    std::vector<int> m_client_file_descriptors;
+    int m_server_file_descriptor { -1 };
+};
+
+TEST_P(ClientReactorTest, ConnectAndDisconnect)
+{
+    ApplicationClient client {IPV4_ADDRESS, PORT};
+
+    OpenServer(1);
+
+    int connected_count = 0;
+    int disconnected_count = 0;
+
+    client.SetConnectionCallback([&](){ ++connected_count; });
+    client.SetDisconnectedCallback([&](){ ++disconnected_count; });
+
+    EXPECT_TRUE(client.Start(m_reactor));
+    EXPECT_TRUE(client.IsRunning());
+
+    // Starting twice is rejected, whether with the reactor or with worker threads
+    EXPECT_FALSE(client.Start(m_reactor));
+    EXPECT_FALSE(client.Start());
+
+    EXPECT_TRUE(client.RequestOpen());
+
+    WaitForClientState(client, ClientState::CONNECTED);
+
+    AcceptConnections(1);
+
+    EXPECT_TRUE(client.RequestClose());
+
+    WaitForClientState(client, ClientState::NOT_CONNECTED);
+
+    EXPECT_EQ(connected_count, 1);
+    EXPECT_EQ(disconnected_count, 1);
+}
+
+TEST_P(ClientReactorTest, SendMessagesFromManyClients)
+{
+    const int client_count = 8;
+    const size_t message_count = 100;
+
+    OpenServer(client_count);
+
+    std::vector<std::unique_ptr<ApplicationClient>> clients;
+    std::vector<std::string> expected_payloads;
+
+    for(int client_index = 0; client_index < client_count; ++client_index)
+    {
+        clients.emplace_back(std::make_unique<ApplicationClient>(IPV4_ADDRESS, PORT));
+        EXPECT_TRUE(clients.back()->Start(m_reactor));
+        EXPECT_TRUE(clients.back()->RequestOpen());
+    }
+
+    AcceptConnections(client_count);
+
+    for(int client_index = 0; client_index < client_count; ++client_index)
+    {
+        WaitForClientState(*clients[client_index], ClientState::CONNECTED);
+
+        std::string total_payload;
+
+        for(size_t count = 0; count < message_count; ++count)
+        {
+            std::string message = "<client " + std::to_string(client_index) + " message " + std::to_string(count) + ">";
+            total_payload += message;
+            EXPECT_TRUE(clients[client_index]->EnqueuePayload(std::span<char>(message)));
+        }
+
+        expected_payloads.push_back(total_payload);
+    }
+
+    std::vector<std::string> received_payloads;
+
+    // The accepted connections are not in client order, but every client sends a distinct payload
+    for(const int client_file_descriptor : m_client_file_descriptors)
+    {
+        std::string received_payload;
+
+        while(std::find(expected_payloads.begin(), expected_payloads.end(), received_payload) == expected_payloads.end())
+        {
+            std::vector<char> buffer(BUFFER_SIZE);
+            const ssize_t bytes = read(client_file_descriptor, buffer.data(), buffer.size());
+
+            EXPECT_GT(bytes, 0);
+
+            if(bytes <= 0)
+            {
+                break;
+            }
+
+            received_payload += std::string(buffer.data(), bytes);
+        }
+
+        received_payloads.push_back(received_payload);
+    }
+
+    std::sort(expected_payloads.begin(), expected_payloads.end());
+    std::sort(received_payloads.begin(), received_payloads.end());
+
+    EXPECT_EQ(received_payloads, expected_payloads);
+
+    for(const std::unique_ptr<ApplicationClient>& client : clients)
+    {
+        EXPECT_TRUE(client->RequestClose());
+        WaitForClientState(*client, ClientState::NOT_CONNECTED);
+    }
+}
+
+TEST_P(ClientReactorTest, SendBatchedPayloadsWithPartialWrites)
+{
+    ClientOptions options;
+    options.tx_batch.enabled = true;
+
+    ApplicationClient client {IPV4_ADDRESS, PORT, options};
+
+    OpenServer(1);
+
+    EXPECT_TRUE(client.Start(m_reactor));
+    EXPECT_TRUE(client.RequestOpen());
+
+    AcceptConnections(1);
+
+    WaitForClientState(client, ClientState::CONNECTED);
+
+    // Queue far more than the socket buffers can hold so that writes are cut short in the middle of payloads
+    std::string total_payload;
+
+    for(size_t count = 0; count < 400; ++count)
+    {
+        std::string message = "<" + std::to_string(count) + std::string((count * 7919) % 20000, static_cast<char>('a' + count % 26)) + ">";
+        total_payload += message;
+        EXPECT_TRUE(client.EnqueuePayload(std::span<char>(message)));
+    }
+
+    EXPECT_EQ(ReadPayload(m_client_file_descriptors.front(), total_payload.size()), total_payload);
+
+    EXPECT_TRUE(client.RequestClose());
+
+    WaitForClientState(client, ClientState::NOT_CONNECTED);
+}
+
+TEST_P(ClientReactorTest, SendBatchedFramesWithPartialWrites)
+{
+    ClientOptions options;
+    options.tx_batch.enabled = true;
+    options.framing.enabled = true;
+    options.framing.header_size = FrameHeaderSize::EIGHT_BYTES;
+
+    ApplicationClient client {IPV4_ADDRESS, PORT, options};
+
+    OpenServer(1);
+
+    EXPECT_TRUE(client.Start(m_reactor));
+    EXPECT_TRUE(client.RequestOpen());
+
+    AcceptConnections(1);
+
+    WaitForClientState(client, ClientState::CONNECTED);
+
+    // Writes are cut short at arbitrary points, including in the middle of frame headers
+    std::string total_payload;
+
+    for(size_t count = 0; count < 400; ++count)
+    {
+        std::string message = "<" + std::to_string(count) + std::string((count * 7919) % 20000, static_cast<char>('a' + count % 26)) + ">";
+        FrameHeader header {};
+        const size_t header_size = EncodeFrameHeader(options.framing, message.size(), header);
+
+        total_payload += std::string(header.data(), header_size) + message;
+        EXPECT_TRUE(client.EnqueuePayload(std::span<char>(message)));
+    }
+
+    EXPECT_EQ(ReadPayload(m_client_file_descriptors.front(), total_payload.size()), total_payload);
+
+    EXPECT_TRUE(client.RequestClose());
+
+    WaitForClientState(client, ClientState::NOT_CONNECTED);
+}
+
+TEST_P(ClientReactorTest, ReadLargeMessage)
+{
+    ApplicationClient client {IPV4_ADDRESS, PORT};
+
+    const std::string message (8196, 'x');
+    std::string received_bytes;
+    std::binary_semaphore callback_semaphore(0);
+
+    client.SetRxCallback([&](const std::span<char>& rx_payload_view)
+    {
+        received_bytes += std::string(rx_payload_view.data(), rx_payload_view.size());
+
+        if(received_bytes.size() == message.size())
+        {
+            callback_semaphore.release();
+        }
+    });
+
+    OpenServer(1);
+
+    EXPECT_TRUE(client.Start(m_reactor));
+    EXPECT_TRUE(client.RequestOpen());
+
+    AcceptConnections(1);
+
+    EXPECT_EQ(send(m_client_file_descriptors.front(), message.data(), message.size(), 0), static_cast<ssize_t>(message.size()));
+
+    // wait for the RX callback to receive the whole message
+    callback_semaphore.acquire();
+
+    EXPECT_EQ(message, received_bytes);
+
+    EXPECT_TRUE(client.RequestClose());
+
+    WaitForClientState(client, ClientState::NOT_CONNECTED);
+}
+
+TEST_P(ClientReactorTest, ExchangeMessagesInCoroutine)
+{
+    ApplicationClient client {IPV4_ADDRESS, PORT};
+
+    const std::string request = "ping";
+    const std::string reply = "pong";
+
+    OpenServer(1);
+
+    EXPECT_TRUE(client.Start(m_reactor));
+
+    std::vector<bool> results;
+    std::vector<std::string> received_messages;
+
+    // Every resumption after the first suspension runs on the reactor's event loop
+    const auto exchange_messages = [&]() -> ClientTask
+    {
+        results.push_back(co_await client.Connect());
+        results.push_back(co_await client.Send(std::span<const char>(request)));
+
+        for(RxMessage rx_message = co_await client.Receive(); not rx_message.bytes.empty(); rx_message = co_await client.Receive())
+        {
+            received_messages.emplace_back(rx_message.bytes.data(), rx_message.bytes.size());
+        }
+    };
+
+    ClientTask task = exchange_messages();
+
+    AcceptConnections(1);
+
+    EXPECT_EQ(ReadPayload(m_client_file_descriptors.front(), request.size()), request);
+    EXPECT_EQ(send(m_client_file_descriptors.front(), reply.data(), reply.size(), 0), static_cast<ssize_t>(reply.size()));
+
+    // Closing the connection from the server's side ends the coroutine
+    shutdown(m_client_file_descriptors.front(), SHUT_RDWR);
+
+    task.Wait();
+
+    EXPECT_EQ(results, std::vector<bool>({true, true}));
+    EXPECT_EQ(received_messages, std::vector<std::string>({reply}));
+}
+
+TEST_P(ClientReactorTest, DisconnectedByServer)
+{
+    ApplicationClient client {IPV4_ADDRESS, PORT};
+
+    std::binary_semaphore callback_semaphore(0);
+
+    client.SetDisconnectedCallback([&]()
+    {
+        callback_semaphore.release();
+    });
+
+    OpenServer(1);
+
+    EXPECT_TRUE(client.Start(m_reactor));
+    EXPECT_TRUE(client.RequestOpen());
+
+    AcceptConnections(1);
+
+    WaitForClientState(client, ClientState::CONNECTED);
+
+    // Sever the connection from the server's side
+    shutdown(m_client_file_descriptors.front(), SHUT_RDWR);
+
+    callback_semaphore.acquire();
+
+    EXPECT_EQ(client.GetClientState(), ClientState::NOT_CONNECTED);
+}
+
+TEST_P(ClientReactorTest, ReconnectAndReplayQueuedPayloads)
+{
+    ClientOptions options;
+    options.reconnect.enabled = true;
+    options.reconnect.initial_delay = std::chrono::milliseconds(20);
+
+    ApplicationClient client {IPV4_ADDRESS, PORT, options};
+
+    std::string message = "sent while reconnecting";
+    std::binary_semaphore callback_semaphore(0);
+
+    client.SetDisconnectedCallback([&]()
+    {
+        callback_semaphore.release();
+    });
+
+    OpenServer(2);
+
+    EXPECT_TRUE(client.Start(m_reactor));
+    EXPECT_TRUE(client.RequestOpen());
+
+    AcceptConnections(1);
+
+    WaitForClientState(client, ClientState::CONNECTED);
+
+    shutdown(m_client_file_descriptors.front(), SHUT_RDWR);
+
+    callback_semaphore.acquire();
+
+    // Enqueued while the client waits for its first reconnect attempt
+    EXPECT_TRUE(client.EnqueuePayload(std::span<char>(message)));
+
+    AcceptConnections(1);
+
+    EXPECT_EQ(ReadPayload(m_client_file_descriptors.back(), message.size()), message);
+
+    WaitForClientState(client, ClientState::CONNECTED);
+
+    if constexpr(ClientStatisticsRecorder::IS_COMPILED_IN)
+    {
+        EXPECT_GE(client.GetStatistics().reconnect_attempts, 1);
+        EXPECT_GT(client.GetStatistics().last_time_to_reconnect_nanoseconds, 0);
+    }
+
+    EXPECT_TRUE(client.RequestClose());
+
+    WaitForClientState(client, ClientState::NOT_CONNECTED);
+}
+
+TEST_P(ClientReactorTest, RunDelayedTasksUnlessCancelled)
+{
+    std::binary_semaphore task_semaphore(0);
+    std::atomic<bool> is_cancelled_task_run { false };
+
+    const std::chrono::steady_clock::time_point post_time = std::chrono::steady_clock::now();
+
+    const ReactorTimerId cancelled_timer_id = m_reactor.PostAfter(0, std::chrono::milliseconds(50), [&]()
+    {
+        is_cancelled_task_run = true;
+    });
+
+    m_reactor.PostAfter(0, std::chrono::milliseconds(100), [&]()
+    {
+        task_semaphore.release();
+    });
+
+    EXPECT_NE(cancelled_timer_id, 0);
+
+    m_reactor.Post(0, [&]()
+    {
+        m_reactor.CancelTimer(0, cancelled_timer_id);
+    });
+
+    task_semaphore.acquire();
+
+    EXPECT_GE(std::chrono::steady_clock::now() - post_time, std::chrono::milliseconds(100));
+    EXPECT_FALSE(is_cancelled_task_run);
+}
+
+TEST_P(ClientReactorTest, TimeOutConnectingToUnresponsiveServer)
+{
+    ClientOptions options;
+    options.connect.timeout = std::chrono::milliseconds(100);
+
+    ApplicationClient client {IPV4_ADDRESS, PORT, options};
+
+    std::binary_semaphore callback_semaphore(0);
+
+    client.SetErrorCallback([&](const Error& error, const std::optional<std::span<char>>& failed_tx_payload)
+    {
+        EXPECT_EQ(Error::SOCKET_CONNECT_FAILURE, error);
+        EXPECT_FALSE(failed_tx_payload.has_value());
+        callback_semaphore.release();
+    });
+
+    // A full accept queue drops the client's SYN, so the attempt hangs until it times out
+    OpenServer(0);
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    inet_pton(AF_INET, IPV4_ADDRESS.c_str(), &address.sin_addr);
+    address.sin_port = htons(PORT);
+
+    for(int count = 0; count < 2; ++count)
+    {
+        m_client_file_descriptors.push_back(socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0));
+        connect(m_client_file_descriptors.back(), (sockaddr*)&address, sizeof(address));
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    EXPECT_TRUE(client.Start(m_reactor));
+    EXPECT_TRUE(client.RequestOpen());
+
+    EXPECT_TRUE(callback_semaphore.try_acquire_for(std::chrono::seconds(5)));
+
+    WaitForClientState(client, ClientState::NOT_CONNECTED);
+}
+
+TEST_P(ClientReactorTest, FailSendingMessageBeforeConnecting)
+{
+    ApplicationClient client {IPV4_ADDRESS, PORT};
+
+    std::string message = "hello there";
+    std::binary_semaphore callback_semaphore(0);
+
+    client.SetErrorCallback([&](const Error& error, const std::optional<std::span<char>>& failed_tx_payload)
+    {
+        EXPECT_EQ(Error::SOCKET_SEND_FAILURE, error);
+        EXPECT_TRUE(failed_tx_payload.has_value());
+
+        const std::span<char> failed_tx_payload_vec = failed_tx_payload.value();
+        EXPECT_EQ(std::string(failed_tx_payload_vec.data(), failed_tx_payload_vec.size()), message);
+
+        callback_semaphore.release();
+    });
+
+    EXPECT_TRUE(client.Start(m_reactor));
+
+    EXPECT_TRUE(client.EnqueuePayload(std::span<char>(message)));
+
+    callback_semaphore.acquire();
+}
+
+TEST_P(ClientReactorTest, KeepServingOtherClientsWhileRxDispatchIsFull)
+{
+    constexpr size_t MESSAGE_COUNT = 20;
+
+    // Both clients share the only event loop, which must not wait for the slow client's executor
+    ClientReactor reactor {1, GetParam()};
+    EXPECT_TRUE(reactor.Start());
+
+    ClientOptions slow_options;
+    slow_options.framing.enabled = true;
+    slow_options.rx_dispatch.enabled = true;
+    slow_options.rx_dispatch.max_queued_messages = 4;
+
+    ApplicationClient slow_client {IPV4_ADDRESS, PORT, slow_options};
+    ApplicationClient fast_client {IPV4_ADDRESS, PORT};
+
+    std::vector<std::string> slow_messages;
+    std::binary_semaphore release_semaphore(0);
+    std::binary_semaphore slow_rx_semaphore(0);
+
+    slow_client.SetRxCallback([&](const std::span<char>& rx_bytes)
+    {
+        if(slow_messages.empty())
+        {
+            release_semaphore.acquire();
+        }
+
+        slow_messages.emplace_back(rx_bytes.data(), rx_bytes.size());
+
+        if(slow_messages.size() == MESSAGE_COUNT)
+        {
+            slow_rx_semaphore.release();
+        }
+    });
+
+    const std::string fast_message = "<fast message>";
+    std::string fast_bytes;
+    std::binary_semaphore fast_rx_semaphore(0);
+
+    fast_client.SetRxCallback([&](const std::span<char>& rx_bytes)
+    {
+        fast_bytes.append(rx_bytes.data(), rx_bytes.size());
+
+        if(fast_bytes.size() == fast_message.size())
+        {
+            fast_rx_semaphore.release();
+        }
+    });
+
+    OpenServer(2);
+
+    EXPECT_TRUE(slow_client.Start(reactor));
+    EXPECT_TRUE(slow_client.RequestOpen());
+    AcceptConnections(1);
+    WaitForClientState(slow_client, ClientState::CONNECTED);
+
+    EXPECT_TRUE(fast_client.Start(reactor));
+    EXPECT_TRUE(fast_client.RequestOpen());
+    AcceptConnections(1);
+    WaitForClientState(fast_client, ClientState::CONNECTED);
+
+    std::vector<std::string> messages;
+
+    const auto write_frames = [&](size_t first_index, size_t last_index)
+    {
+        for(size_t index = first_index; index < last_index; ++index)
+        {
+            messages.push_back("<message " + std::to_string(index) + ">");
+            FrameHeader header {};
+            const size_t header_size = EncodeFrameHeader(slow_options.framing, messages.back().size(), header);
+            const std::string frame = std::string(header.data(), header_size) + messages.back();
+
+            EXPECT_EQ(send(m_client_file_descriptors.front(), frame.data(), frame.size(), 0), static_cast<ssize_t>(frame.size()));
+        }
+    };
+
+    // The first message is held in its callback, so the queue fills up behind it and the event loop stops reading the slow client's socket
+    write_frames(0, MESSAGE_COUNT / 2);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    write_frames(MESSAGE_COUNT / 2, MESSAGE_COUNT);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    if constexpr(ClientStatisticsRecorder::IS_COMPILED_IN)
+    {
+        EXPECT_LE(slow_client.GetStatistics().rx_dispatch_queue_depth, MESSAGE_COUNT / 2);
+    }
+
+    // The other client on the event loop still gets its messages
+    EXPECT_EQ(send(m_client_file_descriptors.back(), fast_message.data(), fast_message.size(), 0), static_cast<ssize_t>(fast_message.size()));
+    EXPECT_TRUE(fast_rx_semaphore.try_acquire_for(std::chrono::seconds(5)));
+    EXPECT_EQ(fast_bytes, fast_message);
+
+    // Making room resumes reading, and every message arrives in order
+    release_semaphore.release();
+    EXPECT_TRUE(slow_rx_semaphore.try_acquire_for(std::chrono::seconds(5)));
+    EXPECT_EQ(slow_messages, messages);
+
+    EXPECT_TRUE(slow_client.RequestClose());
+    EXPECT_TRUE(fast_client.RequestClose());
+
+    WaitForClientState(slow_client, ClientState::NOT_CONNECTED);
+    WaitForClientState(fast_client, ClientState::NOT_CONNECTED);
+}
+
+TEST_P(ClientReactorTest, UseRequestedBackend)
+{
+#ifdef APPLICATION_CLIENT_IO_URING
+    const bool is_io_uring_built = true;
+#else
+    const bool is_io_uring_built = false;
+#endif
+
+    // The kernel may still refuse to set up io_uring (for example in a sandbox), in which case the reactor must have fallen back to epoll
+    if(GetParam() == ReactorBackend::IO_URING && is_io_uring_built && m_reactor.GetBackend() == ReactorBackend::EPOLL)
+    {
+        GTEST_SKIP() << "io_uring is not permitted by the kernel";
+    }
+
+    EXPECT_EQ(m_reactor.GetBackend(), is_io_uring_built ? GetParam() : ReactorBackend::EPOLL);
+}
+
+INSTANTIATE_TEST_SUITE_P(Backends, ClientReactorTest, ::testing::Values(ReactorBackend::EPOLL, ReactorBackend::IO_URING), [](const ::testing::TestParamInfo<ReactorBackend>& info)
+{
+    return info.param == ReactorBackend::IO_URING ? std::string("IoUring") : std::string("Epoll");
+});
+
+} // namespace InterProcessCommunication::Test
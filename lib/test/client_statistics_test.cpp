@@ -0,0 +1,85 @@
+#include "client_statistics.h"
+#include "statistics_exporter.h"
+#include <gtest/gtest.h>
+#include <semaphore>
+
+namespace InterProcessCommunication::Test
+{
+
+TEST(ClientStatisticsTest, MapValuesToBucketsThatContainThem)
+{
+    for(uint64_t nanoseconds : {0ULL, 1ULL, 15ULL, 16ULL, 17ULL, 31ULL, 32ULL, 1000ULL, 123456789ULL, (1ULL << 34) + 12345})
+    {
+        const size_t bucket_index = LatencyHistogram::GetBucketIndex(nanoseconds);
+
+        EXPECT_LT(bucket_index, LatencyHistogram::BUCKET_COUNT);
+        EXPECT_LE(nanoseconds, LatencyHistogram::GetBucketUpperBound(bucket_index));
+
+        if(bucket_index > 0)
+        {
+            EXPECT_GT(nanoseconds, LatencyHistogram::GetBucketUpperBound(bucket_index - 1));
+        }
+    }
+
+    // Every bucket's upper bound must land in that same bucket
+    for(size_t bucket_index = 0; bucket_index < LatencyHistogram::BUCKET_COUNT - 1; ++bucket_index)
+    {
+        EXPECT_EQ(LatencyHistogram::GetBucketIndex(LatencyHistogram::GetBucketUpperBound(bucket_index)), bucket_index);
+    }
+
+    EXPECT_EQ(LatencyHistogram::GetBucketIndex(UINT64_MAX), LatencyHistogram::BUCKET_COUNT - 1);
+}
+
+TEST(ClientStatisticsTest, ReportPercentilesWithinBucketPrecision)
+{
+    LatencyHistogram histogram;
+
+    for(uint64_t nanoseconds = 1; nanoseconds <= 1000; ++nanoseconds)
+    {
+        histogram.Record(nanoseconds * 1000);
+    }
+
+    const LatencyHistogramSnapshot snapshot = histogram.GetSnapshot();
+
+    EXPECT_EQ(snapshot.count, 1000);
+    EXPECT_EQ(snapshot.max_nanoseconds, 1000000);
+    EXPECT_DOUBLE_EQ(snapshot.GetMeanNanoseconds(), 500500.0);
+
+    for(const double percentile : {50.0, 90.0, 99.0})
+    {
+        const double exact_value = percentile * 10000.0;
+        const uint64_t reported_value = snapshot.GetPercentile(percentile);
+
+        EXPECT_GE(reported_value, exact_value);
+        EXPECT_LE(reported_value, exact_value * 1.07);
+    }
+
+    EXPECT_EQ(snapshot.GetPercentile(100.0), 1000000);
+    EXPECT_EQ(LatencyHistogramSnapshot{}.GetPercentile(50.0), 0);
+}
+
+TEST(ClientStatisticsTest, ExportRegisteredClientsPeriodically)
+{
+    ApplicationClient client {"127.0.0.1", 5000};
+    std::counting_semaphore<> export_semaphore(0);
+
+    StatisticsExporter exporter(std::chrono::milliseconds(1), [&](const ApplicationClient& exported_client, const ClientStatistics& statistics)
+    {
+        EXPECT_EQ(&exported_client, &client);
+        EXPECT_EQ(statistics.tx_messages, 0);
+        export_semaphore.release();
+    });
+
+    exporter.Register(client);
+    EXPECT_TRUE(exporter.Start());
+    EXPECT_FALSE(exporter.Start());
+
+    // Two exports show that the callback keeps being called
+    export_semaphore.acquire();
+    export_semaphore.acquire();
+
+    exporter.Unregister(client);
+    exporter.Stop();
+}
+
+} // namespace InterProcessCommunication::Test
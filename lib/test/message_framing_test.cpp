@@ -0,0 +1,246 @@
+#include "message_framing.h"
+#include <gtest/gtest.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace InterProcessCommunication::Test
+{
+
+namespace
+{
+
+std::string EncodeFrame(const FramingOptions& options, const std::string& payload)
+{
+    FrameHeader header {};
+    const size_t header_size = EncodeFrameHeader(options, payload.size(), header);
+
+    return std::string(header.data(), header_size) + payload;
+}
+
+// Copies the bytes into a pooled buffer, the way the client reads them from a socket
+RxBufferRef ReadIntoBuffer(RxBufferPool& pool, const std::string& bytes)
+{
+    RxBufferRef rx_buffer = pool.Acquire(bytes.size());
+    std::memcpy(rx_buffer.GetData(), bytes.data(), bytes.size());
+
+    return rx_buffer;
+}
+
+std::string EncodeChunk(size_t lane, bool is_message_end, const std::string& chunk)
+{
+    FrameHeader header {};
+    const size_t header_size = EncodeChunkHeader(lane, is_message_end, chunk.size(), header);
+
+    return std::string(header.data(), header_size) + chunk;
+}
+
+} // namespace
+
+TEST(MessageFramingTest, EncodeHeaderInByteOrder)
+{
+    FramingOptions options;
+    FrameHeader header {};
+
+    options.header_size = FrameHeaderSize::FOUR_BYTES;
+    options.byte_order = std::endian::big;
+    EXPECT_EQ(EncodeFrameHeader(options, 0x01020304, header), 4);
+    EXPECT_EQ(std::string(header.data(), 4), std::string("\x01\x02\x03\x04", 4));
+    EXPECT_EQ(DecodeFrameHeader(options, header), 0x01020304);
+
+    options.header_size = FrameHeaderSize::TWO_BYTES;
+    options.byte_order = std::endian::little;
+    EXPECT_EQ(EncodeFrameHeader(options, 0x0102, header), 2);
+    EXPECT_EQ(std::string(header.data(), 2), std::string("\x02\x01", 2));
+    EXPECT_EQ(DecodeFrameHeader(options, header), 0x0102);
+
+    options.header_size = FrameHeaderSize::EIGHT_BYTES;
+    options.byte_order = std::endian::big;
+    EXPECT_EQ(EncodeFrameHeader(options, 0x0102030405060708, header), 8);
+    EXPECT_EQ(DecodeFrameHeader(options, header), 0x0102030405060708);
+}
+
+TEST(MessageFramingTest, LimitPayloadSizeToHeaderWidth)
+{
+    FramingOptions options;
+    options.header_size = FrameHeaderSize::TWO_BYTES;
+    options.max_frame_size = 1024 * 1024;
+
+    EXPECT_EQ(GetMaxFramePayloadSize(options), 0xFFFF);
+
+    options.header_size = FrameHeaderSize::FOUR_BYTES;
+
+    EXPECT_EQ(GetMaxFramePayloadSize(options), 1024 * 1024);
+}
+
+TEST(MessageFramingTest, DecodeContiguousFramesWithoutCopying)
+{
+    FramingOptions options;
+    const std::shared_ptr<RxBufferPool> pool = RxBufferPool::Create(1024, 1024, 4);
+    std::vector<std::string> frames;
+    std::vector<const char*> frame_addresses;
+
+    FrameDecoder decoder(options, pool, [&](const RxBufferRef& frame_buffer, const std::span<char>& frame)
+    {
+        (void)frame_buffer;
+        frames.emplace_back(frame.data(), frame.size());
+        frame_addresses.push_back(frame.data());
+    });
+
+    const RxBufferRef rx_buffer = ReadIntoBuffer(*pool, EncodeFrame(options, "first") + EncodeFrame(options, "second"));
+
+    EXPECT_TRUE(decoder.Decode(rx_buffer, rx_buffer.GetBytes().first(2 * 4 + 11)));
+
+    EXPECT_EQ(frames, (std::vector<std::string>{"first", "second"}));
+    EXPECT_EQ(frame_addresses[0], rx_buffer.GetData() + 4);
+    EXPECT_EQ(frame_addresses[1], rx_buffer.GetData() + 4 + 5 + 4);
+}
+
+TEST(MessageFramingTest, ReassembleFramesThatStraddleReads)
+{
+    FramingOptions options;
+    options.header_size = FrameHeaderSize::EIGHT_BYTES;
+    options.byte_order = std::endian::little;
+
+    const std::shared_ptr<RxBufferPool> pool = RxBufferPool::Create(1024, 1024, 4);
+    std::vector<std::string> frames;
+    std::vector<RxBufferRef> retained_buffers;
+
+    FrameDecoder decoder(options, pool, [&](const RxBufferRef& frame_buffer, const std::span<char>& frame)
+    {
+        frames.emplace_back(frame.data(), frame.size());
+        retained_buffers.push_back(frame_buffer);
+    });
+
+    const std::string stream = EncodeFrame(options, std::string(3000, 'a')) + EncodeFrame(options, "b") + EncodeFrame(options, std::string(100, 'c'));
+
+    // Feed the stream in odd-sized chunks so that headers and payloads are split across reads
+    for(size_t offset = 0; offset < stream.size(); offset += 7)
+    {
+        const std::string chunk = stream.substr(offset, 7);
+        const RxBufferRef rx_buffer = ReadIntoBuffer(*pool, chunk);
+
+        EXPECT_TRUE(decoder.Decode(rx_buffer, rx_buffer.GetBytes().first(chunk.size())));
+    }
+
+    EXPECT_EQ(frames, (std::vector<std::string>{std::string(3000, 'a'), "b", std::string(100, 'c')}));
+    EXPECT_EQ(retained_buffers[0].GetSize(), 3000);
+}
+
+TEST(MessageFramingTest, RejectOversizedFrame)
+{
+    FramingOptions options;
+    options.max_frame_size = 16;
+
+    const std::shared_ptr<RxBufferPool> pool = RxBufferPool::Create(1024, 1024, 4);
+    int frame_count = 0;
+
+    FrameDecoder decoder(options, pool, [&](const RxBufferRef& frame_buffer, const std::span<char>& frame)
+    {
+        (void)frame_buffer;
+        (void)frame;
+        ++frame_count;
+    });
+
+    const std::string stream = EncodeFrame(options, std::string(16, 'a')) + EncodeFrame(options, std::string(17, 'b'));
+    const RxBufferRef rx_buffer = ReadIntoBuffer(*pool, stream);
+
+    EXPECT_FALSE(decoder.Decode(rx_buffer, rx_buffer.GetBytes().first(stream.size())));
+    EXPECT_EQ(frame_count, 1);
+}
+
+TEST(MessageFramingTest, DeliverMemfdFramesInStreamOrder)
+{
+    FramingOptions options;
+    const std::shared_ptr<RxBufferPool> pool = RxBufferPool::Create(1024, 1024, 4);
+    std::vector<std::string> frames;
+
+    FrameDecoder decoder(options, pool, [&](const RxBufferRef& frame_buffer, const std::span<char>& frame)
+    {
+        (void)frame_buffer;
+        frames.emplace_back(frame.data(), frame.size());
+    },
+    [&]()
+    {
+        frames.emplace_back("<memfd>");
+        return true;
+    });
+
+    FrameHeader memfd_header {};
+    const size_t header_size = EncodeFrameHeader(options, GetMemfdFrameFlag(options), memfd_header);
+
+    const std::string stream = EncodeFrame(options, "first") + std::string(memfd_header.data(), header_size) + EncodeFrame(options, "second");
+    const RxBufferRef rx_buffer = ReadIntoBuffer(*pool, stream);
+
+    EXPECT_EQ(GetMemfdFrameFlag(options), uint64_t { 1 } << 31);
+    EXPECT_TRUE(decoder.Decode(rx_buffer, rx_buffer.GetBytes().first(stream.size())));
+    EXPECT_EQ(frames, (std::vector<std::string>{"first", "<memfd>", "second"}));
+}
+
+TEST(MessageFramingTest, RejectMemfdFrameWithLength)
+{
+    FramingOptions options;
+    const std::shared_ptr<RxBufferPool> pool = RxBufferPool::Create(1024, 1024, 4);
+    int memfd_frame_count = 0;
+
+    FrameDecoder decoder(options, pool, [](const RxBufferRef&, const std::span<char>&) {}, [&]()
+    {
+        ++memfd_frame_count;
+        return true;
+    });
+
+    FrameHeader memfd_header {};
+    const size_t header_size = EncodeFrameHeader(options, GetMemfdFrameFlag(options) | 1, memfd_header);
+    const RxBufferRef rx_buffer = ReadIntoBuffer(*pool, std::string(memfd_header.data(), header_size) + "x");
+
+    EXPECT_FALSE(decoder.Decode(rx_buffer, rx_buffer.GetBytes().first(header_size + 1)));
+    EXPECT_EQ(memfd_frame_count, 0);
+}
+
+TEST(MessageFramingTest, EncodeChunkHeader)
+{
+    FrameHeader header {};
+
+    EXPECT_EQ(EncodeChunkHeader(3, true, 0x01020304, header), CHUNK_HEADER_SIZE);
+    EXPECT_EQ(std::string(header.data(), CHUNK_HEADER_SIZE), std::string("\x03\x01\x01\x02\x03\x04", CHUNK_HEADER_SIZE));
+
+    EXPECT_EQ(EncodeChunkHeader(255, false, 16, header), CHUNK_HEADER_SIZE);
+    EXPECT_EQ(std::string(header.data(), CHUNK_HEADER_SIZE), std::string("\xFF\x00\x00\x00\x00\x10", CHUNK_HEADER_SIZE));
+}
+
+TEST(MessageFramingTest, ReassembleInterleavedLaneChunks)
+{
+    std::vector<std::pair<size_t, std::string>> messages;
+
+    ChunkDecoder decoder([&](size_t lane, const std::span<char>& message)
+    {
+        messages.emplace_back(lane, std::string(message.data(), message.size()));
+    });
+
+    // A bulk message on lane 2 is interrupted twice by whole messages on lane 0
+    std::string stream = EncodeChunk(2, false, std::string(100, 'a')) + EncodeChunk(0, true, "stop") + EncodeChunk(2, false, std::string(100, 'b'))
+        + EncodeChunk(0, true, "go") + EncodeChunk(2, true, std::string(50, 'c'));
+
+    // Feed the stream in odd-sized pieces so that headers and chunks are split across reads
+    for(size_t offset = 0; offset < stream.size(); offset += 7)
+    {
+        std::string piece = stream.substr(offset, 7);
+        decoder.Decode(std::span<char>(piece));
+    }
+
+    const std::vector<std::pair<size_t, std::string>> expected_messages {{0, "stop"}, {0, "go"}, {2, std::string(100, 'a') + std::string(100, 'b') + std::string(50, 'c')}};
+
+    EXPECT_EQ(messages, expected_messages);
+
+    // A partially received message is dropped on reset
+    std::string partial_stream = EncodeChunk(1, false, "lost");
+    decoder.Decode(std::span<char>(partial_stream));
+    decoder.Reset();
+
+    std::string next_stream = EncodeChunk(1, true, "next");
+    decoder.Decode(std::span<char>(next_stream));
+
+    EXPECT_EQ(messages.back(), (std::pair<size_t, std::string>{1, "next"}));
+}
+
+} // namespace InterProcessCommunication::Test
@@ -0,0 +1,85 @@
+#include "mpsc_queue.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace InterProcessCommunication::Test
+{
+
+TEST(MpscQueueTest, PopFromEmptyQueue)
+{
+    MpscQueue<int> queue;
+
+    EXPECT_TRUE(queue.IsEmpty());
+    EXPECT_FALSE(queue.Pop().has_value());
+}
+
+TEST(MpscQueueTest, PopInPushOrder)
+{
+    MpscQueue<std::unique_ptr<int>> queue;
+
+    for(int value = 0; value < 10; ++value)
+    {
+        queue.Push(std::make_unique<int>(value));
+    }
+
+    EXPECT_FALSE(queue.IsEmpty());
+
+    for(int value = 0; value < 10; ++value)
+    {
+        std::optional<std::unique_ptr<int>> popped_value = queue.Pop();
+        ASSERT_TRUE(popped_value.has_value());
+        EXPECT_EQ(**popped_value, value);
+    }
+
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+TEST(MpscQueueTest, ConcurrentProducersKeepTheirOrder)
+{
+    const int producer_count = 8;
+    const int values_per_producer = 100000;
+
+    MpscQueue<std::pair<int, int>> queue;
+    std::vector<std::thread> producers;
+
+    for(int producer = 0; producer < producer_count; ++producer)
+    {
+        producers.emplace_back([&queue, producer]()
+        {
+            for(int value = 0; value < values_per_producer; ++value)
+            {
+                queue.Push(std::make_pair(producer, value));
+            }
+        });
+    }
+
+    // Every producer's values must arrive in order, although the producers are interleaved
+    std::vector<int> next_values(producer_count, 0);
+    int popped_count = 0;
+
+    while(popped_count < producer_count * values_per_producer)
+    {
+        std::optional<std::pair<int, int>> popped_value = queue.Pop();
+
+        if(not popped_value.has_value())
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        EXPECT_EQ(popped_value->second, next_values[popped_value->first]);
+        next_values[popped_value->first] = popped_value->second + 1;
+        ++popped_count;
+    }
+
+    for(std::thread& producer : producers)
+    {
+        producer.join();
+    }
+
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+} // namespace InterProcessCommunication::Test
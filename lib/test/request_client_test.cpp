@@ -0,0 +1,339 @@
+#include "request_client.h"
+#include <gtest/gtest.h>
+#include <netinet/tcp.h>
+#include <algorithm>
+#include <vector>
+
+namespace InterProcessCommunication::Test
+{
+
+class RequestClientTest : public ::testing::Test
+{
+public:
+    static constexpr std::chrono::milliseconds CLIENT_STATE_POLL_INTERVAL { 10 };
+    // A frame of the default framing options holds a 4-byte big-endian length
+    static constexpr size_t FRAME_HEADER_SIZE = 4;
+    const std::string IPV4_ADDRESS { "127.0.0.1" };
+    const uint16_t PORT = 5002;
+
+    struct Request
+    {
+        std::string correlation_id;
+        std::string body;
+    };
+
+    void TearDown() override
+    {
+        close(m_client_file_descriptor);
+        close(m_server_file_descriptor);
+    }
+
+    void OpenServer()
+    {
+        m_server_file_descriptor = socket(AF_INET, SOCK_STREAM, 0);
+        EXPECT_NE(m_server_file_descriptor, -1);
+        sockaddr_in address{};
+
+        // Force the port to be freed after use by the server
+        const int server_socket_option = 1;
+        setsockopt(m_server_file_descriptor, SOL_SOCKET, SO_REUSEADDR, &server_socket_option, sizeof(server_socket_option));
+
+        address.sin_family = AF_INET;
+        inet_pton(AF_INET, IPV4_ADDRESS.c_str(), &address.sin_addr);
+        address.sin_port = htons(PORT);
+
+        EXPECT_NE(bind(m_server_file_descriptor, (sockaddr*)&address, sizeof(address)),-1);
+        EXPECT_NE(listen(m_server_file_descriptor, 1),-1);
+    }
+
+    void ConnectClient(RequestClient& request_client)
+    {
+        ApplicationClient& client = request_client.GetClient();
+
+        EXPECT_TRUE(client.Start());
+
+        while(not client.IsRunning())
+        {
+            std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+        }
+
+        EXPECT_TRUE(client.RequestOpen());
+
+        m_client_file_descriptor = accept(m_server_file_descriptor, nullptr, nullptr);
+        EXPECT_NE(m_client_file_descriptor, -1);
+
+        // The replies are small writes that must not wait for the client's delayed ACKs
+        const int no_delay = 1;
+        setsockopt(m_client_file_descriptor, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+
+        while(client.GetClientState() != ClientState::CONNECTED)
+        {
+            std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+        }
+    }
+
+    std::string ReadBytes(size_t byte_count)
+    {
+        std::string received_bytes(byte_count, '\0');
+        size_t received_byte_count = 0;
+
+        while(received_byte_count < byte_count)
+        {
+            const ssize_t bytes = read(m_client_file_descriptor, received_bytes.data() + received_byte_count, byte_count - received_byte_count);
+
+            EXPECT_GT(bytes, 0);
+
+            if(bytes <= 0)
+            {
+                break;
+            }
+
+            received_byte_count += bytes;
+        }
+
+        return received_bytes;
+    }
+
+    Request ReadRequest()
+    {
+        const std::string frame_header = ReadBytes(FRAME_HEADER_SIZE);
+        uint32_t frame_size = 0;
+
+        for(const char byte : frame_header)
+        {
+            frame_size = (frame_size << 8) | static_cast<unsigned char>(byte);
+        }
+
+        const std::string frame = ReadBytes(frame_size);
+
+        return Request {.correlation_id = frame.substr(0, RequestClient::CORRELATION_ID_SIZE), .body = frame.substr(RequestClient::CORRELATION_ID_SIZE)};
+    }
+
+    void WriteReply(const std::string& correlation_id, const std::string& body)
+    {
+        const uint32_t frame_size = correlation_id.size() + body.size();
+        std::string frame;
+
+        for(int shift = 24; shift >= 0; shift -= 8)
+        {
+            frame.push_back(static_cast<char>((frame_size >> shift) & 0xFF));
+        }
+
+        frame += correlation_id + body;
+
+        EXPECT_EQ(send(m_client_file_descriptor, frame.data(), frame.size(), 0), static_cast<ssize_t>(frame.size()));
+    }
+
+protected:
+    int m_client_file_descriptor { -1 };
+    int m_server_file_descriptor { -1 };
+};
+
+TEST_F(RequestClientTest, MatchRepliesThatArriveOutOfOrder)
+{
+    RequestClient request_client {IPV4_ADDRESS, PORT};
+
+    OpenServer();
+    ConnectClient(request_client);
+
+    const std::vector<std::string> bodies {"first", "second", "third", "fourth"};
+    std::vector<std::future<RequestReply>> reply_futures;
+
+    for(const std::string& body : bodies)
+    {
+        reply_futures.push_back(request_client.SendRequest(std::span<const char>(body)));
+    }
+
+    std::vector<Request> requests;
+
+    for(size_t count = 0; count < bodies.size(); ++count)
+    {
+        requests.push_back(ReadRequest());
+        EXPECT_EQ(requests.back().body, bodies[count]);
+    }
+
+    EXPECT_EQ(request_client.GetPendingRequestCount(), bodies.size());
+
+    std::reverse(requests.begin(), requests.end());
+
+    for(const Request& request : requests)
+    {
+        WriteReply(request.correlation_id, "re:" + request.body);
+    }
+
+    for(size_t index = 0; index < bodies.size(); ++index)
+    {
+        RequestReply reply = reply_futures[index].get();
+
+        EXPECT_EQ(reply.status, RequestStatus::REPLIED);
+        EXPECT_EQ(std::string(reply.body.data(), reply.body.size()), "re:" + bodies[index]);
+    }
+
+    EXPECT_EQ(request_client.GetPendingRequestCount(), 0);
+}
+
+TEST_F(RequestClientTest, KeepManyRequestsInFlightThroughSmallTable)
+{
+    ClientOptions client_options;
+    client_options.socket = SocketOptions::LowLatency();
+
+    RequestClientOptions options;
+    options.max_pending_requests = 4;
+
+    RequestClient request_client {IPV4_ADDRESS, PORT, client_options, options};
+
+    OpenServer();
+    ConnectClient(request_client);
+
+    // The first request stays unanswered until the end, so the later ones collide with it in the table whenever their IDs wrap around to its slot
+    const std::string straggler_body = "straggler";
+    std::future<RequestReply> straggler_reply_future = request_client.SendRequest(std::span<const char>(straggler_body));
+    const Request straggler_request = ReadRequest();
+
+    for(size_t round = 0; round < 50; ++round)
+    {
+        std::vector<std::future<RequestReply>> reply_futures;
+
+        for(size_t count = 1; count < options.max_pending_requests; ++count)
+        {
+            const std::string body = std::to_string(round * 10 + count);
+            reply_futures.push_back(request_client.SendRequest(std::span<const char>(body)));
+        }
+
+        // The table is full until a reply comes back
+        const std::string rejected_body = "rejected";
+        EXPECT_EQ(request_client.SendRequest(std::span<const char>(rejected_body)).get().status, RequestStatus::NOT_SENT);
+
+        std::vector<Request> requests;
+
+        for(size_t count = 1; count < options.max_pending_requests; ++count)
+        {
+            requests.push_back(ReadRequest());
+        }
+
+        // Answering out of order erases requests from the middle of probe sequences
+        for(const size_t first_index : {1, 0})
+        {
+            for(size_t index = first_index; index < requests.size(); index += 2)
+            {
+                WriteReply(requests[index].correlation_id, requests[index].body);
+            }
+        }
+
+        for(size_t index = 0; index < reply_futures.size(); ++index)
+        {
+            RequestReply reply = reply_futures[index].get();
+
+            EXPECT_EQ(reply.status, RequestStatus::REPLIED);
+            EXPECT_EQ(std::string(reply.body.data(), reply.body.size()), std::to_string(round * 10 + index + 1));
+        }
+    }
+
+    WriteReply(straggler_request.correlation_id, straggler_request.body);
+
+    RequestReply straggler_reply = straggler_reply_future.get();
+
+    EXPECT_EQ(straggler_reply.status, RequestStatus::REPLIED);
+    EXPECT_EQ(std::string(straggler_reply.body.data(), straggler_reply.body.size()), straggler_body);
+    EXPECT_EQ(request_client.GetPendingRequestCount(), 0);
+}
+
+TEST_F(RequestClientTest, TimeOutUnansweredRequests)
+{
+    RequestClient request_client {IPV4_ADDRESS, PORT};
+
+    OpenServer();
+    ConnectClient(request_client);
+
+    const std::string body = "unanswered";
+    const std::chrono::steady_clock::time_point send_time = std::chrono::steady_clock::now();
+
+    std::future<RequestReply> reply_future = request_client.SendRequest(std::span<const char>(body), std::chrono::milliseconds(50));
+    const Request request = ReadRequest();
+
+    EXPECT_EQ(reply_future.get().status, RequestStatus::TIMED_OUT);
+    EXPECT_GE(std::chrono::steady_clock::now() - send_time, std::chrono::milliseconds(50));
+    EXPECT_EQ(request_client.GetPendingRequestCount(), 0);
+
+    // A reply that arrives after the timeout is dropped, and later requests are still matched
+    WriteReply(request.correlation_id, "late");
+
+    std::future<RequestReply> next_reply_future = request_client.SendRequest(std::span<const char>(body));
+    const Request next_request = ReadRequest();
+
+    EXPECT_NE(next_request.correlation_id, request.correlation_id);
+
+    WriteReply(next_request.correlation_id, "on time");
+
+    RequestReply next_reply = next_reply_future.get();
+
+    EXPECT_EQ(next_reply.status, RequestStatus::REPLIED);
+    EXPECT_EQ(std::string(next_reply.body.data(), next_reply.body.size()), "on time");
+}
+
+TEST_F(RequestClientTest, TimeOutRequestsInDeadlineOrder)
+{
+    RequestClient request_client {IPV4_ADDRESS, PORT};
+
+    OpenServer();
+    ConnectClient(request_client);
+
+    const std::string body = "request";
+    const std::chrono::steady_clock::time_point send_time = std::chrono::steady_clock::now();
+
+    // The timeout thread sleeps until the first deadline, and the later requests with earlier deadlines have to wake it
+    std::future<RequestReply> slow_reply_future = request_client.SendRequest(std::span<const char>(body), std::chrono::milliseconds(10000));
+    std::future<RequestReply> second_reply_future = request_client.SendRequest(std::span<const char>(body), std::chrono::milliseconds(150));
+    std::future<RequestReply> first_reply_future = request_client.SendRequest(std::span<const char>(body), std::chrono::milliseconds(50));
+
+    const Request slow_request = ReadRequest();
+    ReadRequest();
+    ReadRequest();
+
+    EXPECT_EQ(first_reply_future.get().status, RequestStatus::TIMED_OUT);
+    const std::chrono::steady_clock::duration first_timeout_time = std::chrono::steady_clock::now() - send_time;
+
+    EXPECT_EQ(second_reply_future.get().status, RequestStatus::TIMED_OUT);
+    const std::chrono::steady_clock::duration second_timeout_time = std::chrono::steady_clock::now() - send_time;
+
+    EXPECT_GE(first_timeout_time, std::chrono::milliseconds(50));
+    EXPECT_GE(second_timeout_time, std::chrono::milliseconds(150));
+    EXPECT_LT(second_timeout_time, std::chrono::milliseconds(5000));
+    EXPECT_EQ(request_client.GetPendingRequestCount(), 1);
+
+    // The request that is still pending takes its deadline out of the heap on being answered
+    WriteReply(slow_request.correlation_id, "slow");
+
+    EXPECT_EQ(slow_reply_future.get().status, RequestStatus::REPLIED);
+    EXPECT_EQ(request_client.GetPendingRequestCount(), 0);
+}
+
+TEST_F(RequestClientTest, CancelPendingRequestsWhenDisconnected)
+{
+    RequestClient request_client {IPV4_ADDRESS, PORT};
+
+    OpenServer();
+    ConnectClient(request_client);
+
+    const std::string body = "unanswered";
+    std::binary_semaphore callback_semaphore(0);
+    RequestStatus status = RequestStatus::REPLIED;
+
+    EXPECT_TRUE(request_client.SendRequest(std::span<const char>(body), [&](RequestReply&& reply)
+    {
+        status = reply.status;
+        callback_semaphore.release();
+    }));
+
+    ReadRequest();
+
+    // Sever the connection from the server's side
+    shutdown(m_client_file_descriptor, SHUT_RDWR);
+
+    callback_semaphore.acquire();
+
+    EXPECT_EQ(status, RequestStatus::CANCELLED);
+    EXPECT_EQ(request_client.GetPendingRequestCount(), 0);
+}
+
+} // namespace InterProcessCommunication::Test
@@ -0,0 +1,94 @@
+#include "rx_buffer_pool.h"
+#include <gtest/gtest.h>
+#include <cstring>
+#include <memory>
+
+namespace InterProcessCommunication::Test
+{
+
+TEST(RxBufferPoolTest, ReuseReleasedBuffer)
+{
+    const std::shared_ptr<RxBufferPool> pool = RxBufferPool::Create(1024, 1024, 4);
+
+    char* first_data = nullptr;
+
+    {
+        RxBufferRef buffer = pool->Acquire();
+        EXPECT_EQ(buffer.GetSize(), 1024);
+        EXPECT_FALSE(buffer.IsShared());
+        first_data = buffer.GetData();
+    }
+
+    RxBufferRef buffer = pool->Acquire();
+
+    EXPECT_EQ(buffer.GetData(), first_data);
+    EXPECT_EQ(pool->GetAllocationCount(), 1);
+}
+
+TEST(RxBufferPoolTest, RetainedBufferIsNotReused)
+{
+    const std::shared_ptr<RxBufferPool> pool = RxBufferPool::Create(64, 64, 4);
+
+    RxBufferRef buffer = pool->Acquire();
+    RxBufferRef retained_buffer = buffer;
+
+    EXPECT_TRUE(buffer.IsShared());
+    EXPECT_EQ(retained_buffer.GetData(), buffer.GetData());
+
+    buffer = pool->Acquire();
+
+    EXPECT_NE(retained_buffer.GetData(), buffer.GetData());
+    EXPECT_FALSE(retained_buffer.IsShared());
+    EXPECT_EQ(pool->GetAllocationCount(), 2);
+}
+
+TEST(RxBufferPoolTest, RetainedBufferOutlivesPool)
+{
+    std::shared_ptr<RxBufferPool> pool = RxBufferPool::Create(16, 16, 4);
+
+    RxBufferRef buffer = pool->Acquire();
+    std::memcpy(buffer.GetData(), "retained", 8);
+
+    pool.reset();
+
+    EXPECT_EQ(std::memcmp(buffer.GetData(), "retained", 8), 0);
+}
+
+TEST(RxBufferPoolTest, GrowAfterConsecutiveFullReads)
+{
+    const std::shared_ptr<RxBufferPool> pool = RxBufferPool::Create(1024, 4096, 4);
+
+    // A partial read resets the growth streak
+    pool->RecordRead(1024, 1024);
+    pool->RecordRead(512, 1024);
+    pool->RecordRead(1024, 1024);
+    EXPECT_EQ(pool->GetBufferSize(), 1024);
+
+    pool->RecordRead(1024, 1024);
+    EXPECT_EQ(pool->GetBufferSize(), 2048);
+
+    for(int count = 0; count < 10; ++count)
+    {
+        pool->RecordRead(4096, 4096);
+    }
+
+    EXPECT_EQ(pool->GetBufferSize(), 4096);
+}
+
+TEST(RxBufferPoolTest, DiscardBuffersSmallerThanTargetSize)
+{
+    const std::shared_ptr<RxBufferPool> pool = RxBufferPool::Create(1024, 2048, 4);
+
+    {
+        RxBufferRef small_buffer = pool->Acquire();
+        pool->RecordRead(1024, 1024);
+        pool->RecordRead(1024, 1024);
+    }
+
+    RxBufferRef buffer = pool->Acquire();
+
+    EXPECT_EQ(buffer.GetSize(), 2048);
+    EXPECT_EQ(pool->GetAllocationCount(), 2);
+}
+
+} // namespace InterProcessCommunication::Test
@@ -0,0 +1,240 @@
+#include "application_client.h"
+#include "shared_memory_peer.h"
+#include <gtest/gtest.h>
+#include <semaphore>
+#include <string>
+#include <vector>
+
+namespace InterProcessCommunication::Test
+{
+
+class SharedMemoryClientTest : public ::testing::Test
+{
+public:
+    static constexpr std::chrono::milliseconds CLIENT_STATE_POLL_INTERVAL { 10 };
+    static constexpr std::chrono::milliseconds ATTACH_TIMEOUT { 5000 };
+    // The smallest ring the peer accepts, so that payloads keep wrapping around and filling it
+    static constexpr size_t SMALL_RING_SIZE = 4096;
+    const std::string SEGMENT_NAME { "/application_client_test_" + std::to_string(getpid()) };
+
+    static void StartClient(ApplicationClient& client)
+    {
+        EXPECT_TRUE(client.Start());
+
+        while(not client.IsRunning())
+        {
+            std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+        }
+    }
+
+    static void ConnectClient(ApplicationClient& client, SharedMemoryPeer& peer)
+    {
+        StartClient(client);
+
+        EXPECT_TRUE(client.RequestOpen());
+        EXPECT_TRUE(peer.WaitForClient(ATTACH_TIMEOUT));
+
+        while(client.GetClientState() != ClientState::CONNECTED)
+        {
+            std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+        }
+    }
+
+    static std::string ReceiveBytes(SharedMemoryPeer& peer, size_t byte_count)
+    {
+        std::string received_bytes;
+        std::vector<char> buffer(1024);
+
+        while(received_bytes.size() < byte_count)
+        {
+            const ssize_t read_bytes = peer.Receive(std::span<char>(buffer.data(), std::min(buffer.size(), byte_count - received_bytes.size())));
+
+            EXPECT_GT(read_bytes, 0);
+
+            if(read_bytes <= 0)
+            {
+                break;
+            }
+
+            received_bytes.append(buffer.data(), read_bytes);
+        }
+
+        return received_bytes;
+    }
+
+    static std::string EncodeFrame(const FramingOptions& options, const std::string& payload)
+    {
+        FrameHeader header {};
+        const size_t header_size = EncodeFrameHeader(options, payload.size(), header);
+
+        return std::string(header.data(), header_size) + payload;
+    }
+};
+
+TEST_F(SharedMemoryClientTest, ExchangeFramedMessagesWithPeer)
+{
+    const std::unique_ptr<SharedMemoryPeer> peer = SharedMemoryPeer::Create(SEGMENT_NAME);
+    ASSERT_NE(peer, nullptr);
+
+    ClientOptions options;
+    options.framing.enabled = true;
+
+    ApplicationClient client {SharedMemoryEndpoint{.name = SEGMENT_NAME}, options};
+
+    std::vector<std::string> received_messages;
+    std::binary_semaphore rx_semaphore(0);
+
+    client.SetRxCallback([&](const std::span<char>& rx_bytes)
+    {
+        received_messages.emplace_back(rx_bytes.data(), rx_bytes.size());
+
+        if(received_messages.size() == 2)
+        {
+            rx_semaphore.release();
+        }
+    });
+
+    ConnectClient(client, *peer);
+
+    std::string first_request = "<first request>";
+    std::string second_request = "<second request>";
+
+    EXPECT_TRUE(client.EnqueuePayload(std::span<char>(first_request)));
+    EXPECT_TRUE(client.EnqueuePayload(std::span<char>(second_request)));
+
+    const std::string expected_stream = EncodeFrame(options.framing, first_request) + EncodeFrame(options.framing, second_request);
+    EXPECT_EQ(ReceiveBytes(*peer, expected_stream.size()), expected_stream);
+
+    EXPECT_TRUE(peer->SendAll(EncodeFrame(options.framing, "<first reply>") + EncodeFrame(options.framing, "<second reply>")));
+
+    rx_semaphore.acquire();
+
+    EXPECT_EQ(received_messages, std::vector<std::string>({"<first reply>", "<second reply>"}));
+    EXPECT_TRUE(client.RequestClose());
+}
+
+TEST_F(SharedMemoryClientTest, StreamPayloadsThroughFullRing)
+{
+    const std::unique_ptr<SharedMemoryPeer> peer = SharedMemoryPeer::Create(SEGMENT_NAME, SMALL_RING_SIZE);
+    ASSERT_NE(peer, nullptr);
+
+    ApplicationClient client {SharedMemoryEndpoint{.name = SEGMENT_NAME}};
+
+    ConnectClient(client, *peer);
+
+    // Neither payload size divides the ring, so the copies keep running past its end, and the client has to wait for room while the peer is slow to read
+    constexpr size_t PAYLOAD_COUNT = 200;
+    constexpr size_t PAYLOAD_SIZE = 3000;
+    std::string expected_stream;
+
+    for(size_t index = 0; index < PAYLOAD_COUNT; ++index)
+    {
+        std::vector<char> payload(PAYLOAD_SIZE, static_cast<char>('a' + index % 26));
+
+        expected_stream.append(payload.begin(), payload.end());
+        EXPECT_TRUE(client.EnqueuePayload(std::move(payload)));
+    }
+
+    EXPECT_EQ(ReceiveBytes(*peer, expected_stream.size()), expected_stream);
+    EXPECT_TRUE(client.RequestClose());
+}
+
+TEST_F(SharedMemoryClientTest, DisconnectWhenPeerCloses)
+{
+    const std::unique_ptr<SharedMemoryPeer> peer = SharedMemoryPeer::Create(SEGMENT_NAME);
+    ASSERT_NE(peer, nullptr);
+
+    ApplicationClient client {SharedMemoryEndpoint{.name = SEGMENT_NAME}};
+
+    std::string received_bytes;
+    std::binary_semaphore disconnected_semaphore(0);
+
+    client.SetRxCallback([&](const std::span<char>& rx_bytes)
+    {
+        received_bytes.append(rx_bytes.data(), rx_bytes.size());
+    });
+
+    client.SetDisconnectedCallback([&]()
+    {
+        disconnected_semaphore.release();
+    });
+
+    ConnectClient(client, *peer);
+
+    // The bytes that the peer sent before closing still reach the client
+    EXPECT_TRUE(peer->SendAll(std::string("<last words>")));
+    peer->Close();
+
+    disconnected_semaphore.acquire();
+
+    EXPECT_EQ(received_bytes, "<last words>");
+    EXPECT_EQ(client.GetClientState(), ClientState::NOT_CONNECTED);
+
+    std::string payload = "<too late>";
+    EXPECT_FALSE(peer->SendAll(payload));
+}
+
+TEST_F(SharedMemoryClientTest, RefuseSecondClientOfSession)
+{
+    const std::unique_ptr<SharedMemoryPeer> peer = SharedMemoryPeer::Create(SEGMENT_NAME);
+    ASSERT_NE(peer, nullptr);
+
+    ApplicationClient first_client {SharedMemoryEndpoint{.name = SEGMENT_NAME}};
+    ApplicationClient second_client {SharedMemoryEndpoint{.name = SEGMENT_NAME}};
+
+    std::vector<Error> errors;
+    std::binary_semaphore error_semaphore(0);
+
+    second_client.SetErrorCallback([&](const Error& error, const std::optional<std::span<char>>&)
+    {
+        errors.push_back(error);
+        error_semaphore.release();
+    });
+
+    ConnectClient(first_client, *peer);
+    StartClient(second_client);
+
+    EXPECT_TRUE(second_client.RequestOpen());
+    error_semaphore.acquire();
+
+    while(second_client.GetClientState() != ClientState::NOT_CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    EXPECT_EQ(errors, std::vector<Error>({Error::SOCKET_CONNECT_FAILURE}));
+    EXPECT_EQ(first_client.GetClientState(), ClientState::CONNECTED);
+    EXPECT_TRUE(first_client.RequestClose());
+}
+
+TEST_F(SharedMemoryClientTest, FailToConnectWithoutSegment)
+{
+    ApplicationClient client {SharedMemoryEndpoint{.name = SEGMENT_NAME}};
+    ClientReactor reactor;
+
+    std::vector<Error> errors;
+    std::binary_semaphore error_semaphore(0);
+
+    client.SetErrorCallback([&](const Error& error, const std::optional<std::span<char>>&)
+    {
+        errors.push_back(error);
+        error_semaphore.release();
+    });
+
+    // The rings have nothing that a reactor could watch
+    EXPECT_FALSE(client.Start(reactor));
+
+    StartClient(client);
+
+    EXPECT_TRUE(client.RequestOpen());
+    error_semaphore.acquire();
+
+    while(client.GetClientState() != ClientState::NOT_CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    EXPECT_EQ(errors, std::vector<Error>({Error::SOCKET_CONNECT_FAILURE}));
+}
+
+} // namespace InterProcessCommunication::Test
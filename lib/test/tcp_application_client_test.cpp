@@ -1,5 +1,7 @@
 #include "application_client.h"
+#include "client_task.h"
 #include <gtest/gtest.h>
+#include <sys/ioctl.h>
 #include <vector>
 
 namespace InterProcessCommunication::Test
@@ -10,6 +12,7 @@ class TcpApplicationClientTest : public ::testing::Test
 public:
     static constexpr std::chrono::milliseconds CLIENT_STATE_POLL_INTERVAL { 10 };
     static constexpr int BUFFER_SIZE = 1024;
+    static constexpr int SMALL_SOCKET_BUFFER_SIZE = 64 * 1024;
     const std::string IPV4_ADDRESS { "127.0.0.1" };
     const uint16_t PORT = 5000;
     ApplicationClient m_client {IPV4_ADDRESS, PORT};
@@ -18,6 +21,41 @@ public:
     {
         close(m_client_file_descriptor);
         close(m_server_file_descriptor);
+
+        for(int filler_file_descriptor : m_filler_file_descriptors)
+        {
+            close(filler_file_descriptor);
+        }
+    }
+
+    // A server that never accepts, and whose accept queue is already full, drops every further SYN, so connecting to it hangs like connecting to an unreachable host
+    void StartUnresponsiveTcpServer()
+    {
+        const int filler_connection_count = 2;
+        m_server_file_descriptor = socket(AF_INET, SOCK_STREAM, 0);
+        EXPECT_NE(m_server_file_descriptor, -1);
+        sockaddr_in address{};
+
+        // Force the port to be freed after use by the server
+        const int server_socket_option = 1;
+        setsockopt(m_server_file_descriptor, SOL_SOCKET, SO_REUSEADDR, &server_socket_option, sizeof(server_socket_option));
+
+        address.sin_family = AF_INET;
+        inet_pton(AF_INET, IPV4_ADDRESS.c_str(), &address.sin_addr);
+        address.sin_port = htons(PORT);
+
+        EXPECT_NE(bind(m_server_file_descriptor, (sockaddr*)&address, sizeof(address)),-1);
+        EXPECT_NE(listen(m_server_file_descriptor, 0),-1);
+
+        for(int count = 0; count < filler_connection_count; ++count)
+        {
+            const int filler_file_descriptor = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+            connect(filler_file_descriptor, (sockaddr*)&address, sizeof(address));
+            m_filler_file_descriptors.push_back(filler_file_descriptor);
+        }
+
+        // Give the handshakes of the filler connections time to fill the accept queue
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
     }
     
     void StartConnectionAccepterTcpServer(std::binary_semaphore& server_running_semaphore, std::binary_semaphore& server_shutdown_semaphore, int connection_limit)
@@ -169,9 +207,68 @@ public:
         std::cout << "TCP_SERVER -> Server has shutdown.\n";
     }
 
+    struct LaneMessage
+    {
+        size_t lane = 0;
+        std::string message;
+    };
+
+    // Accepts one connection and, once start_reading_semaphore is released, reassembles the client's lane chunks until expected_message_count messages have arrived.
+    // The socket buffers are kept small, so that a large payload can not be handed to the kernel before the server starts reading.
+    void StartLaneMessageReceiverTcpServer(std::binary_semaphore& server_running_semaphore, std::binary_semaphore& start_reading_semaphore, size_t expected_message_count, std::vector<LaneMessage>& lane_messages)
+    {
+        m_server_file_descriptor = socket(AF_INET, SOCK_STREAM, 0);
+        EXPECT_NE(m_server_file_descriptor, -1);
+        sockaddr_in address{};
+
+        const int server_socket_option = 1;
+        setsockopt(m_server_file_descriptor, SOL_SOCKET, SO_REUSEADDR, &server_socket_option, sizeof(server_socket_option));
+
+        // Inherited by the accepted connection
+        const int receive_buffer_size = SMALL_SOCKET_BUFFER_SIZE;
+        setsockopt(m_server_file_descriptor, SOL_SOCKET, SO_RCVBUF, &receive_buffer_size, sizeof(receive_buffer_size));
+
+        address.sin_family = AF_INET;
+        inet_pton(AF_INET, IPV4_ADDRESS.c_str(), &address.sin_addr);
+        address.sin_port = htons(PORT);
+
+        EXPECT_NE(bind(m_server_file_descriptor, (sockaddr*)&address, sizeof(address)),-1);
+        EXPECT_NE(listen(m_server_file_descriptor, 1),-1);
+
+        server_running_semaphore.release();
+
+        m_client_file_descriptor = accept(m_server_file_descriptor, nullptr, nullptr);
+        EXPECT_NE(m_client_file_descriptor, -1);
+
+        start_reading_semaphore.acquire();
+
+        ChunkDecoder decoder([&](size_t lane, const std::span<char>& message)
+        {
+            lane_messages.push_back(LaneMessage{.lane = lane, .message = std::string(message.data(), message.size())});
+        });
+
+        std::vector<char> buffer(SMALL_SOCKET_BUFFER_SIZE);
+
+        while(lane_messages.size() < expected_message_count)
+        {
+            const ssize_t bytes = read(m_client_file_descriptor, buffer.data(), buffer.size());
+
+            EXPECT_GT(bytes, 0);
+
+            if(bytes <= 0)
+            {
+                break;
+            }
+
+            decoder.Decode(std::span<char>(buffer.data(), bytes));
+        }
+    }
+
 protected:
-    int m_client_file_descriptor { -1 };
+    // Written by the server threads and read by the test cases
+    std::atomic<int> m_client_file_descriptor { -1 };
     int m_server_file_descriptor { -1 };
+    std::vector<int> m_filler_file_descriptors;
 };
 
 TEST_F(TcpApplicationClientTest, ConnectAndDisconnect)
@@ -323,6 +420,60 @@ TEST_F(TcpApplicationClientTest, SendSingleMessage)
     server_thread.join();
 }
 
+TEST_F(TcpApplicationClientTest, SendMessagesWithSocketPresets)
+{
+    for(SocketOptions socket_options : {SocketOptions::LowLatency(), SocketOptions::BulkThroughput()})
+    {
+        socket_options.keep_alive = true;
+        socket_options.keep_alive_idle = std::chrono::seconds(30);
+        socket_options.keep_alive_interval = std::chrono::seconds(5);
+        socket_options.keep_alive_probes = 3;
+
+        ClientOptions options;
+        options.socket = socket_options;
+
+        ApplicationClient client {IPV4_ADDRESS, PORT, options};
+
+        std::string message = "hello there";
+
+        std::binary_semaphore server_running_semaphore(0);
+        std::binary_semaphore server_done_semaphore(0);
+        std::binary_semaphore server_shutdown_semaphore(0);
+        std::thread server_thread (&TcpApplicationClientTest::StartMessageReceiverTcpServer, this, std::ref(server_running_semaphore), std::ref(server_done_semaphore), std::ref(server_shutdown_semaphore), message);
+
+        EXPECT_TRUE(client.Start());
+
+        while(not client.IsRunning())
+        {
+            std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+        }
+
+        server_running_semaphore.acquire();
+
+        EXPECT_TRUE(client.RequestOpen());
+
+        while(client.GetClientState() != ClientState::CONNECTED)
+        {
+            std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+        }
+
+        EXPECT_TRUE(client.EnqueuePayload(std::span<char>(message)));
+
+        server_done_semaphore.acquire();
+
+        EXPECT_TRUE(client.RequestClose());
+
+        while(client.GetClientState() != ClientState::NOT_CONNECTED)
+        {
+            std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+        }
+
+        server_shutdown_semaphore.release();
+
+        server_thread.join();
+    }
+}
+
 TEST_F(TcpApplicationClientTest, SendMultipleMessages)
 {
     const size_t message_count = 100;
@@ -383,27 +534,36 @@ TEST_F(TcpApplicationClientTest, SendMultipleMessages)
     server_thread.join();
 }
 
-TEST_F(TcpApplicationClientTest, FailSendingEmptyMessage)
-{   
-    std::string empty_message;
-    std::span<char> empty_message_view(empty_message);
-    EXPECT_FALSE(m_client.EnqueuePayload(empty_message_view));
-}
-
-TEST_F(TcpApplicationClientTest, SendLargeMessage)
+TEST_F(TcpApplicationClientTest, SendMultipleMessagesBatched)
 {
-    const size_t message_size = 8192;
-    std::string message (message_size,'x');
+    const size_t message_count = 100;
+    std::vector<std::string> messages (message_count);
+    std::string total_payload;
+
+    for(size_t count = 0; count < message_count; ++count)
+    {
+        // Mix small messages with ones that exceed the batch byte budget on their own
+        const size_t padding_size = (count % 10 == 0) ? 4096 : count;
+        messages[count] = "<hello there " + std::to_string(count) + std::string(padding_size, '.') + ">";
+        total_payload += messages[count];
+    }
+
+    ClientOptions options;
+    options.tx_batch.enabled = true;
+    options.tx_batch.max_payloads = 16;
+    options.tx_batch.max_bytes = 1024;
+
+    ApplicationClient batched_client {IPV4_ADDRESS, PORT, options};
 
     std::binary_semaphore server_running_semaphore(0);
     std::binary_semaphore server_done_semaphore(0);
     std::binary_semaphore server_shutdown_semaphore(0);
-    std::thread server_thread (&TcpApplicationClientTest::StartMessageReceiverTcpServer, this, std::ref(server_running_semaphore), std::ref(server_done_semaphore), std::ref(server_shutdown_semaphore), message);
+    std::thread server_thread (&TcpApplicationClientTest::StartMessageReceiverTcpServer, this, std::ref(server_running_semaphore), std::ref(server_done_semaphore), std::ref(server_shutdown_semaphore), total_payload);
 
-    EXPECT_TRUE(m_client.Start());
+    EXPECT_TRUE(batched_client.Start());
 
     // Do not proceed until the client is ready to begin
-    while(not m_client.IsRunning())
+    while(not batched_client.IsRunning())
     {
         std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
     }
@@ -411,126 +571,98 @@ TEST_F(TcpApplicationClientTest, SendLargeMessage)
     // Wait here until the server signals it is ready
     server_running_semaphore.acquire();
 
-    EXPECT_TRUE(m_client.RequestOpen());
+    EXPECT_TRUE(batched_client.RequestOpen());
 
-    while(m_client.GetClientState() != ClientState::CONNECTED)
+    while(batched_client.GetClientState() != ClientState::CONNECTED)
     {
         std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
     }
 
-    EXPECT_EQ(m_client.GetClientState(), ClientState::CONNECTED);
-
-    const std::span<char> message_view (message);
-
-    EXPECT_TRUE(m_client.EnqueuePayload(message_view));
+    for(std::string message : messages) 
+    {
+        const std::span<char> message_view (message);
+        EXPECT_TRUE(batched_client.EnqueuePayload(message_view));
+    }
 
     // wait for the server to signal that it is done reading
     server_done_semaphore.acquire();
 
-    EXPECT_TRUE(m_client.RequestClose());
+    EXPECT_TRUE(batched_client.RequestClose());
 
-    while(m_client.GetClientState() != ClientState::NOT_CONNECTED)
+    while(batched_client.GetClientState() != ClientState::NOT_CONNECTED)
     {
         std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
     }
 
-    EXPECT_EQ(m_client.GetClientState(), ClientState::NOT_CONNECTED);
-
     server_shutdown_semaphore.release();
 
     server_thread.join();
 }
 
-TEST_F(TcpApplicationClientTest, FailSendingMessageBeforeConnecting)
+TEST_F(TcpApplicationClientTest, SendOwnedPayloads)
 {
-    std::string message = "hello there";
-
-    bool is_error_callback_activated = false;
+    const std::string vector_message = "<moved vector>";
+    const std::string unique_message = "<unique buffer>";
+    const std::string shared_message = "<shared buffer>";
+    const std::string total_payload = vector_message + unique_message + shared_message;
 
-    m_client.SetErrorCallback([&](const Error& error, const std::optional<std::span<char>>& failed_tx_payload)
-    {   
-        EXPECT_EQ(Error::SOCKET_SEND_FAILURE, error);
-        EXPECT_TRUE(failed_tx_payload.has_value());
-
-        const std::span<char> failed_tx_payload_vec = failed_tx_payload.value();
-        const std::string failed_tx_payload_str(failed_tx_payload_vec.data(), failed_tx_payload_vec.size());
-
-        EXPECT_EQ(failed_tx_payload_str, message);
-
-        is_error_callback_activated = true;
-    });
+    std::binary_semaphore server_running_semaphore(0);
+    std::binary_semaphore server_done_semaphore(0);
+    std::binary_semaphore server_shutdown_semaphore(0);
+    std::thread server_thread (&TcpApplicationClientTest::StartMessageReceiverTcpServer, this, std::ref(server_running_semaphore), std::ref(server_done_semaphore), std::ref(server_shutdown_semaphore), total_payload);
 
     EXPECT_TRUE(m_client.Start());
 
-    // Do not proceed until the client worker threads are ready to begin
+    // Do not proceed until the client is ready to begin
     while(not m_client.IsRunning())
     {
         std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
     }
 
-    const std::span<char> message_view (message);
-
-    EXPECT_TRUE(m_client.EnqueuePayload(message_view));
+    // Wait here until the server signals it is ready
+    server_running_semaphore.acquire();
 
-    // wait for the error callback to be activated
+    EXPECT_TRUE(m_client.RequestOpen());
 
-    while(not is_error_callback_activated)
+    while(m_client.GetClientState() != ClientState::CONNECTED)
     {
         std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
     }
-}
-
-TEST_F(TcpApplicationClientTest, ReadLargeMessage)
-{
-    const size_t message_size = 8196;
-    const std::string message (8196, 'x');
-
-    bool is_rx_callback_activated = false;
-
-    std::binary_semaphore callback_semaphore(0);
-    std::binary_semaphore server_running_semaphore(0);
-    std::binary_semaphore server_shutdown_semaphore(0);
-    std::thread server_thread (&TcpApplicationClientTest::StartMessageSenderTcpServer, this, std::ref(server_running_semaphore), std::ref(server_shutdown_semaphore), message);
 
-    size_t bytes_received = 0;
-    std::string received_bytes;
+    std::counting_semaphore<3> completion_semaphore(0);
+    std::atomic<int> sent_count = 0;
 
-    m_client.SetRxCallback([&](const std::span<char>& rx_payload_view)
+    const TxCompletionCallback completion_callback = [&](bool is_sent)
     {
-        const std::string rx_payload (rx_payload_view.data(), rx_payload_view.size());
-
-        bytes_received += rx_payload.size();
-        received_bytes += rx_payload;
-
-        if(bytes_received == message.size())
+        if(is_sent)
         {
-            // signal the gtest function body thread to resume
-            callback_semaphore.release();
+            ++sent_count;
         }
-    });
 
-    EXPECT_TRUE(m_client.Start());
+        completion_semaphore.release();
+    };
 
-    // Do not proceed until the client worker threads are ready to begin
-    while(not m_client.IsRunning())
-    {
-        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
-    }
+    std::vector<char> vector_payload(vector_message.begin(), vector_message.end());
+    EXPECT_TRUE(m_client.EnqueuePayload(std::move(vector_payload), completion_callback));
 
-    // wait here until the server is ready
-    server_running_semaphore.acquire();
+    std::unique_ptr<char[]> unique_payload = std::make_unique<char[]>(unique_message.size());
+    std::copy(unique_message.begin(), unique_message.end(), unique_payload.get());
+    EXPECT_TRUE(m_client.EnqueuePayload(std::move(unique_payload), unique_message.size(), completion_callback));
 
-    EXPECT_TRUE(m_client.RequestOpen());
+    // The client keeps a reference to the shared payload only until the kernel has accepted it
+    SharedPayload shared_payload = std::make_shared<const std::vector<char>>(shared_message.begin(), shared_message.end());
+    EXPECT_TRUE(m_client.EnqueuePayload(shared_payload, completion_callback));
 
-    while(m_client.GetClientState() != ClientState::CONNECTED)
+    // wait for the server to signal that it is done reading
+    server_done_semaphore.acquire();
+
+    for(int count = 0; count < 3; ++count)
     {
-        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+        completion_semaphore.acquire();
     }
 
-    EXPECT_EQ(m_client.GetClientState(), ClientState::CONNECTED);
-
-    // wait for the RX callback to be activated
-    callback_semaphore.acquire();
+    EXPECT_EQ(sent_count, 3);
+    EXPECT_EQ(shared_payload.use_count(), 1);
 
     EXPECT_TRUE(m_client.RequestClose());
 
@@ -539,84 +671,1716 @@ TEST_F(TcpApplicationClientTest, ReadLargeMessage)
         std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
     }
 
-    EXPECT_EQ(m_client.GetClientState(), ClientState::NOT_CONNECTED);
-
-    // tell the server it can now shutdown
     server_shutdown_semaphore.release();
 
     server_thread.join();
-
-    EXPECT_EQ(message.size(), bytes_received);
-    EXPECT_EQ(message, received_bytes);
 }
 
-TEST_F(TcpApplicationClientTest, ReconnectAfterServerDisconnect)
+TEST_F(TcpApplicationClientTest, ClearOutboundPayloads)
 {
-    const int connection_attempts = 2;
-    std::binary_semaphore server_running_semaphore(0);
-    std::binary_semaphore server_shutdown_semaphore(0);
-    std::thread server_thread (&TcpApplicationClientTest::StartConnectionAccepterTcpServer, this, std::ref(server_running_semaphore), std::ref(server_shutdown_semaphore), connection_attempts);
+    // The large payload keeps the TX worker busy while the server reads it, so the small payloads are still queued when they are cleared
+    const size_t large_message_size = 32 * 1024 * 1024;
+    const std::string large_message (large_message_size, 'x');
+    const int small_message_count = 10;
 
-    std::binary_semaphore callback_semaphore(0);
-    const int expected_disconnect_count = 2;
-    int disconnect_count = 0;
+    // The server runs inline so that nothing is read until the large payload is known to be partially sent
+    m_server_file_descriptor = socket(AF_INET, SOCK_STREAM, 0);
+    EXPECT_NE(m_server_file_descriptor, -1);
+    sockaddr_in address{};
 
-    m_client.SetDisconnectedCallback([&]()
-    {
-        // This callback will be called when the client properly closes itself after the connection is severed from the server side. After this, request the client to open.
-        if(disconnect_count == 0)
-        {
-            EXPECT_TRUE(m_client.RequestOpen());
-            callback_semaphore.release();
-        }
+    const int server_socket_option = 1;
+    setsockopt(m_server_file_descriptor, SOL_SOCKET, SO_REUSEADDR, &server_socket_option, sizeof(server_socket_option));
 
-        ++disconnect_count;
-    });
+    address.sin_family = AF_INET;
+    inet_pton(AF_INET, IPV4_ADDRESS.c_str(), &address.sin_addr);
+    address.sin_port = htons(PORT);
+
+    EXPECT_NE(bind(m_server_file_descriptor, (sockaddr*)&address, sizeof(address)),-1);
+    EXPECT_NE(listen(m_server_file_descriptor, 1),-1);
 
     EXPECT_TRUE(m_client.Start());
 
-    // Do not proceed until the client worker threads are ready to begin
+    // Do not proceed until the client is ready to begin
     while(not m_client.IsRunning())
     {
         std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
     }
 
-    // wait here until the server is ready
-    server_running_semaphore.acquire();
-
-    // connect to the server for the first time
     EXPECT_TRUE(m_client.RequestOpen());
 
+    m_client_file_descriptor = accept(m_server_file_descriptor, nullptr, nullptr);
+    EXPECT_NE(m_client_file_descriptor, -1);
+
     while(m_client.GetClientState() != ClientState::CONNECTED)
     {
         std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
     }
 
-    // After the client connects for the first time, sever the client connection by closing the client file descriptor from the server's side (the gtest)
-    shutdown(m_client_file_descriptor,SHUT_RDWR);
-    close(m_client_file_descriptor);
+    std::counting_semaphore<small_message_count + 1> completion_semaphore(0);
+    std::atomic<bool> is_large_message_sent = false;
+    std::atomic<int> dropped_count = 0;
 
-    // wait for the client to react to the disconnection
-    callback_semaphore.acquire();
+    EXPECT_TRUE(m_client.EnqueuePayload(std::vector<char>(large_message.begin(), large_message.end()), [&](bool is_sent)
+    {
+        is_large_message_sent = is_sent;
+        completion_semaphore.release();
+    }));
 
-    while(m_client.GetClientState() != ClientState::CONNECTED)
+    for(int count = 0; count < small_message_count; ++count)
     {
-        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+        std::string message = "<hello there " + std::to_string(count) + ">";
+
+        EXPECT_TRUE(m_client.EnqueuePayload(std::span<char>(message), [&](bool is_sent)
+        {
+            if(not is_sent)
+            {
+                ++dropped_count;
+            }
+
+            completion_semaphore.release();
+        }));
     }
 
-    EXPECT_TRUE(m_client.RequestClose());
+    // Bytes waiting at the server mean that the TX worker has taken the large payload off the queue
+    int available_bytes = 0;
 
-    while(m_client.GetClientState() != ClientState::NOT_CONNECTED)
+    while(ioctl(m_client_file_descriptor, FIONREAD, &available_bytes) == 0 && available_bytes == 0)
     {
         std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
     }
 
-    // tell the server it can now shutdown
-    server_shutdown_semaphore.release();
+    m_client.ClearOutboundPayloads();
 
-    server_thread.join();
+    std::string received_payload;
+    std::vector<char> buffer(BUFFER_SIZE * 64);
 
-    EXPECT_EQ(disconnect_count, expected_disconnect_count);
+    while(received_payload.size() < large_message.size())
+    {
+        const ssize_t bytes = read(m_client_file_descriptor, buffer.data(), buffer.size());
+
+        ASSERT_GT(bytes, 0);
+
+        received_payload.append(buffer.data(), bytes);
+    }
+
+    EXPECT_EQ(received_payload, large_message);
+
+    for(int count = 0; count < small_message_count + 1; ++count)
+    {
+        completion_semaphore.acquire();
+    }
+
+    EXPECT_TRUE(is_large_message_sent);
+    EXPECT_EQ(dropped_count, small_message_count);
+
+    EXPECT_TRUE(m_client.RequestClose());
+
+    while(m_client.GetClientState() != ClientState::NOT_CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+}
+
+TEST_F(TcpApplicationClientTest, RejectPayloadsBeyondTxQueueLimits)
+{
+    // The clients are never started, so nothing drains their TX queues
+    ClientOptions payload_limited_options;
+    payload_limited_options.tx_queue.max_payloads = 2;
+
+    ApplicationClient payload_limited_client {IPV4_ADDRESS, PORT, payload_limited_options};
+    std::string message = "hello";
+
+    EXPECT_TRUE(payload_limited_client.EnqueuePayload(std::span<char>(message)));
+    EXPECT_TRUE(payload_limited_client.TryEnqueuePayload(std::span<char>(message)));
+    EXPECT_FALSE(payload_limited_client.EnqueuePayload(std::span<char>(message)));
+    EXPECT_FALSE(payload_limited_client.TryEnqueuePayload(std::span<char>(message)));
+
+    ClientOptions byte_limited_options;
+    byte_limited_options.tx_queue.max_bytes = 8;
+
+    ApplicationClient byte_limited_client {IPV4_ADDRESS, PORT, byte_limited_options};
+    std::string large_message (16, 'x');
+
+    // A payload larger than the limit still fits into an empty queue
+    EXPECT_TRUE(byte_limited_client.EnqueuePayload(std::span<char>(large_message)));
+    EXPECT_FALSE(byte_limited_client.EnqueuePayload(std::span<char>(message)));
+
+    ApplicationClient second_byte_limited_client {IPV4_ADDRESS, PORT, byte_limited_options};
+
+    EXPECT_TRUE(second_byte_limited_client.EnqueuePayload(std::span<char>(message)));
+    EXPECT_FALSE(second_byte_limited_client.EnqueuePayload(std::span<char>(message)));
+    EXPECT_TRUE(second_byte_limited_client.EnqueuePayload(std::span<char>(message.data(), 3)));
+}
+
+TEST_F(TcpApplicationClientTest, BlockUntilTxQueueHasRoom)
+{
+    ClientOptions options;
+    options.tx_queue.max_payloads = 1;
+    options.tx_queue.full_policy = TxQueueFullPolicy::BLOCK;
+    options.tx_queue.block_timeout = std::chrono::milliseconds(50);
+
+    std::string message = "hello";
+
+    // Nothing drains the queue of a client that is not started, so a blocked enqueue times out
+    {
+        ApplicationClient client {IPV4_ADDRESS, PORT, options};
+
+        EXPECT_TRUE(client.EnqueuePayload(std::span<char>(message)));
+        EXPECT_FALSE(client.TryEnqueuePayload(std::span<char>(message)));
+
+        const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+        EXPECT_FALSE(client.EnqueuePayload(std::span<char>(message)));
+        EXPECT_GE(std::chrono::steady_clock::now() - start_time, options.tx_queue.block_timeout);
+    }
+
+    options.tx_queue.block_timeout = std::chrono::seconds(5);
+
+    ApplicationClient client {IPV4_ADDRESS, PORT, options};
+
+    const size_t message_count = 100;
+    std::vector<std::string> messages (message_count);
+    std::string total_payload;
+
+    for(size_t count = 0; count < message_count; ++count)
+    {
+        messages[count] = "<hello there " + std::to_string(count) + ">";
+        total_payload += messages[count];
+    }
+
+    std::binary_semaphore server_running_semaphore(0);
+    std::binary_semaphore server_done_semaphore(0);
+    std::binary_semaphore server_shutdown_semaphore(0);
+    std::thread server_thread (&TcpApplicationClientTest::StartMessageReceiverTcpServer, this, std::ref(server_running_semaphore), std::ref(server_done_semaphore), std::ref(server_shutdown_semaphore), total_payload);
+
+    EXPECT_TRUE(client.Start());
+
+    while(not client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_running_semaphore.acquire();
+
+    EXPECT_TRUE(client.RequestOpen());
+
+    while(client.GetClientState() != ClientState::CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    // Every enqueue waits for the TX worker to pick up the previous payload
+    for(std::string& message : messages)
+    {
+        EXPECT_TRUE(client.EnqueuePayload(std::span<char>(message)));
+    }
+
+    server_done_semaphore.acquire();
+
+    EXPECT_TRUE(client.RequestClose());
+
+    while(client.GetClientState() != ClientState::NOT_CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_shutdown_semaphore.release();
+
+    server_thread.join();
+}
+
+TEST_F(TcpApplicationClientTest, DropOldestPayloadsWhenTxQueueIsFull)
+{
+    ClientOptions options;
+    options.tx_queue.max_payloads = 2;
+    options.tx_queue.full_policy = TxQueueFullPolicy::DROP_OLDEST;
+
+    // The client is never started, so the queued payloads stay queued until they are dropped
+    ApplicationClient client {IPV4_ADDRESS, PORT, options};
+
+    std::vector<SharedPayload> payloads;
+
+    for(char byte : {'a', 'b', 'c', 'd'})
+    {
+        payloads.push_back(std::make_shared<const std::vector<char>>(4, byte));
+        EXPECT_TRUE(client.EnqueuePayload(payloads.back()));
+    }
+
+    // A dropped payload's storage is released right away
+    EXPECT_EQ(payloads[0].use_count(), 1);
+    EXPECT_EQ(payloads[1].use_count(), 1);
+    EXPECT_GT(payloads[2].use_count(), 1);
+    EXPECT_GT(payloads[3].use_count(), 1);
+
+    if constexpr(ClientStatisticsRecorder::IS_COMPILED_IN)
+    {
+        EXPECT_EQ(client.GetStatistics().tx_queue_depth, 2);
+    }
+}
+
+TEST_F(TcpApplicationClientTest, AlternateTxWatermarkCallbacks)
+{
+    ClientOptions options;
+    options.tx_queue.high_watermark_bytes = 1;
+    options.tx_queue.low_watermark_bytes = 0;
+
+    ApplicationClient client {IPV4_ADDRESS, PORT, options};
+
+    std::mutex crossings_mutex;
+    std::string crossings;
+
+    client.SetTxHighWatermarkCallback([&]()
+    {
+        std::lock_guard<std::mutex> lock(crossings_mutex);
+        crossings += 'H';
+    });
+
+    client.SetTxLowWatermarkCallback([&]()
+    {
+        std::lock_guard<std::mutex> lock(crossings_mutex);
+        crossings += 'L';
+    });
+
+    const size_t message_count = 20;
+    std::string message = "hello there";
+    std::string total_payload;
+
+    for(size_t count = 0; count < message_count; ++count)
+    {
+        total_payload += message;
+    }
+
+    std::binary_semaphore server_running_semaphore(0);
+    std::binary_semaphore server_done_semaphore(0);
+    std::binary_semaphore server_shutdown_semaphore(0);
+    std::thread server_thread (&TcpApplicationClientTest::StartMessageReceiverTcpServer, this, std::ref(server_running_semaphore), std::ref(server_done_semaphore), std::ref(server_shutdown_semaphore), total_payload);
+
+    EXPECT_TRUE(client.Start());
+
+    while(not client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_running_semaphore.acquire();
+
+    EXPECT_TRUE(client.RequestOpen());
+
+    while(client.GetClientState() != ClientState::CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    for(size_t count = 0; count < message_count; ++count)
+    {
+        EXPECT_TRUE(client.EnqueuePayload(std::span<char>(message)));
+    }
+
+    server_done_semaphore.acquire();
+
+    EXPECT_TRUE(client.RequestClose());
+
+    while(client.GetClientState() != ClientState::NOT_CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_shutdown_semaphore.release();
+
+    server_thread.join();
+
+    std::lock_guard<std::mutex> lock(crossings_mutex);
+
+    // Any byte crosses the high watermark, and the drained queue ends below the low one
+    ASSERT_FALSE(crossings.empty());
+    EXPECT_EQ(crossings.size() % 2, 0);
+
+    for(size_t index = 0; index < crossings.size(); ++index)
+    {
+        EXPECT_EQ(crossings[index], index % 2 == 0 ? 'H' : 'L');
+    }
+}
+
+TEST_F(TcpApplicationClientTest, FailSendingEmptyMessage)
+{   
+    std::string empty_message;
+    std::span<char> empty_message_view(empty_message);
+    EXPECT_FALSE(m_client.EnqueuePayload(empty_message_view));
+}
+
+TEST_F(TcpApplicationClientTest, SendLargeMessage)
+{
+    const size_t message_size = 8192;
+    std::string message (message_size,'x');
+
+    std::binary_semaphore server_running_semaphore(0);
+    std::binary_semaphore server_done_semaphore(0);
+    std::binary_semaphore server_shutdown_semaphore(0);
+    std::thread server_thread (&TcpApplicationClientTest::StartMessageReceiverTcpServer, this, std::ref(server_running_semaphore), std::ref(server_done_semaphore), std::ref(server_shutdown_semaphore), message);
+
+    EXPECT_TRUE(m_client.Start());
+
+    // Do not proceed until the client is ready to begin
+    while(not m_client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    // Wait here until the server signals it is ready
+    server_running_semaphore.acquire();
+
+    EXPECT_TRUE(m_client.RequestOpen());
+
+    while(m_client.GetClientState() != ClientState::CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    EXPECT_EQ(m_client.GetClientState(), ClientState::CONNECTED);
+
+    const std::span<char> message_view (message);
+
+    EXPECT_TRUE(m_client.EnqueuePayload(message_view));
+
+    // wait for the server to signal that it is done reading
+    server_done_semaphore.acquire();
+
+    EXPECT_TRUE(m_client.RequestClose());
+
+    while(m_client.GetClientState() != ClientState::NOT_CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    EXPECT_EQ(m_client.GetClientState(), ClientState::NOT_CONNECTED);
+
+    server_shutdown_semaphore.release();
+
+    server_thread.join();
+}
+
+TEST_F(TcpApplicationClientTest, SendLargeMessagesWithZeroCopy)
+{
+    ClientOptions options;
+    options.zero_copy.enabled = true;
+    options.zero_copy.min_send_size = 64 * 1024;
+
+    ApplicationClient client {IPV4_ADDRESS, PORT, options};
+
+    const size_t message_count = 4;
+    const SharedPayload message = std::make_shared<const std::vector<char>>(256 * 1024, 'z');
+    const std::string expected_payload(message_count * message->size(), 'z');
+
+    std::binary_semaphore server_running_semaphore(0);
+    std::binary_semaphore server_done_semaphore(0);
+    std::binary_semaphore server_shutdown_semaphore(0);
+    std::thread server_thread (&TcpApplicationClientTest::StartMessageReceiverTcpServer, this, std::ref(server_running_semaphore), std::ref(server_done_semaphore), std::ref(server_shutdown_semaphore), expected_payload);
+
+    EXPECT_TRUE(client.Start());
+
+    while(not client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_running_semaphore.acquire();
+
+    EXPECT_TRUE(client.RequestOpen());
+
+    while(client.GetClientState() != ClientState::CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    std::atomic<size_t> sent_count { 0 };
+
+    for(size_t count = 0; count < message_count; ++count)
+    {
+        EXPECT_TRUE(client.EnqueuePayload(message, [&](bool is_sent)
+        {
+            EXPECT_TRUE(is_sent);
+            ++sent_count;
+        }));
+    }
+
+    server_done_semaphore.acquire();
+
+    // The client lets go of the payload once the kernel has reported the zero-copy sends (or the copies it made instead)
+    for(int attempt = 0; attempt < 500 && (message.use_count() > 1 || sent_count < message_count); ++attempt)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    EXPECT_EQ(sent_count, message_count);
+    EXPECT_EQ(message.use_count(), 1);
+
+    EXPECT_TRUE(client.RequestClose());
+
+    while(client.GetClientState() != ClientState::NOT_CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_shutdown_semaphore.release();
+
+    server_thread.join();
+}
+
+TEST_F(TcpApplicationClientTest, TimeOutConnectingToUnresponsiveServer)
+{
+    ClientOptions options;
+    options.connect.timeout = std::chrono::milliseconds(100);
+
+    ApplicationClient client {IPV4_ADDRESS, PORT, options};
+
+    std::binary_semaphore callback_semaphore(0);
+
+    client.SetErrorCallback([&](const Error& error, const std::optional<std::span<char>>& failed_tx_payload)
+    {
+        EXPECT_EQ(Error::SOCKET_CONNECT_FAILURE, error);
+        EXPECT_FALSE(failed_tx_payload.has_value());
+        callback_semaphore.release();
+    });
+
+    StartUnresponsiveTcpServer();
+
+    EXPECT_TRUE(client.Start());
+
+    while(not client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    const std::chrono::steady_clock::time_point open_time = std::chrono::steady_clock::now();
+
+    EXPECT_TRUE(client.RequestOpen());
+
+    // Without the timeout, the kernel would keep retrying the SYN for minutes
+    EXPECT_TRUE(callback_semaphore.try_acquire_for(std::chrono::seconds(5)));
+
+    EXPECT_GE(std::chrono::steady_clock::now() - open_time, options.connect.timeout);
+
+    while(client.GetClientState() != ClientState::NOT_CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+}
+
+TEST_F(TcpApplicationClientTest, CancelConnectingWithRequestClose)
+{
+    std::atomic<bool> is_callback_activated { false };
+
+    m_client.SetErrorCallback([&](const Error& error, const std::optional<std::span<char>>& failed_tx_payload)
+    {
+        (void)error;
+        (void)failed_tx_payload;
+        is_callback_activated = true;
+    });
+
+    m_client.SetDisconnectedCallback([&]()
+    {
+        is_callback_activated = true;
+    });
+
+    StartUnresponsiveTcpServer();
+
+    EXPECT_TRUE(m_client.Start());
+
+    while(not m_client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    EXPECT_TRUE(m_client.RequestOpen());
+
+    // Let the connection monitor thread get stuck in the attempt
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    EXPECT_EQ(m_client.GetClientState(), ClientState::OPENING);
+    EXPECT_TRUE(m_client.RequestClose());
+
+    for(int attempt = 0; attempt < 500 && m_client.GetClientState() != ClientState::NOT_CONNECTED; ++attempt)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    EXPECT_EQ(m_client.GetClientState(), ClientState::NOT_CONNECTED);
+    EXPECT_FALSE(is_callback_activated);
+}
+
+TEST_F(TcpApplicationClientTest, HoldPayloadsWhileConnecting)
+{
+    ClientOptions options;
+    options.connect.timeout = std::chrono::milliseconds(300);
+
+    ApplicationClient client {IPV4_ADDRESS, PORT, options};
+
+    std::string message = "hello there";
+    std::binary_semaphore callback_semaphore(0);
+
+    client.SetErrorCallback([&](const Error& error, const std::optional<std::span<char>>& failed_tx_payload)
+    {
+        // The payload only fails once the connection attempt has failed
+        if(error == Error::SOCKET_SEND_FAILURE)
+        {
+            EXPECT_TRUE(failed_tx_payload.has_value());
+            callback_semaphore.release();
+        }
+    });
+
+    StartUnresponsiveTcpServer();
+
+    EXPECT_TRUE(client.Start());
+
+    while(not client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    EXPECT_TRUE(client.RequestOpen());
+
+    // Let the connection monitor thread get stuck in the attempt
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    EXPECT_EQ(client.GetClientState(), ClientState::OPENING);
+    EXPECT_TRUE(client.EnqueuePayload(std::span<char>(message)));
+
+    EXPECT_TRUE(callback_semaphore.try_acquire_for(std::chrono::seconds(5)));
+
+    // The TX worker thread tries once on the connecting socket and once after the attempt has failed, rather than spinning in between
+    if constexpr(ClientStatisticsRecorder::IS_COMPILED_IN)
+    {
+        EXPECT_LE(client.GetStatistics().send_calls, 2);
+    }
+
+    while(client.GetClientState() != ClientState::NOT_CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+}
+
+TEST_F(TcpApplicationClientTest, FailSendingMessageBeforeConnecting)
+{
+    std::string message = "hello there";
+
+    bool is_error_callback_activated = false;
+
+    m_client.SetErrorCallback([&](const Error& error, const std::optional<std::span<char>>& failed_tx_payload)
+    {   
+        EXPECT_EQ(Error::SOCKET_SEND_FAILURE, error);
+        EXPECT_TRUE(failed_tx_payload.has_value());
+
+        const std::span<char> failed_tx_payload_vec = failed_tx_payload.value();
+        const std::string failed_tx_payload_str(failed_tx_payload_vec.data(), failed_tx_payload_vec.size());
+
+        EXPECT_EQ(failed_tx_payload_str, message);
+
+        is_error_callback_activated = true;
+    });
+
+    EXPECT_TRUE(m_client.Start());
+
+    // Do not proceed until the client worker threads are ready to begin
+    while(not m_client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    const std::span<char> message_view (message);
+
+    EXPECT_TRUE(m_client.EnqueuePayload(message_view));
+
+    // wait for the error callback to be activated
+
+    while(not is_error_callback_activated)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+}
+
+TEST_F(TcpApplicationClientTest, FailSendingOwnedPayloadBeforeConnecting)
+{
+    std::binary_semaphore completion_semaphore(0);
+    bool is_payload_sent = true;
+
+    EXPECT_TRUE(m_client.Start());
+
+    // Do not proceed until the client worker threads are ready to begin
+    while(not m_client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    std::vector<char> payload {'h', 'e', 'l', 'l', 'o'};
+
+    EXPECT_TRUE(m_client.EnqueuePayload(std::move(payload), [&](bool is_sent)
+    {
+        is_payload_sent = is_sent;
+        completion_semaphore.release();
+    }));
+
+    completion_semaphore.acquire();
+
+    EXPECT_FALSE(is_payload_sent);
+}
+
+TEST_F(TcpApplicationClientTest, FailSendingEmptyOwnedPayloads)
+{
+    EXPECT_FALSE(m_client.EnqueuePayload(std::vector<char>()));
+    EXPECT_FALSE(m_client.EnqueuePayload(std::unique_ptr<char[]>(), 16));
+    EXPECT_FALSE(m_client.EnqueuePayload(SharedPayload()));
+}
+
+TEST_F(TcpApplicationClientTest, ReadLargeMessage)
+{
+    const size_t message_size = 8196;
+    const std::string message (8196, 'x');
+
+    bool is_rx_callback_activated = false;
+
+    std::binary_semaphore callback_semaphore(0);
+    std::binary_semaphore server_running_semaphore(0);
+    std::binary_semaphore server_shutdown_semaphore(0);
+    std::thread server_thread (&TcpApplicationClientTest::StartMessageSenderTcpServer, this, std::ref(server_running_semaphore), std::ref(server_shutdown_semaphore), message);
+
+    size_t bytes_received = 0;
+    std::string received_bytes;
+
+    m_client.SetRxCallback([&](const std::span<char>& rx_payload_view)
+    {
+        const std::string rx_payload (rx_payload_view.data(), rx_payload_view.size());
+
+        bytes_received += rx_payload.size();
+        received_bytes += rx_payload;
+
+        if(bytes_received == message.size())
+        {
+            // signal the gtest function body thread to resume
+            callback_semaphore.release();
+        }
+    });
+
+    EXPECT_TRUE(m_client.Start());
+
+    // Do not proceed until the client worker threads are ready to begin
+    while(not m_client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    // wait here until the server is ready
+    server_running_semaphore.acquire();
+
+    EXPECT_TRUE(m_client.RequestOpen());
+
+    while(m_client.GetClientState() != ClientState::CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    EXPECT_EQ(m_client.GetClientState(), ClientState::CONNECTED);
+
+    // wait for the RX callback to be activated
+    callback_semaphore.acquire();
+
+    EXPECT_TRUE(m_client.RequestClose());
+
+    while(m_client.GetClientState() != ClientState::NOT_CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    EXPECT_EQ(m_client.GetClientState(), ClientState::NOT_CONNECTED);
+
+    // tell the server it can now shutdown
+    server_shutdown_semaphore.release();
+
+    server_thread.join();
+
+    EXPECT_EQ(message.size(), bytes_received);
+    EXPECT_EQ(message, received_bytes);
+}
+
+TEST_F(TcpApplicationClientTest, ReadLargeMessageIntoRetainedBuffers)
+{
+    const size_t message_size = 256 * 1024;
+    std::string message;
+
+    for(size_t index = 0; index < message_size; ++index)
+    {
+        message.push_back(static_cast<char>('a' + index % 26));
+    }
+
+    ClientOptions options;
+    options.rx_buffer.buffer_size = 1024;
+    options.rx_buffer.max_buffer_size = 64 * 1024;
+
+    ApplicationClient client {IPV4_ADDRESS, PORT, options};
+
+    std::binary_semaphore callback_semaphore(0);
+    std::binary_semaphore server_running_semaphore(0);
+    std::binary_semaphore server_shutdown_semaphore(0);
+    std::thread server_thread (&TcpApplicationClientTest::StartMessageSenderTcpServer, this, std::ref(server_running_semaphore), std::ref(server_shutdown_semaphore), message);
+
+    // Every buffer is retained, so the client has to read each chunk into a buffer that no callback holds
+    std::vector<std::pair<RxBufferRef, std::span<char>>> retained_buffers;
+    size_t bytes_received = 0;
+
+    client.SetRxBufferCallback([&](const RxBufferRef& rx_buffer, const std::span<char>& rx_bytes)
+    {
+        retained_buffers.emplace_back(rx_buffer, rx_bytes);
+        bytes_received += rx_bytes.size();
+
+        if(bytes_received == message.size())
+        {
+            callback_semaphore.release();
+        }
+    });
+
+    EXPECT_TRUE(client.Start());
+
+    while(not client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_running_semaphore.acquire();
+
+    EXPECT_TRUE(client.RequestOpen());
+
+    callback_semaphore.acquire();
+
+    EXPECT_TRUE(client.RequestClose());
+
+    while(client.GetClientState() != ClientState::NOT_CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_shutdown_semaphore.release();
+
+    server_thread.join();
+
+    std::string received_bytes;
+
+    for(const auto& [rx_buffer, rx_bytes] : retained_buffers)
+    {
+        EXPECT_GE(rx_buffer.GetData() + rx_buffer.GetSize(), rx_bytes.data() + rx_bytes.size());
+        received_bytes.append(rx_bytes.data(), rx_bytes.size());
+    }
+
+    EXPECT_EQ(message, received_bytes);
+}
+
+TEST_F(TcpApplicationClientTest, SendFramedMessages)
+{
+    ClientOptions options;
+    options.framing.enabled = true;
+    options.framing.header_size = FrameHeaderSize::TWO_BYTES;
+    options.framing.byte_order = std::endian::big;
+
+    ApplicationClient client {IPV4_ADDRESS, PORT, options};
+
+    const std::vector<std::string> messages {"<hello>", "<there>", std::string(300, 'x')};
+    const std::string expected_payload = std::string("\x00\x07", 2) + messages[0] + std::string("\x00\x07", 2) + messages[1] + std::string("\x01\x2C", 2) + messages[2];
+
+    std::binary_semaphore server_running_semaphore(0);
+    std::binary_semaphore server_done_semaphore(0);
+    std::binary_semaphore server_shutdown_semaphore(0);
+    std::thread server_thread (&TcpApplicationClientTest::StartMessageReceiverTcpServer, this, std::ref(server_running_semaphore), std::ref(server_done_semaphore), std::ref(server_shutdown_semaphore), expected_payload);
+
+    EXPECT_TRUE(client.Start());
+
+    while(not client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_running_semaphore.acquire();
+
+    EXPECT_TRUE(client.RequestOpen());
+
+    while(client.GetClientState() != ClientState::CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    for(const std::string& message : messages)
+    {
+        EXPECT_TRUE(client.EnqueuePayload(std::vector<char>(message.begin(), message.end())));
+    }
+
+    // A two byte header cannot describe a payload of 64 KB or more
+    EXPECT_FALSE(client.EnqueuePayload(std::vector<char>(0x10000, 'x')));
+
+    server_done_semaphore.acquire();
+
+    EXPECT_TRUE(client.RequestClose());
+
+    while(client.GetClientState() != ClientState::NOT_CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_shutdown_semaphore.release();
+
+    server_thread.join();
+}
+
+TEST_F(TcpApplicationClientTest, ReceiveFramedMessages)
+{
+    ClientOptions options;
+    options.framing.enabled = true;
+    options.framing.header_size = FrameHeaderSize::FOUR_BYTES;
+    options.framing.byte_order = std::endian::little;
+
+    ApplicationClient client {IPV4_ADDRESS, PORT, options};
+
+    // The large message straddles several reads of the default RX buffer, the small ones are delivered straight from it
+    const std::vector<std::string> messages {"<hello>", std::string(5000, 'x'), "<there>"};
+    std::string outbound_payload;
+
+    for(const std::string& message : messages)
+    {
+        const uint32_t message_size = message.size();
+        outbound_payload += std::string(reinterpret_cast<const char*>(&message_size), sizeof(message_size)) + message;
+    }
+
+    std::binary_semaphore callback_semaphore(0);
+    std::binary_semaphore server_running_semaphore(0);
+    std::binary_semaphore server_shutdown_semaphore(0);
+    std::thread server_thread (&TcpApplicationClientTest::StartMessageSenderTcpServer, this, std::ref(server_running_semaphore), std::ref(server_shutdown_semaphore), outbound_payload);
+
+    std::vector<std::string> received_messages;
+
+    client.SetRxCallback([&](const std::span<char>& rx_bytes)
+    {
+        received_messages.emplace_back(rx_bytes.data(), rx_bytes.size());
+
+        if(received_messages.size() == messages.size())
+        {
+            callback_semaphore.release();
+        }
+    });
+
+    EXPECT_TRUE(client.Start());
+
+    while(not client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_running_semaphore.acquire();
+
+    EXPECT_TRUE(client.RequestOpen());
+
+    callback_semaphore.acquire();
+
+    EXPECT_TRUE(client.RequestClose());
+
+    while(client.GetClientState() != ClientState::NOT_CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_shutdown_semaphore.release();
+
+    server_thread.join();
+
+    EXPECT_EQ(received_messages, messages);
+}
+
+TEST_F(TcpApplicationClientTest, InterleaveControlMessagesWithBulkPayload)
+{
+    ClientOptions options;
+    options.tx_lanes.enabled = true;
+    options.tx_lanes.lane_count = 2;
+    options.tx_lanes.scheduling = TxLaneScheduling::STRICT;
+    options.socket.send_buffer_size = SMALL_SOCKET_BUFFER_SIZE;
+
+    ApplicationClient client {IPV4_ADDRESS, PORT, options};
+
+    const std::string bulk_payload = std::string(8 * 1024 * 1024, 'b');
+    const std::vector<std::string> control_messages {"<stop>", "<go>", "<status>"};
+    std::vector<LaneMessage> lane_messages;
+
+    std::binary_semaphore server_running_semaphore(0);
+    std::binary_semaphore start_reading_semaphore(0);
+    std::thread server_thread (&TcpApplicationClientTest::StartLaneMessageReceiverTcpServer, this, std::ref(server_running_semaphore), std::ref(start_reading_semaphore), control_messages.size() + 1, std::ref(lane_messages));
+
+    EXPECT_TRUE(client.Start());
+
+    while(not client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_running_semaphore.acquire();
+
+    EXPECT_TRUE(client.RequestOpen());
+
+    while(client.GetClientState() != ClientState::CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    // The bulk payload fills the socket buffers while the server is not reading, and the control messages are enqueued behind it
+    EXPECT_TRUE(client.EnqueuePayload(std::vector<char>(bulk_payload.begin(), bulk_payload.end()), nullptr, 1));
+
+    for(const std::string& control_message : control_messages)
+    {
+        EXPECT_TRUE(client.EnqueuePayload(std::vector<char>(control_message.begin(), control_message.end()), nullptr, 0));
+    }
+
+    EXPECT_FALSE(client.EnqueuePayload(std::vector<char>(1, 'x'), nullptr, 2));
+
+    start_reading_semaphore.release();
+    server_thread.join();
+
+    ASSERT_EQ(lane_messages.size(), control_messages.size() + 1);
+
+    for(size_t index = 0; index < control_messages.size(); ++index)
+    {
+        EXPECT_EQ(lane_messages[index].lane, 0);
+        EXPECT_EQ(lane_messages[index].message, control_messages[index]);
+    }
+
+    EXPECT_EQ(lane_messages.back().lane, 1);
+    EXPECT_TRUE(lane_messages.back().message == bulk_payload);
+
+    EXPECT_TRUE(client.RequestClose());
+
+    while(client.GetClientState() != ClientState::NOT_CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+}
+
+TEST_F(TcpApplicationClientTest, ShareConnectionBetweenWeightedLanes)
+{
+    ClientOptions options;
+    options.tx_lanes.enabled = true;
+    options.tx_lanes.lane_count = 3;
+    options.tx_lanes.scheduling = TxLaneScheduling::WEIGHTED;
+    options.tx_lanes.weights = {3, 1, 1};
+    options.tx_lanes.chunk_size = 4 * 1024;
+    options.socket.send_buffer_size = SMALL_SOCKET_BUFFER_SIZE;
+
+    ApplicationClient client {IPV4_ADDRESS, PORT, options};
+
+    const std::string first_payload = std::string(4 * 1024 * 1024, '1');
+    const std::string second_payload = std::string(1024 * 1024, '2');
+    const std::string third_payload = "small";
+    std::vector<LaneMessage> lane_messages;
+    std::atomic<int> completed_payloads { 0 };
+
+    const auto completion_callback = [&](bool is_sent)
+    {
+        EXPECT_TRUE(is_sent);
+        ++completed_payloads;
+    };
+
+    std::binary_semaphore server_running_semaphore(0);
+    std::binary_semaphore start_reading_semaphore(0);
+    std::thread server_thread (&TcpApplicationClientTest::StartLaneMessageReceiverTcpServer, this, std::ref(server_running_semaphore), std::ref(start_reading_semaphore), 3, std::ref(lane_messages));
+
+    EXPECT_TRUE(client.Start());
+
+    while(not client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_running_semaphore.acquire();
+
+    EXPECT_TRUE(client.RequestOpen());
+
+    while(client.GetClientState() != ClientState::CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    // The least important lane's payload is enqueued first, and the heavier lane still overtakes it without starving the third lane
+    EXPECT_TRUE(client.EnqueuePayload(std::vector<char>(first_payload.begin(), first_payload.end()), completion_callback, 1));
+    EXPECT_TRUE(client.EnqueuePayload(std::vector<char>(second_payload.begin(), second_payload.end()), completion_callback, 0));
+    EXPECT_TRUE(client.EnqueuePayload(std::vector<char>(third_payload.begin(), third_payload.end()), completion_callback, 2));
+
+    start_reading_semaphore.release();
+    server_thread.join();
+
+    ASSERT_EQ(lane_messages.size(), 3);
+
+    EXPECT_EQ(lane_messages[0].lane, 2);
+    EXPECT_EQ(lane_messages[0].message, third_payload);
+    EXPECT_EQ(lane_messages[1].lane, 0);
+    EXPECT_TRUE(lane_messages[1].message == second_payload);
+    EXPECT_EQ(lane_messages[2].lane, 1);
+    EXPECT_TRUE(lane_messages[2].message == first_payload);
+
+    while(completed_payloads < 3)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    EXPECT_TRUE(client.RequestClose());
+
+    while(client.GetClientState() != ClientState::NOT_CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+}
+
+TEST_F(TcpApplicationClientTest, ReconnectAfterServerDisconnect)
+{
+    const int connection_attempts = 2;
+    std::binary_semaphore server_running_semaphore(0);
+    std::binary_semaphore server_shutdown_semaphore(0);
+    std::thread server_thread (&TcpApplicationClientTest::StartConnectionAccepterTcpServer, this, std::ref(server_running_semaphore), std::ref(server_shutdown_semaphore), connection_attempts);
+
+    std::binary_semaphore callback_semaphore(0);
+    const int expected_disconnect_count = 2;
+    int disconnect_count = 0;
+
+    m_client.SetDisconnectedCallback([&]()
+    {
+        // This callback will be called when the client properly closes itself after the connection is severed from the server side. After this, request the client to open.
+        if(disconnect_count == 0)
+        {
+            EXPECT_TRUE(m_client.RequestOpen());
+            callback_semaphore.release();
+        }
+
+        ++disconnect_count;
+    });
+
+    EXPECT_TRUE(m_client.Start());
+
+    // Do not proceed until the client worker threads are ready to begin
+    while(not m_client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    // wait here until the server is ready
+    server_running_semaphore.acquire();
+
+    // connect to the server for the first time
+    EXPECT_TRUE(m_client.RequestOpen());
+
+    while(m_client.GetClientState() != ClientState::CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    // The client can observe the connection before the server thread has accepted it
+    while(m_client_file_descriptor == -1)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    // After the client connects for the first time, sever the client connection by closing the client file descriptor from the server's side (the gtest)
+    shutdown(m_client_file_descriptor,SHUT_RDWR);
+    close(m_client_file_descriptor);
+
+    // wait for the client to react to the disconnection
+    callback_semaphore.acquire();
+
+    while(m_client.GetClientState() != ClientState::CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    EXPECT_TRUE(m_client.RequestClose());
+
+    while(m_client.GetClientState() != ClientState::NOT_CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    // tell the server it can now shutdown
+    server_shutdown_semaphore.release();
+
+    server_thread.join();
+
+    EXPECT_EQ(disconnect_count, expected_disconnect_count);
+
+    if constexpr(ClientStatisticsRecorder::IS_COMPILED_IN)
+    {
+        EXPECT_EQ(m_client.GetStatistics().reconnects, 1);
+    }
+}
+
+TEST_F(TcpApplicationClientTest, ReconnectAndReplayQueuedPayloads)
+{
+    ClientOptions options;
+    options.reconnect.enabled = true;
+    options.reconnect.initial_delay = std::chrono::milliseconds(20);
+    options.reconnect.jitter = 0.0;
+
+    ApplicationClient client {IPV4_ADDRESS, PORT, options};
+
+    std::string message = "sent while reconnecting";
+    const size_t message_count = 10;
+    std::string expected_payload;
+
+    for(size_t count = 0; count < message_count; ++count)
+    {
+        expected_payload += message;
+    }
+
+    std::binary_semaphore server_running_semaphore(0);
+    std::binary_semaphore disconnected_semaphore(0);
+    std::atomic<int> connection_count { 0 };
+
+    client.SetConnectionCallback([&]()
+    {
+        ++connection_count;
+    });
+
+    client.SetDisconnectedCallback([&]()
+    {
+        disconnected_semaphore.release();
+    });
+
+    std::thread server_thread ([&]()
+    {
+        m_server_file_descriptor = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address{};
+
+        const int server_socket_option = 1;
+        setsockopt(m_server_file_descriptor, SOL_SOCKET, SO_REUSEADDR, &server_socket_option, sizeof(server_socket_option));
+
+        address.sin_family = AF_INET;
+        inet_pton(AF_INET, IPV4_ADDRESS.c_str(), &address.sin_addr);
+        address.sin_port = htons(PORT);
+
+        EXPECT_NE(bind(m_server_file_descriptor, (sockaddr*)&address, sizeof(address)),-1);
+        EXPECT_NE(listen(m_server_file_descriptor, 2),-1);
+
+        server_running_semaphore.release();
+
+        // Sever the first connection right away, then read everything from the second one
+        const int first_file_descriptor = accept(m_server_file_descriptor, nullptr, nullptr);
+        EXPECT_NE(first_file_descriptor, -1);
+        shutdown(first_file_descriptor, SHUT_RDWR);
+        close(first_file_descriptor);
+
+        m_client_file_descriptor = accept(m_server_file_descriptor, nullptr, nullptr);
+        EXPECT_NE(m_client_file_descriptor, -1);
+
+        std::string received_payload;
+
+        while(received_payload.size() < expected_payload.size())
+        {
+            std::vector<char> buffer(BUFFER_SIZE);
+            const ssize_t bytes = read(m_client_file_descriptor, buffer.data(), buffer.size());
+
+            EXPECT_GT(bytes, 0);
+
+            if(bytes <= 0)
+            {
+                break;
+            }
+
+            received_payload += std::string(buffer.data(), bytes);
+        }
+
+        EXPECT_EQ(received_payload, expected_payload);
+    });
+
+    EXPECT_TRUE(client.Start());
+
+    while(not client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_running_semaphore.acquire();
+
+    EXPECT_TRUE(client.RequestOpen());
+
+    // The disconnected callback runs once the client has noticed the lost connection, and before it tries to reconnect
+    disconnected_semaphore.acquire();
+
+    for(size_t count = 0; count < message_count; ++count)
+    {
+        EXPECT_TRUE(client.EnqueuePayload(std::span<char>(message)));
+    }
+
+    server_thread.join();
+
+    EXPECT_EQ(client.GetClientState(), ClientState::CONNECTED);
+    EXPECT_EQ(connection_count, 2);
+
+    if constexpr(ClientStatisticsRecorder::IS_COMPILED_IN)
+    {
+        const ClientStatistics statistics = client.GetStatistics();
+
+        EXPECT_GE(statistics.reconnect_attempts, 1);
+        EXPECT_GE(statistics.last_time_to_reconnect_nanoseconds, 20000000);
+        EXPECT_EQ(statistics.max_time_to_reconnect_nanoseconds, statistics.last_time_to_reconnect_nanoseconds);
+    }
+
+    EXPECT_TRUE(client.RequestClose());
+
+    while(client.GetClientState() != ClientState::NOT_CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+}
+
+TEST_F(TcpApplicationClientTest, RestartChunkedPayloadAfterReconnecting)
+{
+    ClientOptions options;
+    options.tx_lanes.enabled = true;
+    options.tx_lanes.lane_count = 2;
+    options.socket.send_buffer_size = SMALL_SOCKET_BUFFER_SIZE;
+    options.reconnect.enabled = true;
+    options.reconnect.initial_delay = std::chrono::milliseconds(20);
+    options.reconnect.jitter = 0.0;
+
+    ApplicationClient client {IPV4_ADDRESS, PORT, options};
+
+    const std::string bulk_payload = std::string(4 * 1024 * 1024, 'b');
+    std::atomic<bool> is_bulk_payload_sent { false };
+
+    std::binary_semaphore server_running_semaphore(0);
+
+    std::thread server_thread ([&]()
+    {
+        m_server_file_descriptor = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address{};
+
+        const int server_socket_option = 1;
+        setsockopt(m_server_file_descriptor, SOL_SOCKET, SO_REUSEADDR, &server_socket_option, sizeof(server_socket_option));
+
+        const int receive_buffer_size = SMALL_SOCKET_BUFFER_SIZE;
+        setsockopt(m_server_file_descriptor, SOL_SOCKET, SO_RCVBUF, &receive_buffer_size, sizeof(receive_buffer_size));
+
+        address.sin_family = AF_INET;
+        inet_pton(AF_INET, IPV4_ADDRESS.c_str(), &address.sin_addr);
+        address.sin_port = htons(PORT);
+
+        EXPECT_NE(bind(m_server_file_descriptor, (sockaddr*)&address, sizeof(address)),-1);
+        EXPECT_NE(listen(m_server_file_descriptor, 2),-1);
+
+        server_running_semaphore.release();
+
+        // Sever the first connection in the middle of the payload's chunks
+        const int first_file_descriptor = accept(m_server_file_descriptor, nullptr, nullptr);
+        EXPECT_NE(first_file_descriptor, -1);
+
+        std::vector<char> buffer(SMALL_SOCKET_BUFFER_SIZE);
+        size_t first_received_bytes = 0;
+
+        while(first_received_bytes < 128 * 1024)
+        {
+            const ssize_t bytes = read(first_file_descriptor, buffer.data(), buffer.size());
+            EXPECT_GT(bytes, 0);
+
+            if(bytes <= 0)
+            {
+                break;
+            }
+
+            first_received_bytes += bytes;
+        }
+
+        shutdown(first_file_descriptor, SHUT_RDWR);
+        close(first_file_descriptor);
+
+        m_client_file_descriptor = accept(m_server_file_descriptor, nullptr, nullptr);
+        EXPECT_NE(m_client_file_descriptor, -1);
+
+        std::vector<LaneMessage> lane_messages;
+
+        ChunkDecoder decoder([&](size_t lane, const std::span<char>& message)
+        {
+            lane_messages.push_back(LaneMessage{.lane = lane, .message = std::string(message.data(), message.size())});
+        });
+
+        while(lane_messages.empty())
+        {
+            const ssize_t bytes = read(m_client_file_descriptor, buffer.data(), buffer.size());
+            EXPECT_GT(bytes, 0);
+
+            if(bytes <= 0)
+            {
+                break;
+            }
+
+            decoder.Decode(std::span<char>(buffer.data(), bytes));
+        }
+
+        // The new connection starts with the payload's first chunk, so the peer receives it whole
+        ASSERT_EQ(lane_messages.size(), 1);
+        EXPECT_EQ(lane_messages[0].lane, 1);
+        EXPECT_TRUE(lane_messages[0].message == bulk_payload);
+    });
+
+    EXPECT_TRUE(client.Start());
+
+    while(not client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_running_semaphore.acquire();
+
+    EXPECT_TRUE(client.RequestOpen());
+
+    while(client.GetClientState() != ClientState::CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    EXPECT_TRUE(client.EnqueuePayload(std::vector<char>(bulk_payload.begin(), bulk_payload.end()), [&](bool is_sent)
+    {
+        is_bulk_payload_sent = is_sent;
+    }, 1));
+
+    server_thread.join();
+
+    while(not is_bulk_payload_sent)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    EXPECT_TRUE(client.RequestClose());
+
+    while(client.GetClientState() != ClientState::NOT_CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+}
+
+TEST_F(TcpApplicationClientTest, GiveUpReconnectingAfterMaxAttempts)
+{
+    ClientOptions options;
+    options.reconnect.enabled = true;
+    options.reconnect.initial_delay = std::chrono::milliseconds(5);
+    options.reconnect.max_attempts = 3;
+
+    ApplicationClient client {IPV4_ADDRESS, PORT, options};
+
+    std::binary_semaphore server_running_semaphore(0);
+    std::binary_semaphore server_shutdown_semaphore(0);
+    std::thread server_thread (&TcpApplicationClientTest::StartConnectionAccepterTcpServer, this, std::ref(server_running_semaphore), std::ref(server_shutdown_semaphore), 1);
+
+    std::binary_semaphore reconnect_failure_semaphore(0);
+
+    client.SetErrorCallback([&](const Error& error, const std::optional<std::span<char>>& failed_tx_payload)
+    {
+        EXPECT_FALSE(failed_tx_payload.has_value());
+
+        if(error == Error::RECONNECT_FAILURE)
+        {
+            reconnect_failure_semaphore.release();
+        }
+    });
+
+    EXPECT_TRUE(client.Start());
+
+    while(not client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_running_semaphore.acquire();
+
+    EXPECT_TRUE(client.RequestOpen());
+
+    while(client.GetClientState() != ClientState::CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    // Shut the server down completely, so that every reconnect attempt is refused
+    server_shutdown_semaphore.release();
+    server_thread.join();
+
+    reconnect_failure_semaphore.acquire();
+
+    EXPECT_EQ(client.GetClientState(), ClientState::NOT_CONNECTED);
+
+    if constexpr(ClientStatisticsRecorder::IS_COMPILED_IN)
+    {
+        EXPECT_EQ(client.GetStatistics().reconnect_attempts, 3);
+    }
+
+    // There is no connection left to close
+    EXPECT_FALSE(client.RequestClose());
+}
+
+TEST_F(TcpApplicationClientTest, CollectTxStatistics)
+{
+    if constexpr(not ClientStatisticsRecorder::IS_COMPILED_IN)
+    {
+        GTEST_SKIP() << "Statistics are compiled out";
+    }
+
+    ClientOptions options;
+    options.statistics.latency_histograms = true;
+
+    ApplicationClient client {IPV4_ADDRESS, PORT, options};
+
+    const size_t message_count = 10;
+    std::string message = "hello there";
+    std::string expected_payload;
+
+    for(size_t count = 0; count < message_count; ++count)
+    {
+        expected_payload += message;
+    }
+
+    std::binary_semaphore server_running_semaphore(0);
+    std::binary_semaphore server_done_semaphore(0);
+    std::binary_semaphore server_shutdown_semaphore(0);
+    std::thread server_thread (&TcpApplicationClientTest::StartMessageReceiverTcpServer, this, std::ref(server_running_semaphore), std::ref(server_done_semaphore), std::ref(server_shutdown_semaphore), expected_payload);
+
+    EXPECT_TRUE(client.Start());
+
+    while(not client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_running_semaphore.acquire();
+
+    EXPECT_TRUE(client.RequestOpen());
+
+    while(client.GetClientState() != ClientState::CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    for(size_t count = 0; count < message_count; ++count)
+    {
+        EXPECT_TRUE(client.EnqueuePayload(std::span<char>(message)));
+    }
+
+    server_done_semaphore.acquire();
+
+    // The server can have read every byte just before the TX worker has counted the last payload as sent
+    for(int attempt = 0; attempt < 500 && client.GetStatistics().tx_messages < message_count; ++attempt)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    const ClientStatistics statistics = client.GetStatistics();
+
+    EXPECT_EQ(statistics.tx_messages, message_count);
+    EXPECT_EQ(statistics.tx_bytes, expected_payload.size());
+    EXPECT_GE(statistics.send_calls, 1);
+    EXPECT_LE(statistics.send_calls, message_count);
+    EXPECT_EQ(statistics.tx_queue_depth, 0);
+    EXPECT_GE(statistics.tx_queue_high_water_mark, 1);
+    EXPECT_EQ(statistics.GetErrorCount(Error::SOCKET_SEND_FAILURE), 0);
+    EXPECT_EQ(statistics.enqueue_to_send_latency.count, message_count);
+    EXPECT_GT(statistics.enqueue_to_send_latency.GetPercentile(100.0), 0);
+
+    EXPECT_TRUE(client.RequestClose());
+
+    while(client.GetClientState() != ClientState::NOT_CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_shutdown_semaphore.release();
+
+    server_thread.join();
+}
+
+TEST_F(TcpApplicationClientTest, CollectRxStatistics)
+{
+    if constexpr(not ClientStatisticsRecorder::IS_COMPILED_IN)
+    {
+        GTEST_SKIP() << "Statistics are compiled out";
+    }
+
+    ClientOptions options;
+    options.statistics.latency_histograms = true;
+
+    ApplicationClient client {IPV4_ADDRESS, PORT, options};
+
+    const std::string message (8196, 'x');
+    std::atomic<size_t> bytes_received { 0 };
+    std::atomic<size_t> callback_count { 0 };
+    std::binary_semaphore callback_semaphore(0);
+
+    client.SetRxCallback([&](const std::span<char>& rx_payload_view)
+    {
+        ++callback_count;
+
+        if((bytes_received += rx_payload_view.size()) == message.size())
+        {
+            callback_semaphore.release();
+        }
+    });
+
+    std::binary_semaphore server_running_semaphore(0);
+    std::binary_semaphore server_shutdown_semaphore(0);
+    std::thread server_thread (&TcpApplicationClientTest::StartMessageSenderTcpServer, this, std::ref(server_running_semaphore), std::ref(server_shutdown_semaphore), message);
+
+    EXPECT_TRUE(client.Start());
+
+    while(not client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_running_semaphore.acquire();
+
+    EXPECT_TRUE(client.RequestOpen());
+
+    callback_semaphore.acquire();
+
+    EXPECT_TRUE(client.RequestClose());
+
+    while(client.GetClientState() != ClientState::NOT_CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_shutdown_semaphore.release();
+
+    server_thread.join();
+
+    const ClientStatistics statistics = client.GetStatistics();
+
+    EXPECT_EQ(statistics.rx_bytes, message.size());
+    EXPECT_EQ(statistics.rx_messages, callback_count);
+    EXPECT_GE(statistics.recv_calls, statistics.rx_messages);
+    EXPECT_EQ(statistics.recv_to_callback_latency.count, callback_count);
+    EXPECT_EQ(statistics.tx_messages, 0);
+}
+
+TEST_F(TcpApplicationClientTest, SendMessagesFromCoroutine)
+{
+    const std::string borrowed_message = "hello there";
+    const std::string owned_message = "general kenobi";
+
+    std::binary_semaphore server_running_semaphore(0);
+    std::binary_semaphore server_done_semaphore(0);
+    std::binary_semaphore server_shutdown_semaphore(0);
+    std::thread server_thread (&TcpApplicationClientTest::StartMessageReceiverTcpServer, this, std::ref(server_running_semaphore), std::ref(server_done_semaphore), std::ref(server_shutdown_semaphore), borrowed_message + owned_message);
+
+    EXPECT_TRUE(m_client.Start());
+
+    while(not m_client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_running_semaphore.acquire();
+
+    std::vector<bool> results;
+
+    const auto send_messages = [&]() -> ClientTask
+    {
+        results.push_back(co_await m_client.Connect());
+        results.push_back(co_await m_client.Send(std::span<const char>(borrowed_message)));
+        results.push_back(co_await m_client.Send(std::vector<char>(owned_message.begin(), owned_message.end())));
+    };
+
+    ClientTask task = send_messages();
+    task.Wait();
+
+    EXPECT_EQ(results, std::vector<bool>({true, true, true}));
+
+    // wait for the server to signal that it is done reading
+    server_done_semaphore.acquire();
+
+    EXPECT_TRUE(m_client.RequestClose());
+
+    while(m_client.GetClientState() != ClientState::NOT_CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_shutdown_semaphore.release();
+
+    server_thread.join();
+}
+
+TEST_F(TcpApplicationClientTest, ReceiveFramedMessagesInCoroutine)
+{
+    ClientOptions options;
+    options.framing.enabled = true;
+    options.framing.header_size = FrameHeaderSize::FOUR_BYTES;
+    options.framing.byte_order = std::endian::little;
+
+    ApplicationClient client {IPV4_ADDRESS, PORT, options};
+
+    const std::vector<std::string> messages {"<hello>", std::string(5000, 'x'), "<there>"};
+    std::string outbound_payload;
+
+    for(const std::string& message : messages)
+    {
+        const uint32_t message_size = message.size();
+        outbound_payload += std::string(reinterpret_cast<const char*>(&message_size), sizeof(message_size)) + message;
+    }
+
+    std::binary_semaphore server_running_semaphore(0);
+    std::binary_semaphore server_shutdown_semaphore(0);
+    std::thread server_thread (&TcpApplicationClientTest::StartMessageSenderTcpServer, this, std::ref(server_running_semaphore), std::ref(server_shutdown_semaphore), outbound_payload);
+
+    EXPECT_TRUE(client.Start());
+
+    while(not client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    server_running_semaphore.acquire();
+
+    // The server closes the connection right after sending, which ends the coroutine's loop with an empty message
+    server_shutdown_semaphore.release();
+
+    bool is_connected = false;
+    std::vector<std::string> received_messages;
+
+    const auto receive_messages = [&]() -> ClientTask
+    {
+        is_connected = co_await client.Connect();
+
+        for(RxMessage rx_message = co_await client.Receive(); not rx_message.bytes.empty(); rx_message = co_await client.Receive())
+        {
+            received_messages.emplace_back(rx_message.bytes.data(), rx_message.bytes.size());
+        }
+    };
+
+    ClientTask task = receive_messages();
+    task.Wait();
+
+    server_thread.join();
+
+    EXPECT_TRUE(is_connected);
+    EXPECT_EQ(received_messages, messages);
+    EXPECT_EQ(client.GetClientState(), ClientState::NOT_CONNECTED);
+}
+
+TEST_F(TcpApplicationClientTest, FailAwaitingConnectionWithoutServer)
+{
+    EXPECT_TRUE(m_client.Start());
+
+    while(not m_client.IsRunning())
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    bool is_connected = true;
+
+    const auto connect = [&]() -> ClientTask
+    {
+        is_connected = co_await m_client.Connect();
+    };
+
+    ClientTask task = connect();
+    task.Wait();
+
+    EXPECT_FALSE(is_connected);
+    EXPECT_EQ(m_client.GetClientState(), ClientState::NOT_CONNECTED);
 }
 
 } // namespace InterProcessCommunication::Test
\ No newline at end of file
@@ -0,0 +1,987 @@
+#include "application_client.h"
+#include <gtest/gtest.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <cstring>
+#include <deque>
+#include <semaphore>
+#include <vector>
+
+namespace InterProcessCommunication::Test
+{
+
+class UnixApplicationClientTest : public ::testing::Test
+{
+public:
+    static constexpr std::chrono::milliseconds CLIENT_STATE_POLL_INTERVAL { 10 };
+    static constexpr size_t BUFFER_SIZE = 64 * 1024;
+    // A frame of the default framing options holds a 4-byte big-endian length, whose top bit marks a memfd frame
+    static constexpr size_t FRAME_HEADER_SIZE = 4;
+    static constexpr uint32_t MEMFD_FRAME_FLAG = uint32_t { 1 } << 31;
+    const std::string UNIX_SOCKET_PATH { "/tmp/application_client_test_" + std::to_string(getpid()) + ".sock" };
+
+    // A received frame, with the bytes of a memfd frame read from its mapping
+    struct ServerFrame
+    {
+        bool is_memfd = false;
+        bool is_sealed = false;
+        std::string bytes {};
+    };
+
+    void TearDown() override
+    {
+        for(const int memfd : m_received_memfds)
+        {
+            close(memfd);
+        }
+
+        close(m_client_file_descriptor);
+        close(m_server_file_descriptor);
+        unlink(UNIX_SOCKET_PATH.c_str());
+    }
+
+    void OpenServer(int socket_type = SOCK_STREAM)
+    {
+        unlink(UNIX_SOCKET_PATH.c_str());
+
+        m_server_file_descriptor = socket(AF_UNIX, socket_type, 0);
+        EXPECT_NE(m_server_file_descriptor, -1);
+
+        sockaddr_un address {};
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, UNIX_SOCKET_PATH.c_str(), sizeof(address.sun_path) - 1);
+
+        EXPECT_NE(bind(m_server_file_descriptor, (sockaddr*)&address, sizeof(address)),-1);
+        EXPECT_NE(listen(m_server_file_descriptor, 1),-1);
+    }
+
+    void ConnectClient(ApplicationClient& client)
+    {
+        EXPECT_TRUE(client.Start());
+
+        while(not client.IsRunning())
+        {
+            std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+        }
+
+        EXPECT_TRUE(client.RequestOpen());
+
+        m_client_file_descriptor = accept(m_server_file_descriptor, nullptr, nullptr);
+        EXPECT_NE(m_client_file_descriptor, -1);
+
+        while(client.GetClientState() != ClientState::CONNECTED)
+        {
+            std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+        }
+    }
+
+    // Reads until byte_count more bytes are buffered, keeping every descriptor that arrives alongside them
+    void ReadBytes(size_t byte_count)
+    {
+        std::vector<char> buffer(BUFFER_SIZE);
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int) * 16)];
+
+        while(m_received_bytes.size() < byte_count)
+        {
+            iovec rx_iovec {.iov_base = buffer.data(), .iov_len = std::min(buffer.size(), byte_count - m_received_bytes.size())};
+            msghdr rx_message {};
+            rx_message.msg_iov = &rx_iovec;
+            rx_message.msg_iovlen = 1;
+            rx_message.msg_control = control;
+            rx_message.msg_controllen = sizeof(control);
+
+            const ssize_t bytes = recvmsg(m_client_file_descriptor, &rx_message, 0);
+
+            EXPECT_GT(bytes, 0);
+
+            if(bytes <= 0)
+            {
+                break;
+            }
+
+            for(cmsghdr* control_message = CMSG_FIRSTHDR(&rx_message); control_message != nullptr; control_message = CMSG_NXTHDR(&rx_message, control_message))
+            {
+                const size_t descriptor_count = (control_message->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+
+                for(size_t index = 0; index < descriptor_count; ++index)
+                {
+                    int memfd = -1;
+                    std::memcpy(&memfd, CMSG_DATA(control_message) + index * sizeof(int), sizeof(int));
+                    m_received_memfds.push_back(memfd);
+                }
+            }
+
+            m_received_bytes.insert(m_received_bytes.end(), buffer.begin(), buffer.begin() + bytes);
+        }
+    }
+
+    ServerFrame ReadFrame()
+    {
+        ReadBytes(FRAME_HEADER_SIZE);
+
+        uint32_t frame_size = 0;
+
+        for(size_t index = 0; index < FRAME_HEADER_SIZE; ++index)
+        {
+            frame_size = (frame_size << 8) | static_cast<unsigned char>(m_received_bytes[index]);
+        }
+
+        m_received_bytes.erase(m_received_bytes.begin(), m_received_bytes.begin() + FRAME_HEADER_SIZE);
+
+        if((frame_size & MEMFD_FRAME_FLAG) == 0)
+        {
+            ReadBytes(frame_size);
+
+            ServerFrame frame {.bytes = std::string(m_received_bytes.begin(), m_received_bytes.begin() + frame_size)};
+            m_received_bytes.erase(m_received_bytes.begin(), m_received_bytes.begin() + frame_size);
+
+            return frame;
+        }
+
+        EXPECT_EQ(frame_size, MEMFD_FRAME_FLAG);
+        EXPECT_FALSE(m_received_memfds.empty());
+
+        if(m_received_memfds.empty())
+        {
+            return ServerFrame {.is_memfd = true};
+        }
+
+        const int memfd = m_received_memfds.front();
+        m_received_memfds.pop_front();
+
+        struct stat memfd_status {};
+        EXPECT_EQ(fstat(memfd, &memfd_status), 0);
+
+        const int seals = fcntl(memfd, F_GET_SEALS);
+        const size_t memfd_size = memfd_status.st_size;
+        void* mapping = mmap(nullptr, memfd_size, PROT_READ, MAP_SHARED, memfd, 0);
+        EXPECT_NE(mapping, MAP_FAILED);
+
+        ServerFrame frame {.is_memfd = true, .is_sealed = (seals & F_SEAL_WRITE) != 0 && (seals & F_SEAL_SHRINK) != 0, .bytes = std::string(static_cast<const char*>(mapping), memfd_size)};
+
+        munmap(mapping, memfd_size);
+        close(memfd);
+
+        return frame;
+    }
+
+    // Sends one frame, passing the descriptor alongside a memfd frame's header
+    void WriteFrame(const std::string& bytes, int memfd = -1)
+    {
+        const uint32_t frame_size = memfd >= 0 ? MEMFD_FRAME_FLAG : bytes.size();
+        std::string frame;
+
+        for(int shift = 24; shift >= 0; shift -= 8)
+        {
+            frame.push_back(static_cast<char>((frame_size >> shift) & 0xFF));
+        }
+
+        frame += bytes;
+
+        iovec tx_iovec {.iov_base = frame.data(), .iov_len = frame.size()};
+        msghdr tx_message {};
+        tx_message.msg_iov = &tx_iovec;
+        tx_message.msg_iovlen = 1;
+
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+
+        if(memfd >= 0)
+        {
+            tx_message.msg_control = control;
+            tx_message.msg_controllen = sizeof(control);
+
+            cmsghdr* control_message = CMSG_FIRSTHDR(&tx_message);
+            control_message->cmsg_level = SOL_SOCKET;
+            control_message->cmsg_type = SCM_RIGHTS;
+            control_message->cmsg_len = CMSG_LEN(sizeof(int));
+            std::memcpy(CMSG_DATA(control_message), &memfd, sizeof(int));
+        }
+
+        EXPECT_EQ(sendmsg(m_client_file_descriptor, &tx_message, 0), static_cast<ssize_t>(frame.size()));
+    }
+
+    // Reads one SEQPACKET message, which has to fit into BUFFER_SIZE bytes
+    std::string ReadMessage()
+    {
+        std::vector<char> buffer(BUFFER_SIZE);
+        const ssize_t bytes = recv(m_client_file_descriptor, buffer.data(), buffer.size(), 0);
+
+        EXPECT_GT(bytes, 0);
+
+        return std::string(buffer.data(), std::max<ssize_t>(bytes, 0));
+    }
+
+    static ClientOptions CreateSeqpacketOptions()
+    {
+        ClientOptions options;
+        options.unix_socket.type = UnixSocketType::SEQPACKET;
+
+        return options;
+    }
+
+    static ClientOptions CreateMemfdTransferOptions()
+    {
+        ClientOptions options;
+        options.framing.enabled = true;
+        options.memfd_transfer.enabled = true;
+        options.memfd_transfer.min_payload_size = 64 * 1024;
+
+        return options;
+    }
+
+protected:
+    int m_client_file_descriptor { -1 };
+    int m_server_file_descriptor { -1 };
+    std::vector<char> m_received_bytes;
+    std::deque<int> m_received_memfds;
+};
+
+TEST_F(UnixApplicationClientTest, PassLargePayloadsAsMemfds)
+{
+    const ClientOptions options = CreateMemfdTransferOptions();
+    ApplicationClient client {UNIX_SOCKET_PATH, options};
+
+    OpenServer();
+    ConnectClient(client);
+
+    const std::string small_payload = "<small>";
+    const std::string large_payload(options.memfd_transfer.min_payload_size, 'l');
+    // Written in place, and passed as a memfd although it is below the threshold
+    const std::string in_place_payload = "<in place>";
+    std::optional<MemfdPayload> memfd_payload = MemfdPayload::Create(in_place_payload.size());
+
+    ASSERT_TRUE(memfd_payload.has_value());
+    std::memcpy(memfd_payload->GetBytes().data(), in_place_payload.data(), in_place_payload.size());
+
+    std::counting_semaphore<> completion_semaphore(0);
+    const auto completion_callback = [&](bool is_sent)
+    {
+        EXPECT_TRUE(is_sent);
+        completion_semaphore.release();
+    };
+
+    EXPECT_TRUE(client.EnqueuePayload(std::vector<char>(small_payload.begin(), small_payload.end()), completion_callback));
+    EXPECT_TRUE(client.EnqueuePayload(std::vector<char>(large_payload.begin(), large_payload.end()), completion_callback));
+    EXPECT_TRUE(client.EnqueuePayload(std::move(memfd_payload.value()), completion_callback));
+
+    const ServerFrame small_frame = ReadFrame();
+    const ServerFrame large_frame = ReadFrame();
+    const ServerFrame in_place_frame = ReadFrame();
+
+    EXPECT_FALSE(small_frame.is_memfd);
+    EXPECT_EQ(small_frame.bytes, small_payload);
+
+    EXPECT_TRUE(large_frame.is_memfd);
+    EXPECT_TRUE(large_frame.is_sealed);
+    EXPECT_EQ(large_frame.bytes, large_payload);
+
+    EXPECT_TRUE(in_place_frame.is_memfd);
+    EXPECT_TRUE(in_place_frame.is_sealed);
+    EXPECT_EQ(in_place_frame.bytes, in_place_payload);
+
+    for(size_t count = 0; count < 3; ++count)
+    {
+        completion_semaphore.acquire();
+    }
+
+    EXPECT_TRUE(client.RequestClose());
+}
+
+TEST_F(UnixApplicationClientTest, ReceiveMemfdsAsMappedMessages)
+{
+    ApplicationClient client {UNIX_SOCKET_PATH, CreateMemfdTransferOptions()};
+
+    std::vector<std::string> received_messages;
+    std::vector<RxBufferRef> retained_buffers;
+    std::binary_semaphore callback_semaphore(0);
+
+    client.SetRxBufferCallback([&](const RxBufferRef& rx_buffer, const std::span<char>& rx_bytes)
+    {
+        received_messages.emplace_back(rx_bytes.data(), rx_bytes.size());
+        retained_buffers.push_back(rx_buffer);
+
+        if(received_messages.size() == 3)
+        {
+            callback_semaphore.release();
+        }
+    });
+
+    OpenServer();
+    ConnectClient(client);
+
+    const std::string large_message(1024 * 1024, 'm');
+    std::optional<MemfdPayload> memfd_payload = MemfdPayload::CreateSealed(large_message);
+
+    ASSERT_TRUE(memfd_payload.has_value());
+
+    WriteFrame("<before>");
+    WriteFrame("", memfd_payload->GetFileDescriptor());
+    WriteFrame("<after>");
+
+    callback_semaphore.acquire();
+
+    EXPECT_EQ(received_messages, std::vector<std::string>({"<before>", large_message, "<after>"}));
+
+    // The retained mapping stays readable after the callback, and writing to it only changes the client's private copy
+    retained_buffers[1].GetData()[0] = 'x';
+    EXPECT_EQ(retained_buffers[1].GetSize(), large_message.size());
+    EXPECT_EQ(retained_buffers[1].GetData()[1], 'm');
+
+    EXPECT_TRUE(client.RequestClose());
+}
+
+TEST_F(UnixApplicationClientTest, DropConnectionOnUnsealedMemfd)
+{
+    ApplicationClient client {UNIX_SOCKET_PATH, CreateMemfdTransferOptions()};
+
+    std::vector<Error> errors;
+    std::binary_semaphore disconnected_semaphore(0);
+
+    client.SetErrorCallback([&](const Error& error, const std::optional<std::span<char>>&)
+    {
+        errors.push_back(error);
+    });
+
+    client.SetDisconnectedCallback([&]()
+    {
+        disconnected_semaphore.release();
+    });
+
+    OpenServer();
+    ConnectClient(client);
+
+    // The sender could still truncate a memfd without seals underneath the client's mapping
+    std::optional<MemfdPayload> memfd_payload = MemfdPayload::Create(4096);
+
+    ASSERT_TRUE(memfd_payload.has_value());
+
+    WriteFrame("", memfd_payload->GetFileDescriptor());
+
+    disconnected_semaphore.acquire();
+
+    EXPECT_EQ(errors, std::vector<Error>({Error::MEMFD_TRANSFER_FAILURE}));
+    EXPECT_EQ(client.GetClientState(), ClientState::NOT_CONNECTED);
+}
+
+TEST_F(UnixApplicationClientTest, RefuseMemfdTransferClientOnIoUringReactor)
+{
+    ClientReactor reactor {1, ReactorBackend::IO_URING};
+    ApplicationClient client {UNIX_SOCKET_PATH, CreateMemfdTransferOptions()};
+
+    // Without io_uring the reactor has fallen back to epoll, whose reads take the descriptors along
+    EXPECT_EQ(client.Start(reactor), reactor.GetBackend() == ReactorBackend::EPOLL);
+}
+
+TEST_F(UnixApplicationClientTest, SendEveryPayloadAsOneMessage)
+{
+    ClientOptions options = CreateSeqpacketOptions();
+    // The messages carry their own boundaries, so framing adds no header to them
+    options.framing.enabled = true;
+    options.tx_batch.enabled = true;
+
+    ApplicationClient client {UNIX_SOCKET_PATH, options};
+
+    OpenServer(SOCK_SEQPACKET);
+    ConnectClient(client);
+
+    const std::vector<std::string> payloads = {"<first>", std::string(4096, 's'), "<third>"};
+    std::counting_semaphore<> completion_semaphore(0);
+
+    for(const std::string& payload : payloads)
+    {
+        EXPECT_TRUE(client.EnqueuePayload(std::vector<char>(payload.begin(), payload.end()), [&](bool is_sent)
+        {
+            EXPECT_TRUE(is_sent);
+            completion_semaphore.release();
+        }));
+    }
+
+    for(const std::string& payload : payloads)
+    {
+        EXPECT_EQ(ReadMessage(), payload);
+        completion_semaphore.acquire();
+    }
+
+    EXPECT_TRUE(client.RequestClose());
+}
+
+TEST_F(UnixApplicationClientTest, DeliverOneMessagePerCallback)
+{
+    ClientOptions options = CreateSeqpacketOptions();
+    options.unix_socket.rx_batch_messages = 2;
+
+    ApplicationClient client {UNIX_SOCKET_PATH, options};
+
+    std::vector<std::string> received_messages;
+    std::vector<Error> errors;
+    std::binary_semaphore disconnected_semaphore(0);
+
+    client.SetRxCallback([&](const std::span<char>& rx_bytes)
+    {
+        received_messages.emplace_back(rx_bytes.data(), rx_bytes.size());
+    });
+
+    client.SetErrorCallback([&](const Error& error, const std::optional<std::span<char>>&)
+    {
+        errors.push_back(error);
+    });
+
+    client.SetDisconnectedCallback([&]()
+    {
+        disconnected_semaphore.release();
+    });
+
+    OpenServer(SOCK_SEQPACKET);
+    ConnectClient(client);
+
+    // More messages than a batch holds, one of which does not fit into the RX buffer. The messages after it still arrive whole.
+    const std::vector<std::string> messages = {"<first>", "<second>", std::string(options.rx_buffer.max_buffer_size + 1, 'l'), "<fourth>", "<fifth>"};
+
+    for(const std::string& message : messages)
+    {
+        EXPECT_EQ(send(m_client_file_descriptor, message.data(), message.size(), 0), static_cast<ssize_t>(message.size()));
+    }
+
+    close(m_client_file_descriptor);
+    m_client_file_descriptor = -1;
+
+    disconnected_semaphore.acquire();
+
+    EXPECT_EQ(received_messages, std::vector<std::string>({"<first>", "<second>", "<fourth>", "<fifth>"}));
+    EXPECT_EQ(errors, std::vector<Error>({Error::FRAME_SIZE_FAILURE}));
+    EXPECT_EQ(client.GetClientState(), ClientState::NOT_CONNECTED);
+}
+
+TEST_F(UnixApplicationClientTest, RejectEmptySeqpacketMessages)
+{
+    ApplicationClient client {UNIX_SOCKET_PATH, CreateSeqpacketOptions()};
+
+    std::vector<std::string> received_messages;
+    std::vector<Error> errors;
+    std::binary_semaphore release_semaphore(0);
+    std::binary_semaphore rx_semaphore(0);
+    std::binary_semaphore disconnected_semaphore(0);
+
+    client.SetRxCallback([&](const std::span<char>& rx_bytes)
+    {
+        // Holding the first message lets the following ones pile up, so that they are read with a single batch
+        if(received_messages.empty())
+        {
+            release_semaphore.acquire();
+        }
+
+        received_messages.emplace_back(rx_bytes.data(), rx_bytes.size());
+
+        if(received_messages.size() == 3)
+        {
+            rx_semaphore.release();
+        }
+    });
+
+    client.SetErrorCallback([&](const Error& error, const std::optional<std::span<char>>&)
+    {
+        errors.push_back(error);
+    });
+
+    client.SetDisconnectedCallback([&]()
+    {
+        disconnected_semaphore.release();
+    });
+
+    OpenServer(SOCK_SEQPACKET);
+    ConnectClient(client);
+
+    const auto send_messages = [&](const std::vector<std::string>& messages)
+    {
+        for(const std::string& message : messages)
+        {
+            EXPECT_EQ(send(m_client_file_descriptor, message.data(), message.size(), 0), static_cast<ssize_t>(message.size()));
+        }
+    };
+
+    // An empty message is neither the end of the connection nor a reason to drop the messages that follow it
+    send_messages({"", "<first>"});
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    send_messages({"<second>", "", "<third>"});
+    release_semaphore.release();
+
+    EXPECT_TRUE(rx_semaphore.try_acquire_for(std::chrono::seconds(5)));
+
+    EXPECT_EQ(received_messages, std::vector<std::string>({"<first>", "<second>", "<third>"}));
+    EXPECT_EQ(errors, std::vector<Error>({Error::FRAME_SIZE_FAILURE, Error::FRAME_SIZE_FAILURE}));
+    EXPECT_EQ(client.GetClientState(), ClientState::CONNECTED);
+
+    close(m_client_file_descriptor);
+    m_client_file_descriptor = -1;
+
+    disconnected_semaphore.acquire();
+
+    EXPECT_EQ(client.GetClientState(), ClientState::NOT_CONNECTED);
+}
+
+TEST_F(UnixApplicationClientTest, ExchangeSeqpacketMessagesOnReactor)
+{
+    ClientReactor reactor;
+    ApplicationClient client {UNIX_SOCKET_PATH, CreateSeqpacketOptions()};
+
+    std::vector<std::string> received_messages;
+    std::binary_semaphore rx_semaphore(0);
+
+    client.SetRxCallback([&](const std::span<char>& rx_bytes)
+    {
+        received_messages.emplace_back(rx_bytes.data(), rx_bytes.size());
+
+        if(received_messages.size() == 2)
+        {
+            rx_semaphore.release();
+        }
+    });
+
+    OpenServer(SOCK_SEQPACKET);
+
+    EXPECT_TRUE(reactor.Start());
+    EXPECT_TRUE(client.Start(reactor));
+    EXPECT_TRUE(client.RequestOpen());
+
+    m_client_file_descriptor = accept(m_server_file_descriptor, nullptr, nullptr);
+    EXPECT_NE(m_client_file_descriptor, -1);
+
+    while(client.GetClientState() != ClientState::CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    std::string request = "<request>";
+    EXPECT_TRUE(client.EnqueuePayload(std::span<char>(request)));
+    EXPECT_EQ(ReadMessage(), request);
+
+    EXPECT_EQ(send(m_client_file_descriptor, "<first reply>", 13, 0), 13);
+    EXPECT_EQ(send(m_client_file_descriptor, "<second reply>", 14, 0), 14);
+
+    rx_semaphore.acquire();
+
+    EXPECT_EQ(received_messages, std::vector<std::string>({"<first reply>", "<second reply>"}));
+    EXPECT_TRUE(client.RequestClose());
+}
+
+TEST_F(UnixApplicationClientTest, RefuseSeqpacketClientOnIoUringReactor)
+{
+    ClientReactor reactor {1, ReactorBackend::IO_URING};
+    ApplicationClient client {UNIX_SOCKET_PATH, CreateSeqpacketOptions()};
+
+    // Without io_uring the reactor has fallen back to epoll, which drives the client like any other
+    EXPECT_EQ(client.Start(reactor), reactor.GetBackend() == ReactorBackend::EPOLL);
+}
+
+TEST_F(UnixApplicationClientTest, DeliverMessagesOnExecutorInOrder)
+{
+    constexpr size_t MESSAGE_COUNT = 200;
+
+    ClientOptions options;
+    options.framing.enabled = true;
+    options.rx_dispatch.enabled = true;
+    // More threads than one, which must still take the messages one at a time
+    options.rx_dispatch.thread_count = 4;
+
+    ApplicationClient client {UNIX_SOCKET_PATH, options};
+
+    std::vector<std::string> received_messages;
+    std::atomic<bool> is_in_callback { false };
+    std::binary_semaphore rx_semaphore(0);
+
+    client.SetRxCallback([&](const std::span<char>& rx_bytes)
+    {
+        EXPECT_FALSE(is_in_callback.exchange(true));
+
+        // A slow first callback, while the RX consumer keeps reading the messages behind it
+        if(received_messages.empty())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+
+        received_messages.emplace_back(rx_bytes.data(), rx_bytes.size());
+        is_in_callback = false;
+
+        if(received_messages.size() == MESSAGE_COUNT)
+        {
+            rx_semaphore.release();
+        }
+    });
+
+    OpenServer();
+    ConnectClient(client);
+
+    std::vector<std::string> messages;
+
+    for(size_t index = 0; index < MESSAGE_COUNT; ++index)
+    {
+        messages.push_back("<message " + std::to_string(index) + ">");
+        WriteFrame(messages.back());
+    }
+
+    rx_semaphore.acquire();
+
+    EXPECT_EQ(received_messages, messages);
+    EXPECT_TRUE(client.RequestClose());
+
+    if constexpr(ClientStatisticsRecorder::IS_COMPILED_IN)
+    {
+        // A message is counted as delivered once its callback has returned, which is after the last one released the semaphore
+        while(client.GetStatistics().rx_dispatch_queue_depth > 0)
+        {
+            std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+        }
+
+        const ClientStatistics statistics = client.GetStatistics();
+
+        EXPECT_EQ(statistics.rx_messages, MESSAGE_COUNT);
+        EXPECT_GT(statistics.rx_dispatch_queue_high_water_mark, 1);
+    }
+}
+
+TEST_F(UnixApplicationClientTest, BoundRxDispatchQueue)
+{
+    constexpr size_t MESSAGE_COUNT = 20;
+
+    ClientOptions options;
+    options.framing.enabled = true;
+    options.rx_dispatch.enabled = true;
+    options.rx_dispatch.max_queued_messages = 4;
+
+    ApplicationClient client {UNIX_SOCKET_PATH, options};
+
+    std::vector<std::string> received_messages;
+    std::binary_semaphore release_semaphore(0);
+    std::binary_semaphore rx_semaphore(0);
+
+    client.SetRxCallback([&](const std::span<char>& rx_bytes)
+    {
+        if(received_messages.empty())
+        {
+            release_semaphore.acquire();
+        }
+
+        received_messages.emplace_back(rx_bytes.data(), rx_bytes.size());
+
+        if(received_messages.size() == MESSAGE_COUNT)
+        {
+            rx_semaphore.release();
+        }
+    });
+
+    OpenServer();
+    ConnectClient(client);
+
+    std::vector<std::string> messages;
+
+    for(size_t index = 0; index < MESSAGE_COUNT; ++index)
+    {
+        messages.push_back("<message " + std::to_string(index) + ">");
+        WriteFrame(messages.back());
+    }
+
+    // The first message is held in its callback, so the RX consumer has to stop once the queue behind it is full
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    if constexpr(ClientStatisticsRecorder::IS_COMPILED_IN)
+    {
+        const ClientStatistics statistics = client.GetStatistics();
+
+        EXPECT_EQ(statistics.rx_dispatch_queue_depth, options.rx_dispatch.max_queued_messages + 1);
+        EXPECT_EQ(statistics.rx_dispatch_queue_high_water_mark, options.rx_dispatch.max_queued_messages + 1);
+    }
+
+    release_semaphore.release();
+    rx_semaphore.acquire();
+
+    EXPECT_EQ(received_messages, messages);
+    EXPECT_TRUE(client.RequestClose());
+}
+
+TEST_F(UnixApplicationClientTest, DispatchToSuppliedExecutor)
+{
+    // Hands every task on to a pool, counting them
+    class CountingExecutor : public CallbackExecutor
+    {
+    public:
+
+        void Execute(ExecutorTask task) override
+        {
+            ++task_count;
+            m_executor.Execute(std::move(task));
+        }
+
+        std::atomic<size_t> task_count { 0 };
+
+    private:
+
+        ThreadPoolExecutor m_executor;
+    };
+
+    const std::shared_ptr<CountingExecutor> executor = std::make_shared<CountingExecutor>();
+
+    ClientOptions options;
+    options.framing.enabled = true;
+    options.rx_dispatch.enabled = true;
+    options.rx_dispatch.executor = executor;
+
+    ApplicationClient client {UNIX_SOCKET_PATH, options};
+
+    std::vector<std::string> received_messages;
+    std::binary_semaphore rx_semaphore(0);
+
+    client.SetRxBufferCallback([&](const RxBufferRef& rx_buffer, const std::span<char>& rx_bytes)
+    {
+        EXPECT_TRUE(rx_buffer);
+        received_messages.emplace_back(rx_bytes.data(), rx_bytes.size());
+
+        if(received_messages.size() == 2)
+        {
+            rx_semaphore.release();
+        }
+    });
+
+    OpenServer();
+    ConnectClient(client);
+
+    WriteFrame("<first>");
+    WriteFrame("<second>");
+
+    rx_semaphore.acquire();
+
+    EXPECT_EQ(received_messages, std::vector<std::string>({"<first>", "<second>"}));
+    EXPECT_GE(executor->task_count, 1);
+    EXPECT_TRUE(client.RequestClose());
+}
+
+TEST_F(UnixApplicationClientTest, DropDispatchedMessagesOnDestruction)
+{
+    ClientOptions options;
+    options.framing.enabled = true;
+    options.rx_dispatch.enabled = true;
+
+    auto client = std::make_unique<ApplicationClient>(UNIX_SOCKET_PATH, options);
+
+    std::atomic<size_t> callback_count { 0 };
+    std::binary_semaphore callback_semaphore(0);
+    std::binary_semaphore release_semaphore(0);
+
+    client->SetRxCallback([&](const std::span<char>&)
+    {
+        if(++callback_count == 1)
+        {
+            callback_semaphore.release();
+            release_semaphore.acquire();
+        }
+    });
+
+    OpenServer();
+    ConnectClient(*client);
+
+    WriteFrame("<first>");
+    WriteFrame("<second>");
+    WriteFrame("<third>");
+
+    callback_semaphore.acquire();
+
+    // Give the RX consumer time to queue the messages behind the one that is held
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // The destructor waits for the callback that is running, and drops the messages that are still queued
+    std::thread destroying_thread([&](){ client.reset(); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    release_semaphore.release();
+    destroying_thread.join();
+
+    EXPECT_EQ(callback_count, 1);
+}
+
+TEST_F(UnixApplicationClientTest, DeliverAvailableMessagesInBatches)
+{
+    constexpr size_t MESSAGE_COUNT = 10;
+
+    ClientOptions options;
+    options.framing.enabled = true;
+    options.rx_batch.max_messages = 4;
+
+    ApplicationClient client {UNIX_SOCKET_PATH, options};
+
+    std::vector<RxMessage> received_messages;
+    std::vector<size_t> batch_sizes;
+    bool is_disconnected_after_batches = false;
+    std::binary_semaphore disconnected_semaphore(0);
+
+    client.SetRxCallback([&](const std::span<char>&)
+    {
+        ADD_FAILURE() << "The batch callback replaces the RX callback";
+    });
+
+    client.SetRxBatchCallback([&](std::span<const RxMessage> rx_messages)
+    {
+        // The messages are kept beyond the callback, which retains their buffers
+        received_messages.insert(received_messages.end(), rx_messages.begin(), rx_messages.end());
+        batch_sizes.push_back(rx_messages.size());
+    });
+
+    client.SetDisconnectedCallback([&]()
+    {
+        is_disconnected_after_batches = received_messages.size() == MESSAGE_COUNT;
+        disconnected_semaphore.release();
+    });
+
+    OpenServer();
+    ConnectClient(client);
+
+    // Every frame goes with a single write, so that one read takes all of them
+    std::vector<std::string> messages;
+    std::string frames;
+
+    for(size_t index = 0; index < MESSAGE_COUNT; ++index)
+    {
+        messages.push_back("<message " + std::to_string(index) + ">");
+        const uint32_t frame_size = messages.back().size();
+
+        for(int shift = 24; shift >= 0; shift -= 8)
+        {
+            frames.push_back(static_cast<char>((frame_size >> shift) & 0xFF));
+        }
+
+        frames += messages.back();
+    }
+
+    EXPECT_EQ(send(m_client_file_descriptor, frames.data(), frames.size(), 0), static_cast<ssize_t>(frames.size()));
+
+    close(m_client_file_descriptor);
+    m_client_file_descriptor = -1;
+
+    disconnected_semaphore.acquire();
+
+    std::vector<std::string> received_bytes;
+
+    for(const RxMessage& rx_message : received_messages)
+    {
+        EXPECT_TRUE(rx_message.buffer);
+        received_bytes.emplace_back(rx_message.bytes.data(), rx_message.bytes.size());
+    }
+
+    EXPECT_EQ(received_bytes, messages);
+    EXPECT_EQ(batch_sizes, std::vector<size_t>({4, 4, 2}));
+    EXPECT_TRUE(is_disconnected_after_batches);
+
+    if constexpr(ClientStatisticsRecorder::IS_COMPILED_IN)
+    {
+        EXPECT_EQ(client.GetStatistics().rx_messages, MESSAGE_COUNT);
+    }
+}
+
+TEST_F(UnixApplicationClientTest, DeliverSeqpacketMessagesInBatchesOnReactor)
+{
+    constexpr size_t MESSAGE_COUNT = 20;
+
+    ClientReactor reactor;
+    ApplicationClient client {UNIX_SOCKET_PATH, CreateSeqpacketOptions()};
+
+    std::vector<std::string> received_messages;
+    std::binary_semaphore rx_semaphore(0);
+
+    client.SetRxBatchCallback([&](std::span<const RxMessage> rx_messages)
+    {
+        EXPECT_FALSE(rx_messages.empty());
+
+        for(const RxMessage& rx_message : rx_messages)
+        {
+            received_messages.emplace_back(rx_message.bytes.data(), rx_message.bytes.size());
+        }
+
+        if(received_messages.size() == MESSAGE_COUNT)
+        {
+            rx_semaphore.release();
+        }
+    });
+
+    OpenServer(SOCK_SEQPACKET);
+
+    EXPECT_TRUE(reactor.Start());
+    EXPECT_TRUE(client.Start(reactor));
+    EXPECT_TRUE(client.RequestOpen());
+
+    m_client_file_descriptor = accept(m_server_file_descriptor, nullptr, nullptr);
+    EXPECT_NE(m_client_file_descriptor, -1);
+
+    while(client.GetClientState() != ClientState::CONNECTED)
+    {
+        std::this_thread::sleep_for(CLIENT_STATE_POLL_INTERVAL);
+    }
+
+    std::vector<std::string> messages;
+
+    for(size_t index = 0; index < MESSAGE_COUNT; ++index)
+    {
+        messages.push_back("<message " + std::to_string(index) + ">");
+        EXPECT_EQ(send(m_client_file_descriptor, messages.back().data(), messages.back().size(), 0), static_cast<ssize_t>(messages.back().size()));
+    }
+
+    rx_semaphore.acquire();
+
+    EXPECT_EQ(received_messages, messages);
+    EXPECT_TRUE(client.RequestClose());
+}
+
+TEST_F(UnixApplicationClientTest, DeliverDispatchedMessagesInBatches)
+{
+    constexpr size_t MESSAGE_COUNT = 20;
+
+    ClientOptions options;
+    options.framing.enabled = true;
+    options.rx_dispatch.enabled = true;
+
+    ApplicationClient client {UNIX_SOCKET_PATH, options};
+
+    std::vector<std::string> received_messages;
+    size_t batch_count = 0;
+    std::binary_semaphore release_semaphore(0);
+    std::binary_semaphore rx_semaphore(0);
+
+    client.SetRxBatchCallback([&](std::span<const RxMessage> rx_messages)
+    {
+        // The first batch is held, so that the messages behind it pile up in the queue
+        if(batch_count++ == 0)
+        {
+            release_semaphore.acquire();
+        }
+
+        for(const RxMessage& rx_message : rx_messages)
+        {
+            received_messages.emplace_back(rx_message.bytes.data(), rx_message.bytes.size());
+        }
+
+        if(received_messages.size() == MESSAGE_COUNT)
+        {
+            rx_semaphore.release();
+        }
+    });
+
+    OpenServer();
+    ConnectClient(client);
+
+    std::vector<std::string> messages;
+
+    for(size_t index = 0; index < MESSAGE_COUNT; ++index)
+    {
+        messages.push_back("<message " + std::to_string(index) + ">");
+        WriteFrame(messages.back());
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    release_semaphore.release();
+    rx_semaphore.acquire();
+
+    EXPECT_EQ(received_messages, messages);
+    EXPECT_LT(batch_count, MESSAGE_COUNT);
+    EXPECT_TRUE(client.RequestClose());
+}
+
+} // namespace InterProcessCommunication::Test